@@ -0,0 +1,29 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "unilink::unilink_shared" for configuration "Release"
+set_property(TARGET unilink::unilink_shared APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(unilink::unilink_shared PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libunilink.so.0.1.0"
+  IMPORTED_SONAME_RELEASE "libunilink.so.0"
+  )
+
+list(APPEND _cmake_import_check_targets unilink::unilink_shared )
+list(APPEND _cmake_import_check_files_for_unilink::unilink_shared "${_IMPORT_PREFIX}/lib/libunilink.so.0.1.0" )
+
+# Import target "unilink::unilink_static" for configuration "Release"
+set_property(TARGET unilink::unilink_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(unilink::unilink_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libunilink_static.a"
+  )
+
+list(APPEND _cmake_import_check_targets unilink::unilink_static )
+list(APPEND _cmake_import_check_files_for_unilink::unilink_static "${_IMPORT_PREFIX}/lib/libunilink_static.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
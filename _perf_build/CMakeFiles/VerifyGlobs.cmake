@@ -0,0 +1,168 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by CMake Version 3.25
+cmake_policy(SET CMP0009 NEW)
+
+# UNILINK_SOURCES at CMakeLists.txt:32 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/unilink/**/*.cc")
+set(OLD_GLOB
+  "/root/repo/unilink/builder/auto_initializer.cc"
+  "/root/repo/unilink/builder/serial_builder.cc"
+  "/root/repo/unilink/builder/tcp_client_builder.cc"
+  "/root/repo/unilink/builder/tcp_server_builder.cc"
+  "/root/repo/unilink/builder/unified_builder.cc"
+  "/root/repo/unilink/common/async_tracer.cc"
+  "/root/repo/unilink/common/binary_log.cc"
+  "/root/repo/unilink/common/channel_metrics.cc"
+  "/root/repo/unilink/common/component_registry.cc"
+  "/root/repo/unilink/common/error_handler.cc"
+  "/root/repo/unilink/common/input_validator.cc"
+  "/root/repo/unilink/common/io_context_manager.cc"
+  "/root/repo/unilink/common/io_context_pool.cc"
+  "/root/repo/unilink/common/log_rotation.cc"
+  "/root/repo/unilink/common/logger.cc"
+  "/root/repo/unilink/common/loop_monitor.cc"
+  "/root/repo/unilink/common/memory_pool.cc"
+  "/root/repo/unilink/common/memory_tracker.cc"
+  "/root/repo/unilink/common/safe_data_buffer.cc"
+  "/root/repo/unilink/config/config_binder.cc"
+  "/root/repo/unilink/config/config_factory.cc"
+  "/root/repo/unilink/config/config_manager.cc"
+  "/root/repo/unilink/factory/channel_factory.cc"
+  "/root/repo/unilink/factory/channel_provisioner.cc"
+  "/root/repo/unilink/transport/serial/serial.cc"
+  "/root/repo/unilink/transport/tcp_client/tcp_client.cc"
+  "/root/repo/unilink/transport/tcp_server/boost_tcp_acceptor.cc"
+  "/root/repo/unilink/transport/tcp_server/boost_tcp_socket.cc"
+  "/root/repo/unilink/transport/tcp_server/tcp_server.cc"
+  "/root/repo/unilink/transport/tcp_server/tcp_server_session.cc"
+  "/root/repo/unilink/transport/tcp_server/topic_router.cc"
+  "/root/repo/unilink/wrapper/request/request_channel.cc"
+  "/root/repo/unilink/wrapper/serial/serial.cc"
+  "/root/repo/unilink/wrapper/tcp_client/tcp_client.cc"
+  "/root/repo/unilink/wrapper/tcp_server/tcp_server.cc"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_perf_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# UNILINK_HEADERS at CMakeLists.txt:37 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/unilink/**/*.h")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_perf_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# UNILINK_HEADERS at CMakeLists.txt:37 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/unilink/**/*.hpp")
+set(OLD_GLOB
+  "/root/repo/unilink/builder/auto_initializer.hpp"
+  "/root/repo/unilink/builder/ibuilder.hpp"
+  "/root/repo/unilink/builder/serial_builder.hpp"
+  "/root/repo/unilink/builder/tcp_client_builder.hpp"
+  "/root/repo/unilink/builder/tcp_server_builder.hpp"
+  "/root/repo/unilink/builder/unified_builder.hpp"
+  "/root/repo/unilink/common/async_tracer.hpp"
+  "/root/repo/unilink/common/binary_log.hpp"
+  "/root/repo/unilink/common/channel_metrics.hpp"
+  "/root/repo/unilink/common/common.hpp"
+  "/root/repo/unilink/common/component_registry.hpp"
+  "/root/repo/unilink/common/constants.hpp"
+  "/root/repo/unilink/common/error_handler.hpp"
+  "/root/repo/unilink/common/error_types.hpp"
+  "/root/repo/unilink/common/exceptions.hpp"
+  "/root/repo/unilink/common/input_validator.hpp"
+  "/root/repo/unilink/common/io_context_manager.hpp"
+  "/root/repo/unilink/common/io_context_pool.hpp"
+  "/root/repo/unilink/common/log_rotation.hpp"
+  "/root/repo/unilink/common/logger.hpp"
+  "/root/repo/unilink/common/loop_monitor.hpp"
+  "/root/repo/unilink/common/memory_pool.hpp"
+  "/root/repo/unilink/common/memory_tracker.hpp"
+  "/root/repo/unilink/common/memory_validator.hpp"
+  "/root/repo/unilink/common/platform.hpp"
+  "/root/repo/unilink/common/safe_data_buffer.hpp"
+  "/root/repo/unilink/common/safe_span.hpp"
+  "/root/repo/unilink/common/thread_safe_state.hpp"
+  "/root/repo/unilink/common/tracepoints.hpp"
+  "/root/repo/unilink/config/config_binder.hpp"
+  "/root/repo/unilink/config/config_factory.hpp"
+  "/root/repo/unilink/config/config_manager.hpp"
+  "/root/repo/unilink/config/config_snapshot.hpp"
+  "/root/repo/unilink/config/iconfig_manager.hpp"
+  "/root/repo/unilink/config/serial_config.hpp"
+  "/root/repo/unilink/config/tcp_client_config.hpp"
+  "/root/repo/unilink/config/tcp_server_config.hpp"
+  "/root/repo/unilink/factory/channel_factory.hpp"
+  "/root/repo/unilink/factory/channel_provisioner.hpp"
+  "/root/repo/unilink/interface/channel.hpp"
+  "/root/repo/unilink/interface/iserial_port.hpp"
+  "/root/repo/unilink/interface/itcp_acceptor.hpp"
+  "/root/repo/unilink/interface/itcp_resolver.hpp"
+  "/root/repo/unilink/interface/itcp_socket.hpp"
+  "/root/repo/unilink/interface/itimer.hpp"
+  "/root/repo/unilink/transport/serial/boost_serial_port.hpp"
+  "/root/repo/unilink/transport/serial/serial.hpp"
+  "/root/repo/unilink/transport/tcp_client/tcp_client.hpp"
+  "/root/repo/unilink/transport/tcp_server/boost_tcp_acceptor.hpp"
+  "/root/repo/unilink/transport/tcp_server/boost_tcp_socket.hpp"
+  "/root/repo/unilink/transport/tcp_server/tcp_server.hpp"
+  "/root/repo/unilink/transport/tcp_server/tcp_server_session.hpp"
+  "/root/repo/unilink/transport/tcp_server/topic_router.hpp"
+  "/root/repo/unilink/wrapper/awaitable/awaitable_channel.hpp"
+  "/root/repo/unilink/wrapper/ichannel.hpp"
+  "/root/repo/unilink/wrapper/request/request_channel.hpp"
+  "/root/repo/unilink/wrapper/serial/serial.hpp"
+  "/root/repo/unilink/wrapper/tcp_client/tcp_client.hpp"
+  "/root/repo/unilink/wrapper/tcp_server/tcp_server.hpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_perf_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# UNILINK_SOURCES at CMakeLists.txt:32 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/unilink/*.cc")
+set(OLD_GLOB
+  "/root/repo/unilink/builder/auto_initializer.cc"
+  "/root/repo/unilink/builder/serial_builder.cc"
+  "/root/repo/unilink/builder/tcp_client_builder.cc"
+  "/root/repo/unilink/builder/tcp_server_builder.cc"
+  "/root/repo/unilink/builder/unified_builder.cc"
+  "/root/repo/unilink/common/async_tracer.cc"
+  "/root/repo/unilink/common/binary_log.cc"
+  "/root/repo/unilink/common/channel_metrics.cc"
+  "/root/repo/unilink/common/component_registry.cc"
+  "/root/repo/unilink/common/error_handler.cc"
+  "/root/repo/unilink/common/input_validator.cc"
+  "/root/repo/unilink/common/io_context_manager.cc"
+  "/root/repo/unilink/common/io_context_pool.cc"
+  "/root/repo/unilink/common/log_rotation.cc"
+  "/root/repo/unilink/common/logger.cc"
+  "/root/repo/unilink/common/loop_monitor.cc"
+  "/root/repo/unilink/common/memory_pool.cc"
+  "/root/repo/unilink/common/memory_tracker.cc"
+  "/root/repo/unilink/common/safe_data_buffer.cc"
+  "/root/repo/unilink/config/config_binder.cc"
+  "/root/repo/unilink/config/config_factory.cc"
+  "/root/repo/unilink/config/config_manager.cc"
+  "/root/repo/unilink/factory/channel_factory.cc"
+  "/root/repo/unilink/factory/channel_provisioner.cc"
+  "/root/repo/unilink/transport/serial/serial.cc"
+  "/root/repo/unilink/transport/tcp_client/tcp_client.cc"
+  "/root/repo/unilink/transport/tcp_server/boost_tcp_acceptor.cc"
+  "/root/repo/unilink/transport/tcp_server/boost_tcp_socket.cc"
+  "/root/repo/unilink/transport/tcp_server/tcp_server.cc"
+  "/root/repo/unilink/transport/tcp_server/tcp_server_session.cc"
+  "/root/repo/unilink/transport/tcp_server/topic_router.cc"
+  "/root/repo/unilink/wrapper/request/request_channel.cc"
+  "/root/repo/unilink/wrapper/serial/serial.cc"
+  "/root/repo/unilink/wrapper/tcp_client/tcp_client.cc"
+  "/root/repo/unilink/wrapper/tcp_server/tcp_server.cc"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_perf_build/CMakeFiles/cmake.verify_globs")
+endif()
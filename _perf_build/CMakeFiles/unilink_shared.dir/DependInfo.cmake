@@ -0,0 +1,60 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/unilink/builder/auto_initializer.cc" "CMakeFiles/unilink_shared.dir/unilink/builder/auto_initializer.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/builder/auto_initializer.cc.o.d"
+  "/root/repo/unilink/builder/serial_builder.cc" "CMakeFiles/unilink_shared.dir/unilink/builder/serial_builder.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/builder/serial_builder.cc.o.d"
+  "/root/repo/unilink/builder/tcp_client_builder.cc" "CMakeFiles/unilink_shared.dir/unilink/builder/tcp_client_builder.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/builder/tcp_client_builder.cc.o.d"
+  "/root/repo/unilink/builder/tcp_server_builder.cc" "CMakeFiles/unilink_shared.dir/unilink/builder/tcp_server_builder.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/builder/tcp_server_builder.cc.o.d"
+  "/root/repo/unilink/builder/unified_builder.cc" "CMakeFiles/unilink_shared.dir/unilink/builder/unified_builder.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/builder/unified_builder.cc.o.d"
+  "/root/repo/unilink/common/async_tracer.cc" "CMakeFiles/unilink_shared.dir/unilink/common/async_tracer.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/common/async_tracer.cc.o.d"
+  "/root/repo/unilink/common/binary_log.cc" "CMakeFiles/unilink_shared.dir/unilink/common/binary_log.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/common/binary_log.cc.o.d"
+  "/root/repo/unilink/common/channel_metrics.cc" "CMakeFiles/unilink_shared.dir/unilink/common/channel_metrics.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/common/channel_metrics.cc.o.d"
+  "/root/repo/unilink/common/component_registry.cc" "CMakeFiles/unilink_shared.dir/unilink/common/component_registry.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/common/component_registry.cc.o.d"
+  "/root/repo/unilink/common/error_handler.cc" "CMakeFiles/unilink_shared.dir/unilink/common/error_handler.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/common/error_handler.cc.o.d"
+  "/root/repo/unilink/common/input_validator.cc" "CMakeFiles/unilink_shared.dir/unilink/common/input_validator.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/common/input_validator.cc.o.d"
+  "/root/repo/unilink/common/io_context_manager.cc" "CMakeFiles/unilink_shared.dir/unilink/common/io_context_manager.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/common/io_context_manager.cc.o.d"
+  "/root/repo/unilink/common/io_context_pool.cc" "CMakeFiles/unilink_shared.dir/unilink/common/io_context_pool.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/common/io_context_pool.cc.o.d"
+  "/root/repo/unilink/common/log_rotation.cc" "CMakeFiles/unilink_shared.dir/unilink/common/log_rotation.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/common/log_rotation.cc.o.d"
+  "/root/repo/unilink/common/logger.cc" "CMakeFiles/unilink_shared.dir/unilink/common/logger.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/common/logger.cc.o.d"
+  "/root/repo/unilink/common/loop_monitor.cc" "CMakeFiles/unilink_shared.dir/unilink/common/loop_monitor.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/common/loop_monitor.cc.o.d"
+  "/root/repo/unilink/common/memory_pool.cc" "CMakeFiles/unilink_shared.dir/unilink/common/memory_pool.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/common/memory_pool.cc.o.d"
+  "/root/repo/unilink/common/memory_tracker.cc" "CMakeFiles/unilink_shared.dir/unilink/common/memory_tracker.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/common/memory_tracker.cc.o.d"
+  "/root/repo/unilink/common/safe_data_buffer.cc" "CMakeFiles/unilink_shared.dir/unilink/common/safe_data_buffer.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/common/safe_data_buffer.cc.o.d"
+  "/root/repo/unilink/config/config_binder.cc" "CMakeFiles/unilink_shared.dir/unilink/config/config_binder.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/config/config_binder.cc.o.d"
+  "/root/repo/unilink/config/config_factory.cc" "CMakeFiles/unilink_shared.dir/unilink/config/config_factory.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/config/config_factory.cc.o.d"
+  "/root/repo/unilink/config/config_manager.cc" "CMakeFiles/unilink_shared.dir/unilink/config/config_manager.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/config/config_manager.cc.o.d"
+  "/root/repo/unilink/factory/channel_factory.cc" "CMakeFiles/unilink_shared.dir/unilink/factory/channel_factory.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/factory/channel_factory.cc.o.d"
+  "/root/repo/unilink/factory/channel_provisioner.cc" "CMakeFiles/unilink_shared.dir/unilink/factory/channel_provisioner.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/factory/channel_provisioner.cc.o.d"
+  "/root/repo/unilink/transport/serial/serial.cc" "CMakeFiles/unilink_shared.dir/unilink/transport/serial/serial.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/transport/serial/serial.cc.o.d"
+  "/root/repo/unilink/transport/tcp_client/tcp_client.cc" "CMakeFiles/unilink_shared.dir/unilink/transport/tcp_client/tcp_client.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/transport/tcp_client/tcp_client.cc.o.d"
+  "/root/repo/unilink/transport/tcp_server/boost_tcp_acceptor.cc" "CMakeFiles/unilink_shared.dir/unilink/transport/tcp_server/boost_tcp_acceptor.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/transport/tcp_server/boost_tcp_acceptor.cc.o.d"
+  "/root/repo/unilink/transport/tcp_server/boost_tcp_socket.cc" "CMakeFiles/unilink_shared.dir/unilink/transport/tcp_server/boost_tcp_socket.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/transport/tcp_server/boost_tcp_socket.cc.o.d"
+  "/root/repo/unilink/transport/tcp_server/tcp_server.cc" "CMakeFiles/unilink_shared.dir/unilink/transport/tcp_server/tcp_server.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/transport/tcp_server/tcp_server.cc.o.d"
+  "/root/repo/unilink/transport/tcp_server/tcp_server_session.cc" "CMakeFiles/unilink_shared.dir/unilink/transport/tcp_server/tcp_server_session.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/transport/tcp_server/tcp_server_session.cc.o.d"
+  "/root/repo/unilink/transport/tcp_server/topic_router.cc" "CMakeFiles/unilink_shared.dir/unilink/transport/tcp_server/topic_router.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/transport/tcp_server/topic_router.cc.o.d"
+  "/root/repo/unilink/wrapper/request/request_channel.cc" "CMakeFiles/unilink_shared.dir/unilink/wrapper/request/request_channel.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/wrapper/request/request_channel.cc.o.d"
+  "/root/repo/unilink/wrapper/serial/serial.cc" "CMakeFiles/unilink_shared.dir/unilink/wrapper/serial/serial.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/wrapper/serial/serial.cc.o.d"
+  "/root/repo/unilink/wrapper/tcp_client/tcp_client.cc" "CMakeFiles/unilink_shared.dir/unilink/wrapper/tcp_client/tcp_client.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/wrapper/tcp_client/tcp_client.cc.o.d"
+  "/root/repo/unilink/wrapper/tcp_server/tcp_server.cc" "CMakeFiles/unilink_shared.dir/unilink/wrapper/tcp_server/tcp_server.cc.o" "gcc" "CMakeFiles/unilink_shared.dir/unilink/wrapper/tcp_server/tcp_server.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_perf_build/libunilink.so" "/root/repo/_perf_build/libunilink.so.0.1.0"
+  "/root/repo/_perf_build/libunilink.so.0" "/root/repo/_perf_build/libunilink.so.0.1.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
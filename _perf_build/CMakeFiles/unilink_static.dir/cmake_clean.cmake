@@ -0,0 +1,79 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unilink_static.dir/unilink/builder/auto_initializer.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/builder/auto_initializer.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/builder/serial_builder.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/builder/serial_builder.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/builder/tcp_client_builder.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/builder/tcp_client_builder.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/builder/tcp_server_builder.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/builder/tcp_server_builder.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/builder/unified_builder.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/builder/unified_builder.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/common/async_tracer.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/common/async_tracer.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/common/binary_log.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/common/binary_log.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/common/channel_metrics.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/common/channel_metrics.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/common/component_registry.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/common/component_registry.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/common/error_handler.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/common/error_handler.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/common/input_validator.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/common/input_validator.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/common/io_context_manager.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/common/io_context_manager.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/common/io_context_pool.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/common/io_context_pool.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/common/log_rotation.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/common/log_rotation.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/common/logger.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/common/logger.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/common/loop_monitor.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/common/loop_monitor.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/common/memory_pool.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/common/memory_pool.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/common/memory_tracker.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/common/memory_tracker.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/common/safe_data_buffer.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/common/safe_data_buffer.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/config/config_binder.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/config/config_binder.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/config/config_factory.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/config/config_factory.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/config/config_manager.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/config/config_manager.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/factory/channel_factory.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/factory/channel_factory.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/factory/channel_provisioner.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/factory/channel_provisioner.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/transport/serial/serial.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/transport/serial/serial.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/transport/tcp_client/tcp_client.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/transport/tcp_client/tcp_client.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/transport/tcp_server/boost_tcp_acceptor.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/transport/tcp_server/boost_tcp_acceptor.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/transport/tcp_server/boost_tcp_socket.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/transport/tcp_server/boost_tcp_socket.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/transport/tcp_server/tcp_server.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/transport/tcp_server/tcp_server.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/transport/tcp_server/tcp_server_session.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/transport/tcp_server/tcp_server_session.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/transport/tcp_server/topic_router.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/transport/tcp_server/topic_router.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/wrapper/request/request_channel.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/wrapper/request/request_channel.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/wrapper/serial/serial.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/wrapper/serial/serial.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/wrapper/tcp_client/tcp_client.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/wrapper/tcp_client/tcp_client.cc.o.d"
+  "CMakeFiles/unilink_static.dir/unilink/wrapper/tcp_server/tcp_server.cc.o"
+  "CMakeFiles/unilink_static.dir/unilink/wrapper/tcp_server/tcp_server.cc.o.d"
+  "libunilink_static.a"
+  "libunilink_static.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unilink_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,109 @@
+# This file will be configured to contain variables for CPack. These variables
+# should be set in the CMake list file of the project before CPack module is
+# included. The list of available CPACK_xxx variables and their associated
+# documentation may be obtained using
+#  cpack --help-variable-list
+#
+# Some variables are common to all generators (e.g. CPACK_PACKAGE_NAME)
+# and some are specific to a generator
+# (e.g. CPACK_NSIS_EXTRA_INSTALL_COMMANDS). The generator specific variables
+# usually begin with CPACK_<GENNAME>_xxxx.
+
+
+set(CPACK_BUILD_SOURCE_DIRS "/root/repo;/root/repo/_perf_build")
+set(CPACK_CMAKE_GENERATOR "Unix Makefiles")
+set(CPACK_COMPONENTS_ALL "libraries;headers;cmake;pkgconfig;documentation;examples")
+set(CPACK_COMPONENTS_ALL_SET_BY_USER "TRUE")
+set(CPACK_COMPONENT_CMAKE_DESCRIPTION "CMake configuration files for find_package")
+set(CPACK_COMPONENT_CMAKE_DISPLAY_NAME "CMake Files")
+set(CPACK_COMPONENT_CMAKE_REQUIRED "TRUE")
+set(CPACK_COMPONENT_DOCUMENTATION_DEPENDS "headers")
+set(CPACK_COMPONENT_DOCUMENTATION_DESCRIPTION "API documentation and user guides")
+set(CPACK_COMPONENT_DOCUMENTATION_DISPLAY_NAME "Documentation")
+set(CPACK_COMPONENT_EXAMPLES_DEPENDS "libraries;headers")
+set(CPACK_COMPONENT_EXAMPLES_DESCRIPTION "Example programs and tutorials")
+set(CPACK_COMPONENT_EXAMPLES_DISPLAY_NAME "Examples")
+set(CPACK_COMPONENT_HEADERS_DESCRIPTION "Unilink C++ header files")
+set(CPACK_COMPONENT_HEADERS_DISPLAY_NAME "Header Files")
+set(CPACK_COMPONENT_HEADERS_REQUIRED "TRUE")
+set(CPACK_COMPONENT_LIBRARIES_DESCRIPTION "Unilink shared and static libraries")
+set(CPACK_COMPONENT_LIBRARIES_DISPLAY_NAME "Libraries")
+set(CPACK_COMPONENT_LIBRARIES_REQUIRED "TRUE")
+set(CPACK_COMPONENT_PKGCONFIG_DEPENDS "libraries")
+set(CPACK_COMPONENT_PKGCONFIG_DESCRIPTION "pkg-config configuration files")
+set(CPACK_COMPONENT_PKGCONFIG_DISPLAY_NAME "pkg-config Files")
+set(CPACK_COMPONENT_UNSPECIFIED_HIDDEN "TRUE")
+set(CPACK_COMPONENT_UNSPECIFIED_REQUIRED "TRUE")
+set(CPACK_DEBIAN_PACKAGE_ARCHITECTURE "amd64")
+set(CPACK_DEBIAN_PACKAGE_DEPENDS "libboost-system1.70.0 | libboost-system1.74.0 | libboost-system1.83.0")
+set(CPACK_DEBIAN_PACKAGE_MAINTAINER "Jinwoo Sung <jwsung91@example.com>")
+set(CPACK_DEBIAN_PACKAGE_PRIORITY "optional")
+set(CPACK_DEBIAN_PACKAGE_RECOMMENDS "libc6-dev")
+set(CPACK_DEBIAN_PACKAGE_SECTION "libs")
+set(CPACK_DEBIAN_PACKAGE_SUGGESTS "cmake, pkg-config")
+set(CPACK_DEFAULT_PACKAGE_DESCRIPTION_FILE "/usr/share/cmake-3.25/Templates/CPack.GenericDescription.txt")
+set(CPACK_DEFAULT_PACKAGE_DESCRIPTION_SUMMARY "unilink built using CMake")
+set(CPACK_DMG_SLA_USE_RESOURCE_FILE_LICENSE "ON")
+set(CPACK_GENERATOR "TGZ;ZIP")
+set(CPACK_IGNORE_FILES "/build/;/.git/;/.gitignore;/.vscode/;/.idea/;*.swp;*.swo;*~;/docs/html/;/Testing/;/test/;/examples/;CMakeCache.txt;CMakeFiles/;Makefile;cmake_install.cmake;install_manifest.txt;CTestTestfile.cmake;_CPack_Packages/;CPackConfig.cmake;CPackSourceConfig.cmake")
+set(CPACK_INSTALLED_DIRECTORIES "/root/repo;/")
+set(CPACK_INSTALL_CMAKE_PROJECTS "")
+set(CPACK_INSTALL_PREFIX "/usr/local")
+set(CPACK_MODULE_PATH "")
+set(CPACK_NSIS_DISPLAY_NAME "unilink 0.1.0")
+set(CPACK_NSIS_INSTALLER_ICON_CODE "")
+set(CPACK_NSIS_INSTALLER_MUI_ICON_CODE "")
+set(CPACK_NSIS_INSTALL_ROOT "$PROGRAMFILES")
+set(CPACK_NSIS_PACKAGE_NAME "unilink 0.1.0")
+set(CPACK_NSIS_UNINSTALL_NAME "Uninstall")
+set(CPACK_OBJCOPY_EXECUTABLE "/usr/bin/objcopy")
+set(CPACK_OBJDUMP_EXECUTABLE "/usr/bin/objdump")
+set(CPACK_OUTPUT_CONFIG_FILE "/root/repo/_perf_build/CPackConfig.cmake")
+set(CPACK_PACKAGE_CONTACT "jwsung91@example.com")
+set(CPACK_PACKAGE_DEFAULT_LOCATION "/")
+set(CPACK_PACKAGE_DESCRIPTION "A modern C++ library for unified async communication across TCP, Serial, and other protocols")
+set(CPACK_PACKAGE_DESCRIPTION_FILE "/usr/share/cmake-3.25/Templates/CPack.GenericDescription.txt")
+set(CPACK_PACKAGE_DESCRIPTION_SUMMARY "Unified async communication library")
+set(CPACK_PACKAGE_FILE_NAME "unilink-0.1.0-source")
+set(CPACK_PACKAGE_HOMEPAGE_URL "https://github.com/jwsung91/unilink")
+set(CPACK_PACKAGE_INSTALL_DIRECTORY "unilink 0.1.0")
+set(CPACK_PACKAGE_INSTALL_REGISTRY_KEY "unilink 0.1.0")
+set(CPACK_PACKAGE_NAME "unilink")
+set(CPACK_PACKAGE_RELOCATABLE "true")
+set(CPACK_PACKAGE_VENDOR "Jinwoo Sung")
+set(CPACK_PACKAGE_VERSION "0.1.0")
+set(CPACK_PACKAGE_VERSION_MAJOR "0")
+set(CPACK_PACKAGE_VERSION_MINOR "1")
+set(CPACK_PACKAGE_VERSION_PATCH "0")
+set(CPACK_READELF_EXECUTABLE "/usr/bin/readelf")
+set(CPACK_RESOURCE_FILE_LICENSE "/root/repo/LICENSE")
+set(CPACK_RESOURCE_FILE_README "/root/repo/README.md")
+set(CPACK_RESOURCE_FILE_WELCOME "/root/repo/README.md")
+set(CPACK_RPM_PACKAGE_ARCHITECTURE "x86_64")
+set(CPACK_RPM_PACKAGE_GROUP "Development/Libraries")
+set(CPACK_RPM_PACKAGE_LICENSE "Apache-2.0")
+set(CPACK_RPM_PACKAGE_RECOMMENDS "glibc-devel")
+set(CPACK_RPM_PACKAGE_REQUIRES "boost-system >= 1.70.0")
+set(CPACK_RPM_PACKAGE_SOURCES "ON")
+set(CPACK_RPM_PACKAGE_SUGGESTS "cmake, pkg-config")
+set(CPACK_RPM_PACKAGE_URL "https://github.com/jwsung91/unilink")
+set(CPACK_SET_DESTDIR "OFF")
+set(CPACK_SOURCE_GENERATOR "TGZ;ZIP")
+set(CPACK_SOURCE_IGNORE_FILES "/build/;/.git/;/.gitignore;/.vscode/;/.idea/;*.swp;*.swo;*~;/docs/html/;/Testing/;/test/;/examples/;CMakeCache.txt;CMakeFiles/;Makefile;cmake_install.cmake;install_manifest.txt;CTestTestfile.cmake;_CPack_Packages/;CPackConfig.cmake;CPackSourceConfig.cmake")
+set(CPACK_SOURCE_INSTALLED_DIRECTORIES "/root/repo;/")
+set(CPACK_SOURCE_OUTPUT_CONFIG_FILE "/root/repo/_perf_build/CPackSourceConfig.cmake")
+set(CPACK_SOURCE_PACKAGE_FILE_NAME "unilink-0.1.0-source")
+set(CPACK_SOURCE_TOPLEVEL_TAG "Linux-Source")
+set(CPACK_STRIP_FILES "")
+set(CPACK_SYSTEM_NAME "Linux")
+set(CPACK_THREADS "1")
+set(CPACK_TOPLEVEL_TAG "Linux-Source")
+set(CPACK_WIX_SIZEOF_VOID_P "8")
+
+if(NOT CPACK_PROPERTIES_FILE)
+  set(CPACK_PROPERTIES_FILE "/root/repo/_perf_build/CPackProperties.cmake")
+endif()
+
+if(EXISTS ${CPACK_PROPERTIES_FILE})
+  include(${CPACK_PROPERTIES_FILE})
+endif()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_e2e_test_architecture.dir/scenarios/test_architecture.cc.o"
+  "CMakeFiles/run_e2e_test_architecture.dir/scenarios/test_architecture.cc.o.d"
+  "run_e2e_test_architecture"
+  "run_e2e_test_architecture.pdb"
+  "run_e2e_test_architecture[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_e2e_test_architecture.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_e2e_test_error_recovery.dir/scenarios/test_error_recovery.cc.o"
+  "CMakeFiles/run_e2e_test_error_recovery.dir/scenarios/test_error_recovery.cc.o.d"
+  "run_e2e_test_error_recovery"
+  "run_e2e_test_error_recovery.pdb"
+  "run_e2e_test_error_recovery[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_e2e_test_error_recovery.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_e2e_test_stress.dir/stress/test_stress.cc.o"
+  "CMakeFiles/run_e2e_test_stress.dir/stress/test_stress.cc.o.d"
+  "run_e2e_test_stress"
+  "run_e2e_test_stress.pdb"
+  "run_e2e_test_stress[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_e2e_test_stress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
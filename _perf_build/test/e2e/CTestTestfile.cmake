@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/e2e
+# Build directory: /root/repo/_perf_build/test/e2e
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_perf_build/test/e2e/run_e2e_test_architecture[1]_include.cmake")
+include("/root/repo/_perf_build/test/e2e/run_e2e_test_error_recovery[1]_include.cmake")
+include("/root/repo/_perf_build/test/e2e/run_e2e_test_stress[1]_include.cmake")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/test/e2e/run_e2e_test_architecture[1]_tests.cmake")
+  include("/root/repo/_perf_build/test/e2e/run_e2e_test_architecture[1]_tests.cmake")
+else()
+  add_test(run_e2e_test_architecture_NOT_BUILT run_e2e_test_architecture_NOT_BUILT)
+endif()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_integration_test_builder_integration.dir/test_builder_integration.cc.o"
+  "CMakeFiles/run_integration_test_builder_integration.dir/test_builder_integration.cc.o.d"
+  "run_integration_test_builder_integration"
+  "run_integration_test_builder_integration.pdb"
+  "run_integration_test_builder_integration[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_integration_test_builder_integration.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_integration_test_core_integrated.dir/test_core_integrated.cc.o"
+  "CMakeFiles/run_integration_test_core_integrated.dir/test_core_integrated.cc.o.d"
+  "run_integration_test_core_integrated"
+  "run_integration_test_core_integrated.pdb"
+  "run_integration_test_core_integrated[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_integration_test_core_integrated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
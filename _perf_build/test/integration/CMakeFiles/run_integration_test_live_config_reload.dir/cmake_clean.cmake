@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_integration_test_live_config_reload.dir/tcp/test_live_config_reload.cc.o"
+  "CMakeFiles/run_integration_test_live_config_reload.dir/tcp/test_live_config_reload.cc.o.d"
+  "run_integration_test_live_config_reload"
+  "run_integration_test_live_config_reload.pdb"
+  "run_integration_test_live_config_reload[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_integration_test_live_config_reload.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_integration_test_safety_integrated.dir/test_safety_integrated.cc.o"
+  "CMakeFiles/run_integration_test_safety_integrated.dir/test_safety_integrated.cc.o.d"
+  "run_integration_test_safety_integrated"
+  "run_integration_test_safety_integrated.pdb"
+  "run_integration_test_safety_integrated[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_integration_test_safety_integrated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
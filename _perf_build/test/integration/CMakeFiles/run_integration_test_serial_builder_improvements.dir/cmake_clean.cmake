@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_integration_test_serial_builder_improvements.dir/serial/test_serial_builder_improvements.cc.o"
+  "CMakeFiles/run_integration_test_serial_builder_improvements.dir/serial/test_serial_builder_improvements.cc.o.d"
+  "run_integration_test_serial_builder_improvements"
+  "run_integration_test_serial_builder_improvements.pdb"
+  "run_integration_test_serial_builder_improvements[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_integration_test_serial_builder_improvements.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
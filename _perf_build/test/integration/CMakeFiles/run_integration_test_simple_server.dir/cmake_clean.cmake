@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_integration_test_simple_server.dir/tcp/test_simple_server.cc.o"
+  "CMakeFiles/run_integration_test_simple_server.dir/tcp/test_simple_server.cc.o.d"
+  "run_integration_test_simple_server"
+  "run_integration_test_simple_server.pdb"
+  "run_integration_test_simple_server[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_integration_test_simple_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
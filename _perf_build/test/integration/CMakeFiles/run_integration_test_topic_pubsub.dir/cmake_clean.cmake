@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_integration_test_topic_pubsub.dir/tcp/test_topic_pubsub.cc.o"
+  "CMakeFiles/run_integration_test_topic_pubsub.dir/tcp/test_topic_pubsub.cc.o.d"
+  "run_integration_test_topic_pubsub"
+  "run_integration_test_topic_pubsub.pdb"
+  "run_integration_test_topic_pubsub[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_integration_test_topic_pubsub.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
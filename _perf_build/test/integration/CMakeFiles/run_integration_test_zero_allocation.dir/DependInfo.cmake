@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/utils/allocation_counter.cc" "test/integration/CMakeFiles/run_integration_test_zero_allocation.dir/__/utils/allocation_counter.cc.o" "gcc" "test/integration/CMakeFiles/run_integration_test_zero_allocation.dir/__/utils/allocation_counter.cc.o.d"
+  "/root/repo/test/integration/test_zero_allocation.cc" "test/integration/CMakeFiles/run_integration_test_zero_allocation.dir/test_zero_allocation.cc.o" "gcc" "test/integration/CMakeFiles/run_integration_test_zero_allocation.dir/test_zero_allocation.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/CMakeFiles/unilink_static.dir/DependInfo.cmake"
+  "/root/repo/_perf_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_perf_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_integration_test_zero_allocation.dir/__/utils/allocation_counter.cc.o"
+  "CMakeFiles/run_integration_test_zero_allocation.dir/__/utils/allocation_counter.cc.o.d"
+  "CMakeFiles/run_integration_test_zero_allocation.dir/test_zero_allocation.cc.o"
+  "CMakeFiles/run_integration_test_zero_allocation.dir/test_zero_allocation.cc.o.d"
+  "run_integration_test_zero_allocation"
+  "run_integration_test_zero_allocation.pdb"
+  "run_integration_test_zero_allocation[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_integration_test_zero_allocation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/integration
+# Build directory: /root/repo/_perf_build/test/integration
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_perf_build/test/integration/run_integration_test_integration[1]_include.cmake")
+include("/root/repo/_perf_build/test/integration/run_integration_test_simple_server[1]_include.cmake")
+include("/root/repo/_perf_build/test/integration/run_integration_test_client_limit_integration[1]_include.cmake")
+include("/root/repo/_perf_build/test/integration/run_integration_test_live_config_reload[1]_include.cmake")
+include("/root/repo/_perf_build/test/integration/run_integration_test_topic_pubsub[1]_include.cmake")
+include("/root/repo/_perf_build/test/integration/run_integration_test_serial_builder_improvements[1]_include.cmake")
+include("/root/repo/_perf_build/test/integration/run_integration_test_zero_allocation[1]_include.cmake")
+include("/root/repo/_perf_build/test/integration/run_integration_test_builder_integration[1]_include.cmake")
+include("/root/repo/_perf_build/test/integration/run_integration_test_stable_integration[1]_include.cmake")
+include("/root/repo/_perf_build/test/integration/run_integration_test_core_integrated[1]_include.cmake")
+include("/root/repo/_perf_build/test/integration/run_integration_test_safety_integrated[1]_include.cmake")
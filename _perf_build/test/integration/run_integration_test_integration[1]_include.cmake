@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/test/integration/run_integration_test_integration[1]_tests.cmake")
+  include("/root/repo/_perf_build/test/integration/run_integration_test_integration[1]_tests.cmake")
+else()
+  add_test(run_integration_test_integration_NOT_BUILT run_integration_test_integration_NOT_BUILT)
+endif()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/microbench/bench_common.cc" "test/microbench/CMakeFiles/unilink_microbench.dir/bench_common.cc.o" "gcc" "test/microbench/CMakeFiles/unilink_microbench.dir/bench_common.cc.o.d"
+  "/root/repo/test/microbench/bench_logger.cc" "test/microbench/CMakeFiles/unilink_microbench.dir/bench_logger.cc.o" "gcc" "test/microbench/CMakeFiles/unilink_microbench.dir/bench_logger.cc.o.d"
+  "/root/repo/test/microbench/bench_memory_pool.cc" "test/microbench/CMakeFiles/unilink_microbench.dir/bench_memory_pool.cc.o" "gcc" "test/microbench/CMakeFiles/unilink_microbench.dir/bench_memory_pool.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/CMakeFiles/unilink_shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unilink_microbench.dir/bench_common.cc.o"
+  "CMakeFiles/unilink_microbench.dir/bench_common.cc.o.d"
+  "CMakeFiles/unilink_microbench.dir/bench_logger.cc.o"
+  "CMakeFiles/unilink_microbench.dir/bench_logger.cc.o.d"
+  "CMakeFiles/unilink_microbench.dir/bench_memory_pool.cc.o"
+  "CMakeFiles/unilink_microbench.dir/bench_memory_pool.cc.o.d"
+  "unilink_microbench"
+  "unilink_microbench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unilink_microbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
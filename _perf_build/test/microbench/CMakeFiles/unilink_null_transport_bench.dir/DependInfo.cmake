@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/utils/allocation_counter.cc" "test/microbench/CMakeFiles/unilink_null_transport_bench.dir/__/utils/allocation_counter.cc.o" "gcc" "test/microbench/CMakeFiles/unilink_null_transport_bench.dir/__/utils/allocation_counter.cc.o.d"
+  "/root/repo/test/microbench/null_transport_bench.cc" "test/microbench/CMakeFiles/unilink_null_transport_bench.dir/null_transport_bench.cc.o" "gcc" "test/microbench/CMakeFiles/unilink_null_transport_bench.dir/null_transport_bench.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/CMakeFiles/unilink_shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
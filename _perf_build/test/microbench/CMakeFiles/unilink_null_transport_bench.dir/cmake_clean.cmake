@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unilink_null_transport_bench.dir/__/utils/allocation_counter.cc.o"
+  "CMakeFiles/unilink_null_transport_bench.dir/__/utils/allocation_counter.cc.o.d"
+  "CMakeFiles/unilink_null_transport_bench.dir/null_transport_bench.cc.o"
+  "CMakeFiles/unilink_null_transport_bench.dir/null_transport_bench.cc.o.d"
+  "unilink_null_transport_bench"
+  "unilink_null_transport_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unilink_null_transport_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_performance_test_benchmark.dir/benchmark/test_benchmark.cc.o"
+  "CMakeFiles/run_performance_test_benchmark.dir/benchmark/test_benchmark.cc.o.d"
+  "run_performance_test_benchmark"
+  "run_performance_test_benchmark.pdb"
+  "run_performance_test_benchmark[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_performance_test_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_performance_test_platform.dir/benchmark/test_platform.cc.o"
+  "CMakeFiles/run_performance_test_platform.dir/benchmark/test_platform.cc.o.d"
+  "run_performance_test_platform"
+  "run_performance_test_platform.pdb"
+  "run_performance_test_platform[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_performance_test_platform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
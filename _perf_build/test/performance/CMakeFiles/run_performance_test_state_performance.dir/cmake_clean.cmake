@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_performance_test_state_performance.dir/benchmark/test_state_performance.cc.o"
+  "CMakeFiles/run_performance_test_state_performance.dir/benchmark/test_state_performance.cc.o.d"
+  "run_performance_test_state_performance"
+  "run_performance_test_state_performance.pdb"
+  "run_performance_test_state_performance[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_performance_test_state_performance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
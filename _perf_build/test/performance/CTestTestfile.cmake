@@ -0,0 +1,17 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/performance
+# Build directory: /root/repo/_perf_build/test/performance
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_perf_build/test/performance/run_performance_test_performance[1]_include.cmake")
+include("/root/repo/_perf_build/test/performance/run_performance_test_benchmark[1]_include.cmake")
+include("/root/repo/_perf_build/test/performance/run_performance_test_transport_performance[1]_include.cmake")
+include("/root/repo/_perf_build/test/performance/run_performance_test_platform[1]_include.cmake")
+include("/root/repo/_perf_build/test/performance/run_performance_test_logging_performance[1]_include.cmake")
+include("/root/repo/_perf_build/test/performance/run_performance_test_state_performance[1]_include.cmake")
+include("/root/repo/_perf_build/test/performance/run_performance_test_memory_tracking_performance[1]_include.cmake")
+include("/root/repo/_perf_build/test/performance/run_performance_test_provisioning_performance[1]_include.cmake")
+include("/root/repo/_perf_build/test/performance/run_performance_test_request_performance[1]_include.cmake")
+include("/root/repo/_perf_build/test/performance/run_performance_test_topic_performance[1]_include.cmake")
+include("/root/repo/_perf_build/test/performance/run_performance_test_coroutine_performance[1]_include.cmake")
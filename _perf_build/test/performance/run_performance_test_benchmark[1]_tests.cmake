@@ -0,0 +1,17 @@
+add_test([=[BenchmarkTest.MemoryPoolAllocationPerformance]=]  /root/repo/_perf_build/test/performance/run_performance_test_benchmark [==[--gtest_filter=BenchmarkTest.MemoryPoolAllocationPerformance]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BenchmarkTest.MemoryPoolAllocationPerformance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[BenchmarkTest.MemoryPoolConcurrentPerformance]=]  /root/repo/_perf_build/test/performance/run_performance_test_benchmark [==[--gtest_filter=BenchmarkTest.MemoryPoolConcurrentPerformance]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BenchmarkTest.MemoryPoolConcurrentPerformance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[BenchmarkTest.MemoryPoolHitRateAnalysis]=]  /root/repo/_perf_build/test/performance/run_performance_test_benchmark [==[--gtest_filter=BenchmarkTest.MemoryPoolHitRateAnalysis]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BenchmarkTest.MemoryPoolHitRateAnalysis]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[BenchmarkTest.NetworkCommunicationThroughput]=]  /root/repo/_perf_build/test/performance/run_performance_test_benchmark [==[--gtest_filter=BenchmarkTest.NetworkCommunicationThroughput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BenchmarkTest.NetworkCommunicationThroughput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[BenchmarkTest.NetworkLatencyBenchmark]=]  /root/repo/_perf_build/test/performance/run_performance_test_benchmark [==[--gtest_filter=BenchmarkTest.NetworkLatencyBenchmark]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BenchmarkTest.NetworkLatencyBenchmark]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[BenchmarkTest.ConcurrentOperationsPerformance]=]  /root/repo/_perf_build/test/performance/run_performance_test_benchmark [==[--gtest_filter=BenchmarkTest.ConcurrentOperationsPerformance]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BenchmarkTest.ConcurrentOperationsPerformance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[BenchmarkTest.MemoryUsageMonitoring]=]  /root/repo/_perf_build/test/performance/run_performance_test_benchmark [==[--gtest_filter=BenchmarkTest.MemoryUsageMonitoring]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BenchmarkTest.MemoryUsageMonitoring]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[BenchmarkTest.PerformanceRegressionDetection]=]  /root/repo/_perf_build/test/performance/run_performance_test_benchmark [==[--gtest_filter=BenchmarkTest.PerformanceRegressionDetection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BenchmarkTest.PerformanceRegressionDetection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+set(  run_performance_test_benchmark_TESTS BenchmarkTest.MemoryPoolAllocationPerformance BenchmarkTest.MemoryPoolConcurrentPerformance BenchmarkTest.MemoryPoolHitRateAnalysis BenchmarkTest.NetworkCommunicationThroughput BenchmarkTest.NetworkLatencyBenchmark BenchmarkTest.ConcurrentOperationsPerformance BenchmarkTest.MemoryUsageMonitoring BenchmarkTest.PerformanceRegressionDetection)
@@ -0,0 +1,3 @@
+add_test([=[CoroutinePerformanceTest.RequestResponseLatencyCallbacksVsCoroutine]=]  /root/repo/_perf_build/test/performance/run_performance_test_coroutine_performance [==[--gtest_filter=CoroutinePerformanceTest.RequestResponseLatencyCallbacksVsCoroutine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CoroutinePerformanceTest.RequestResponseLatencyCallbacksVsCoroutine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+set(  run_performance_test_coroutine_performance_TESTS CoroutinePerformanceTest.RequestResponseLatencyCallbacksVsCoroutine)
@@ -0,0 +1,3 @@
+add_test([=[LoggingPerformanceTest.BinaryVersusTextAsync]=]  /root/repo/_perf_build/test/performance/run_performance_test_logging_performance [==[--gtest_filter=LoggingPerformanceTest.BinaryVersusTextAsync]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LoggingPerformanceTest.BinaryVersusTextAsync]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+set(  run_performance_test_logging_performance_TESTS LoggingPerformanceTest.BinaryVersusTextAsync)
@@ -0,0 +1,3 @@
+add_test([=[MemoryTrackingPerformanceTest.AllocationThroughput]=]  /root/repo/_perf_build/test/performance/run_performance_test_memory_tracking_performance [==[--gtest_filter=MemoryTrackingPerformanceTest.AllocationThroughput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MemoryTrackingPerformanceTest.AllocationThroughput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+set(  run_performance_test_memory_tracking_performance_TESTS MemoryTrackingPerformanceTest.AllocationThroughput)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/test/performance/run_performance_test_performance[1]_tests.cmake")
+  include("/root/repo/_perf_build/test/performance/run_performance_test_performance[1]_tests.cmake")
+else()
+  add_test(run_performance_test_performance_NOT_BUILT run_performance_test_performance_NOT_BUILT)
+endif()
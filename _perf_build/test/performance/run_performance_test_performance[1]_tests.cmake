@@ -0,0 +1,31 @@
+add_test([=[PerformanceIntegratedTest.TransportPerformanceBenchmark]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.TransportPerformanceBenchmark]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.TransportPerformanceBenchmark]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PerformanceIntegratedTest.ConcurrentPerformanceTest]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.ConcurrentPerformanceTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.ConcurrentPerformanceTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PerformanceIntegratedTest.MemoryPoolPerformanceUnderLoad]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.MemoryPoolPerformanceUnderLoad]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.MemoryPoolPerformanceUnderLoad]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PerformanceIntegratedTest.MemoryPoolThroughput]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.MemoryPoolThroughput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.MemoryPoolThroughput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PerformanceIntegratedTest.ScalabilityThreadCount]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.ScalabilityThreadCount]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.ScalabilityThreadCount]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PerformanceIntegratedTest.ScalabilityDataSize]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.ScalabilityDataSize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.ScalabilityDataSize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PerformanceIntegratedTest.NetworkThroughputSimulation]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.NetworkThroughputSimulation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.NetworkThroughputSimulation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PerformanceIntegratedTest.OperationLatency]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.OperationLatency]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.OperationLatency]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PerformanceIntegratedTest.NetworkLatencySimulation]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.NetworkLatencySimulation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.NetworkLatencySimulation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PerformanceIntegratedTest.MemoryUsageUnderLoad]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.MemoryUsageUnderLoad]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.MemoryUsageUnderLoad]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PerformanceIntegratedTest.CPUUsageUnderLoad]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.CPUUsageUnderLoad]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.CPUUsageUnderLoad]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PerformanceIntegratedTest.LockFreePerformance]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.LockFreePerformance]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.LockFreePerformance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PerformanceIntegratedTest.CacheFriendlyPerformance]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.CacheFriendlyPerformance]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.CacheFriendlyPerformance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PerformanceIntegratedTest.SystemStressHighLoad]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.SystemStressHighLoad]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.SystemStressHighLoad]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PerformanceIntegratedTest.MemoryStressLargeAllocations]=]  /root/repo/_perf_build/test/performance/run_performance_test_performance [==[--gtest_filter=PerformanceIntegratedTest.MemoryStressLargeAllocations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PerformanceIntegratedTest.MemoryStressLargeAllocations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+set(  run_performance_test_performance_TESTS PerformanceIntegratedTest.TransportPerformanceBenchmark PerformanceIntegratedTest.ConcurrentPerformanceTest PerformanceIntegratedTest.MemoryPoolPerformanceUnderLoad PerformanceIntegratedTest.MemoryPoolThroughput PerformanceIntegratedTest.ScalabilityThreadCount PerformanceIntegratedTest.ScalabilityDataSize PerformanceIntegratedTest.NetworkThroughputSimulation PerformanceIntegratedTest.OperationLatency PerformanceIntegratedTest.NetworkLatencySimulation PerformanceIntegratedTest.MemoryUsageUnderLoad PerformanceIntegratedTest.CPUUsageUnderLoad PerformanceIntegratedTest.LockFreePerformance PerformanceIntegratedTest.CacheFriendlyPerformance PerformanceIntegratedTest.SystemStressHighLoad PerformanceIntegratedTest.MemoryStressLargeAllocations)
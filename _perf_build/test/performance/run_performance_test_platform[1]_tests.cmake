@@ -0,0 +1,25 @@
+add_test([=[PlatformTest.PlatformDetection]=]  /root/repo/_perf_build/test/performance/run_performance_test_platform [==[--gtest_filter=PlatformTest.PlatformDetection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlatformTest.PlatformDetection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PlatformTest.PlatformSpecificFilePaths]=]  /root/repo/_perf_build/test/performance/run_performance_test_platform [==[--gtest_filter=PlatformTest.PlatformSpecificFilePaths]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlatformTest.PlatformSpecificFilePaths]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PlatformTest.SerialCommunicationPlatformSpecific]=]  /root/repo/_perf_build/test/performance/run_performance_test_platform [==[--gtest_filter=PlatformTest.SerialCommunicationPlatformSpecific]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlatformTest.SerialCommunicationPlatformSpecific]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PlatformTest.SerialBaudRatesPlatformSpecific]=]  /root/repo/_perf_build/test/performance/run_performance_test_platform [==[--gtest_filter=PlatformTest.SerialBaudRatesPlatformSpecific]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlatformTest.SerialBaudRatesPlatformSpecific]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PlatformTest.NetworkFunctionalityPlatformSpecific]=]  /root/repo/_perf_build/test/performance/run_performance_test_platform [==[--gtest_filter=PlatformTest.NetworkFunctionalityPlatformSpecific]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlatformTest.NetworkFunctionalityPlatformSpecific]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PlatformTest.NetworkPortHandlingPlatformSpecific]=]  /root/repo/_perf_build/test/performance/run_performance_test_platform [==[--gtest_filter=PlatformTest.NetworkPortHandlingPlatformSpecific]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlatformTest.NetworkPortHandlingPlatformSpecific]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PlatformTest.MemoryBehaviorPlatformSpecific]=]  /root/repo/_perf_build/test/performance/run_performance_test_platform [==[--gtest_filter=PlatformTest.MemoryBehaviorPlatformSpecific]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlatformTest.MemoryBehaviorPlatformSpecific]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PlatformTest.MemoryAlignmentPlatformSpecific]=]  /root/repo/_perf_build/test/performance/run_performance_test_platform [==[--gtest_filter=PlatformTest.MemoryAlignmentPlatformSpecific]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlatformTest.MemoryAlignmentPlatformSpecific]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PlatformTest.ThreadingBehaviorPlatformSpecific]=]  /root/repo/_perf_build/test/performance/run_performance_test_platform [==[--gtest_filter=PlatformTest.ThreadingBehaviorPlatformSpecific]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlatformTest.ThreadingBehaviorPlatformSpecific]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PlatformTest.PerformanceCharacteristicsPlatformSpecific]=]  /root/repo/_perf_build/test/performance/run_performance_test_platform [==[--gtest_filter=PlatformTest.PerformanceCharacteristicsPlatformSpecific]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlatformTest.PerformanceCharacteristicsPlatformSpecific]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PlatformTest.CrossPlatformCompatibility]=]  /root/repo/_perf_build/test/performance/run_performance_test_platform [==[--gtest_filter=PlatformTest.CrossPlatformCompatibility]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlatformTest.CrossPlatformCompatibility]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[PlatformTest.PlatformSpecificErrorHandling]=]  /root/repo/_perf_build/test/performance/run_performance_test_platform [==[--gtest_filter=PlatformTest.PlatformSpecificErrorHandling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlatformTest.PlatformSpecificErrorHandling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+set(  run_performance_test_platform_TESTS PlatformTest.PlatformDetection PlatformTest.PlatformSpecificFilePaths PlatformTest.SerialCommunicationPlatformSpecific PlatformTest.SerialBaudRatesPlatformSpecific PlatformTest.NetworkFunctionalityPlatformSpecific PlatformTest.NetworkPortHandlingPlatformSpecific PlatformTest.MemoryBehaviorPlatformSpecific PlatformTest.MemoryAlignmentPlatformSpecific PlatformTest.ThreadingBehaviorPlatformSpecific PlatformTest.PerformanceCharacteristicsPlatformSpecific PlatformTest.CrossPlatformCompatibility PlatformTest.PlatformSpecificErrorHandling)
@@ -0,0 +1,3 @@
+add_test([=[ProvisioningPerformanceTest.FleetStartupSequentialVsProvisioner]=]  /root/repo/_perf_build/test/performance/run_performance_test_provisioning_performance [==[--gtest_filter=ProvisioningPerformanceTest.FleetStartupSequentialVsProvisioner]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProvisioningPerformanceTest.FleetStartupSequentialVsProvisioner]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+set(  run_performance_test_provisioning_performance_TESTS ProvisioningPerformanceTest.FleetStartupSequentialVsProvisioner)
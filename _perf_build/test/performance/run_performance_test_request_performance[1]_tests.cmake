@@ -0,0 +1,3 @@
+add_test([=[RequestPerformanceTest.ThroughputScalesWithWindow]=]  /root/repo/_perf_build/test/performance/run_performance_test_request_performance [==[--gtest_filter=RequestPerformanceTest.ThroughputScalesWithWindow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RequestPerformanceTest.ThroughputScalesWithWindow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+set(  run_performance_test_request_performance_TESTS RequestPerformanceTest.ThroughputScalesWithWindow)
@@ -0,0 +1,3 @@
+add_test([=[StatePerformanceTest.IsStateThroughputConcurrentReaders]=]  /root/repo/_perf_build/test/performance/run_performance_test_state_performance [==[--gtest_filter=StatePerformanceTest.IsStateThroughputConcurrentReaders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StatePerformanceTest.IsStateThroughputConcurrentReaders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+set(  run_performance_test_state_performance_TESTS StatePerformanceTest.IsStateThroughputConcurrentReaders)
@@ -0,0 +1,3 @@
+add_test([=[TopicPerformanceTest.PublishLatencyAt10kSubscribers]=]  /root/repo/_perf_build/test/performance/run_performance_test_topic_performance [==[--gtest_filter=TopicPerformanceTest.PublishLatencyAt10kSubscribers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TopicPerformanceTest.PublishLatencyAt10kSubscribers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+set(  run_performance_test_topic_performance_TESTS TopicPerformanceTest.PublishLatencyAt10kSubscribers)
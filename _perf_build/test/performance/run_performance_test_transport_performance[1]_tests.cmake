@@ -0,0 +1,51 @@
+add_test([=[TransportPerformanceTest.TcpClientBackpressureThreshold]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpClientBackpressureThreshold]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpClientBackpressureThreshold]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpServerBackpressureThreshold]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpServerBackpressureThreshold]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpServerBackpressureThreshold]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.SerialBackpressureThreshold]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.SerialBackpressureThreshold]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.SerialBackpressureThreshold]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpClientRetryMechanism]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpClientRetryMechanism]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpClientRetryMechanism]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.SerialRetryMechanism]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.SerialRetryMechanism]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.SerialRetryMechanism]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpClientQueueManagement]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpClientQueueManagement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpClientQueueManagement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpServerQueueManagement]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpServerQueueManagement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpServerQueueManagement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpClientConcurrentAccess]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpClientConcurrentAccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpClientConcurrentAccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpServerConcurrentAccess]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpServerConcurrentAccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpServerConcurrentAccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpClientThroughput]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpClientThroughput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpClientThroughput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpServerThroughput]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpServerThroughput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpServerThroughput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpLoopbackThroughput]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpLoopbackThroughput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpLoopbackThroughput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpLoopbackThroughputWithTxLatency]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpLoopbackThroughputWithTxLatency]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpLoopbackThroughputWithTxLatency]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpClientMemoryLeak]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpClientMemoryLeak]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpClientMemoryLeak]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpServerMemoryLeak]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpServerMemoryLeak]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpServerMemoryLeak]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.BoostTcpAcceptorBasicFunctionality]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.BoostTcpAcceptorBasicFunctionality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.BoostTcpAcceptorBasicFunctionality]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.BoostTcpSocketBasicFunctionality]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.BoostTcpSocketBasicFunctionality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.BoostTcpSocketBasicFunctionality]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpServerSessionBasicFunctionality]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpServerSessionBasicFunctionality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpServerSessionBasicFunctionality]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpServerSessionDataTransmission]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpServerSessionDataTransmission]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpServerSessionDataTransmission]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpServerSessionBackpressure]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpServerSessionBackpressure]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpServerSessionBackpressure]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TcpServerSessionConcurrentAccess]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TcpServerSessionConcurrentAccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TcpServerSessionConcurrentAccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TransportLayerMemoryPoolUsage]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TransportLayerMemoryPoolUsage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TransportLayerMemoryPoolUsage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TransportLayerLargeDataHandling]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TransportLayerLargeDataHandling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TransportLayerLargeDataHandling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TransportLayerConfigurationValidation]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TransportLayerConfigurationValidation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TransportLayerConfigurationValidation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+add_test([=[TransportPerformanceTest.TransportLayerResourceCleanup]=]  /root/repo/_perf_build/test/performance/run_performance_test_transport_performance [==[--gtest_filter=TransportPerformanceTest.TransportLayerResourceCleanup]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TransportPerformanceTest.TransportLayerResourceCleanup]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/test/performance SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] LABELS performance benchmark optional TIMEOUT 180)
+set(  run_performance_test_transport_performance_TESTS TransportPerformanceTest.TcpClientBackpressureThreshold TransportPerformanceTest.TcpServerBackpressureThreshold TransportPerformanceTest.SerialBackpressureThreshold TransportPerformanceTest.TcpClientRetryMechanism TransportPerformanceTest.SerialRetryMechanism TransportPerformanceTest.TcpClientQueueManagement TransportPerformanceTest.TcpServerQueueManagement TransportPerformanceTest.TcpClientConcurrentAccess TransportPerformanceTest.TcpServerConcurrentAccess TransportPerformanceTest.TcpClientThroughput TransportPerformanceTest.TcpServerThroughput TransportPerformanceTest.TcpLoopbackThroughput TransportPerformanceTest.TcpLoopbackThroughputWithTxLatency TransportPerformanceTest.TcpClientMemoryLeak TransportPerformanceTest.TcpServerMemoryLeak TransportPerformanceTest.BoostTcpAcceptorBasicFunctionality TransportPerformanceTest.BoostTcpSocketBasicFunctionality TransportPerformanceTest.TcpServerSessionBasicFunctionality TransportPerformanceTest.TcpServerSessionDataTransmission TransportPerformanceTest.TcpServerSessionBackpressure TransportPerformanceTest.TcpServerSessionConcurrentAccess TransportPerformanceTest.TransportLayerMemoryPoolUsage TransportPerformanceTest.TransportLayerLargeDataHandling TransportPerformanceTest.TransportLayerConfigurationValidation TransportPerformanceTest.TransportLayerResourceCleanup)
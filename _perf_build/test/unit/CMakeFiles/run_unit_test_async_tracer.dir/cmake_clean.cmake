@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_async_tracer.dir/common/test_async_tracer.cc.o"
+  "CMakeFiles/run_unit_test_async_tracer.dir/common/test_async_tracer.cc.o.d"
+  "run_unit_test_async_tracer"
+  "run_unit_test_async_tracer.pdb"
+  "run_unit_test_async_tracer[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_async_tracer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
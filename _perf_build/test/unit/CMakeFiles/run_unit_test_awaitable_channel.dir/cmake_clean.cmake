@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_awaitable_channel.dir/wrapper/test_awaitable_channel.cc.o"
+  "CMakeFiles/run_unit_test_awaitable_channel.dir/wrapper/test_awaitable_channel.cc.o.d"
+  "run_unit_test_awaitable_channel"
+  "run_unit_test_awaitable_channel.pdb"
+  "run_unit_test_awaitable_channel[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_awaitable_channel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_binary_log.dir/common/test_binary_log.cc.o"
+  "CMakeFiles/run_unit_test_binary_log.dir/common/test_binary_log.cc.o.d"
+  "run_unit_test_binary_log"
+  "run_unit_test_binary_log.pdb"
+  "run_unit_test_binary_log[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_binary_log.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
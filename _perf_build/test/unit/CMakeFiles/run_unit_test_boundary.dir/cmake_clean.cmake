@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_boundary.dir/common/test_boundary.cc.o"
+  "CMakeFiles/run_unit_test_boundary.dir/common/test_boundary.cc.o.d"
+  "run_unit_test_boundary"
+  "run_unit_test_boundary.pdb"
+  "run_unit_test_boundary[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_boundary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_builder.dir/builder/test_builder.cc.o"
+  "CMakeFiles/run_unit_test_builder.dir/builder/test_builder.cc.o.d"
+  "run_unit_test_builder"
+  "run_unit_test_builder.pdb"
+  "run_unit_test_builder[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_builder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
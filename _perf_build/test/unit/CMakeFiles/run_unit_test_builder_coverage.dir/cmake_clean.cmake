@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_builder_coverage.dir/builder/test_builder_coverage.cc.o"
+  "CMakeFiles/run_unit_test_builder_coverage.dir/builder/test_builder_coverage.cc.o.d"
+  "run_unit_test_builder_coverage"
+  "run_unit_test_builder_coverage.pdb"
+  "run_unit_test_builder_coverage[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_builder_coverage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_builder_executor.dir/builder/test_builder_executor.cc.o"
+  "CMakeFiles/run_unit_test_builder_executor.dir/builder/test_builder_executor.cc.o.d"
+  "run_unit_test_builder_executor"
+  "run_unit_test_builder_executor.pdb"
+  "run_unit_test_builder_executor[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_builder_executor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
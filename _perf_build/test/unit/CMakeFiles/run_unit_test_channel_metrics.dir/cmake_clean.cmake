@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_channel_metrics.dir/common/test_channel_metrics.cc.o"
+  "CMakeFiles/run_unit_test_channel_metrics.dir/common/test_channel_metrics.cc.o.d"
+  "run_unit_test_channel_metrics"
+  "run_unit_test_channel_metrics.pdb"
+  "run_unit_test_channel_metrics[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_channel_metrics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
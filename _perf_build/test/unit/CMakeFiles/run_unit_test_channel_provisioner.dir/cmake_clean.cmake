@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_channel_provisioner.dir/builder/test_channel_provisioner.cc.o"
+  "CMakeFiles/run_unit_test_channel_provisioner.dir/builder/test_channel_provisioner.cc.o.d"
+  "run_unit_test_channel_provisioner"
+  "run_unit_test_channel_provisioner.pdb"
+  "run_unit_test_channel_provisioner[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_channel_provisioner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_component_registry.dir/common/test_component_registry.cc.o"
+  "CMakeFiles/run_unit_test_component_registry.dir/common/test_component_registry.cc.o.d"
+  "run_unit_test_component_registry"
+  "run_unit_test_component_registry.pdb"
+  "run_unit_test_component_registry[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_component_registry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_config.dir/config/test_config.cc.o"
+  "CMakeFiles/run_unit_test_config.dir/config/test_config.cc.o.d"
+  "run_unit_test_config"
+  "run_unit_test_config.pdb"
+  "run_unit_test_config[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_config.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
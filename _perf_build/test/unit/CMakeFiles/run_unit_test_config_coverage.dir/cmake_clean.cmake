@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_config_coverage.dir/config/test_config_coverage.cc.o"
+  "CMakeFiles/run_unit_test_config_coverage.dir/config/test_config_coverage.cc.o.d"
+  "run_unit_test_config_coverage"
+  "run_unit_test_config_coverage.pdb"
+  "run_unit_test_config_coverage[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_config_coverage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_core.dir/common/test_core.cc.o"
+  "CMakeFiles/run_unit_test_core.dir/common/test_core.cc.o.d"
+  "run_unit_test_core"
+  "run_unit_test_core.pdb"
+  "run_unit_test_core[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
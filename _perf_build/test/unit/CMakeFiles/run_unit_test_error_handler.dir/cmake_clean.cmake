@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_error_handler.dir/common/test_error_handler.cc.o"
+  "CMakeFiles/run_unit_test_error_handler.dir/common/test_error_handler.cc.o.d"
+  "run_unit_test_error_handler"
+  "run_unit_test_error_handler.pdb"
+  "run_unit_test_error_handler[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_error_handler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
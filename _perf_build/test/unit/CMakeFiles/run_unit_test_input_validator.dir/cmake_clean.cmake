@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_input_validator.dir/common/test_input_validator.cc.o"
+  "CMakeFiles/run_unit_test_input_validator.dir/common/test_input_validator.cc.o.d"
+  "run_unit_test_input_validator"
+  "run_unit_test_input_validator.pdb"
+  "run_unit_test_input_validator[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_input_validator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_log_rate_limit.dir/common/test_log_rate_limit.cc.o"
+  "CMakeFiles/run_unit_test_log_rate_limit.dir/common/test_log_rate_limit.cc.o.d"
+  "run_unit_test_log_rate_limit"
+  "run_unit_test_log_rate_limit.pdb"
+  "run_unit_test_log_rate_limit[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_log_rate_limit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
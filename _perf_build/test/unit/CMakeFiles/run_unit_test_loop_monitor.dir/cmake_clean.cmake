@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_loop_monitor.dir/common/test_loop_monitor.cc.o"
+  "CMakeFiles/run_unit_test_loop_monitor.dir/common/test_loop_monitor.cc.o.d"
+  "run_unit_test_loop_monitor"
+  "run_unit_test_loop_monitor.pdb"
+  "run_unit_test_loop_monitor[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_loop_monitor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
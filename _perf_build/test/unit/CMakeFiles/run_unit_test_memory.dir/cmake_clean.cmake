@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_memory.dir/common/test_memory.cc.o"
+  "CMakeFiles/run_unit_test_memory.dir/common/test_memory.cc.o.d"
+  "run_unit_test_memory"
+  "run_unit_test_memory.pdb"
+  "run_unit_test_memory[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
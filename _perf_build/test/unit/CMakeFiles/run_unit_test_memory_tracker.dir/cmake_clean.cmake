@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_memory_tracker.dir/common/test_memory_tracker.cc.o"
+  "CMakeFiles/run_unit_test_memory_tracker.dir/common/test_memory_tracker.cc.o.d"
+  "run_unit_test_memory_tracker"
+  "run_unit_test_memory_tracker.pdb"
+  "run_unit_test_memory_tracker[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_memory_tracker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
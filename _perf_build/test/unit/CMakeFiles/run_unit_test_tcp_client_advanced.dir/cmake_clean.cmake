@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_unit_test_tcp_client_advanced.dir/wrapper/test_tcp_client_advanced.cc.o"
+  "CMakeFiles/run_unit_test_tcp_client_advanced.dir/wrapper/test_tcp_client_advanced.cc.o.d"
+  "run_unit_test_tcp_client_advanced"
+  "run_unit_test_tcp_client_advanced.pdb"
+  "run_unit_test_tcp_client_advanced[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_unit_test_tcp_client_advanced.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/unit
+# Build directory: /root/repo/_perf_build/test/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_perf_build/test/unit/run_unit_test_core[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_memory[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_boundary[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_error_handler[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_input_validator[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_logger_coverage[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_logger_advanced[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_component_registry[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_binary_log[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_log_rate_limit[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_memory_tracker[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_channel_metrics[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_loop_monitor[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_async_tracer[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_builder[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_builder_coverage[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_builder_executor[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_channel_provisioner[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_config[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_config_coverage[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_tcp_server_advanced[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_tcp_client_advanced[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_request_channel[1]_include.cmake")
+include("/root/repo/_perf_build/test/unit/run_unit_test_awaitable_channel[1]_include.cmake")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/test/unit/run_unit_test_builder_executor[1]_tests.cmake")
+  include("/root/repo/_perf_build/test/unit/run_unit_test_builder_executor[1]_tests.cmake")
+else()
+  add_test(run_unit_test_builder_executor_NOT_BUILT run_unit_test_builder_executor_NOT_BUILT)
+endif()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unilink_log_decode.dir/log_decode/unilink_log_decode.cc.o"
+  "CMakeFiles/unilink_log_decode.dir/log_decode/unilink_log_decode.cc.o.d"
+  "unilink_log_decode"
+  "unilink_log_decode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unilink_log_decode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unilink_loopback_bench.dir/loopback_bench/unilink_loopback_bench.cc.o"
+  "CMakeFiles/unilink_loopback_bench.dir/loopback_bench/unilink_loopback_bench.cc.o.d"
+  "unilink_loopback_bench"
+  "unilink_loopback_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unilink_loopback_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
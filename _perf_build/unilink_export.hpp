@@ -0,0 +1,42 @@
+
+#ifndef UNILINK_EXPORT_H
+#define UNILINK_EXPORT_H
+
+#ifdef UNILINK_STATIC_DEFINE
+#  define UNILINK_EXPORT
+#  define UNILINK_NO_EXPORT
+#else
+#  ifndef UNILINK_EXPORT
+#    ifdef unilink_shared_EXPORTS
+        /* We are building this library */
+#      define UNILINK_EXPORT __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define UNILINK_EXPORT __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef UNILINK_NO_EXPORT
+#    define UNILINK_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef UNILINK_DEPRECATED
+#  define UNILINK_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef UNILINK_DEPRECATED_EXPORT
+#  define UNILINK_DEPRECATED_EXPORT UNILINK_EXPORT UNILINK_DEPRECATED
+#endif
+
+#ifndef UNILINK_DEPRECATED_NO_EXPORT
+#  define UNILINK_DEPRECATED_NO_EXPORT UNILINK_NO_EXPORT UNILINK_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef UNILINK_NO_DEPRECATED
+#    define UNILINK_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* UNILINK_EXPORT_H */
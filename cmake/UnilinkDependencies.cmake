@@ -44,6 +44,31 @@ find_package(Threads REQUIRED)
 # Optional dependencies
 find_package(PkgConfig QUIET)
 
+# zlib for compressing rotated log files
+set(UNILINK_HAS_ZLIB OFF)
+if(UNILINK_ENABLE_LOG_COMPRESSION)
+  find_package(ZLIB QUIET)
+  if(ZLIB_FOUND)
+    set(UNILINK_HAS_ZLIB ON)
+    message(STATUS "zlib found: rotated logs can be compressed")
+  else()
+    message(STATUS "zlib not found: rotated logs will be kept uncompressed")
+  endif()
+endif()
+
+# systemtap's <sys/sdt.h> for USDT tracepoints (header only)
+set(UNILINK_HAS_SDT OFF)
+if(UNILINK_ENABLE_USDT)
+  include(CheckIncludeFileCXX)
+  check_include_file_cxx(sys/sdt.h UNILINK_SDT_HEADER_FOUND)
+  if(UNILINK_SDT_HEADER_FOUND)
+    set(UNILINK_HAS_SDT ON)
+    message(STATUS "sys/sdt.h found: USDT tracepoints enabled")
+  else()
+    message(STATUS "sys/sdt.h not found: USDT tracepoints disabled (install systemtap-sdt-dev)")
+  endif()
+endif()
+
 # Google Test for testing
 if(UNILINK_BUILD_TESTS)
   include(FetchContent)
@@ -72,6 +97,18 @@ if(UNILINK_BUILD_TESTS)
   add_library(GTest::gmock_main ALIAS gmock_main)
 endif()
 
+# Google Benchmark for the microbenchmark suite (system package, not fetched)
+set(UNILINK_HAS_BENCHMARK OFF)
+if(UNILINK_BUILD_TESTS AND UNILINK_ENABLE_MICROBENCH)
+  find_package(benchmark QUIET)
+  if(benchmark_FOUND)
+    set(UNILINK_HAS_BENCHMARK ON)
+    message(STATUS "Google Benchmark found: building unilink_microbench")
+  else()
+    message(STATUS "Google Benchmark not found: skipping unilink_microbench (install libbenchmark-dev)")
+  endif()
+endif()
+
 # Doxygen for documentation
 if(UNILINK_BUILD_DOCS)
   find_package(Doxygen QUIET)
@@ -96,6 +133,9 @@ target_link_libraries(unilink_dependencies INTERFACE
   Boost::system
   Threads::Threads
 )
+if(UNILINK_HAS_ZLIB)
+  target_link_libraries(unilink_dependencies INTERFACE ZLIB::ZLIB)
+endif()
 if(WIN32)
   target_link_libraries(unilink_dependencies INTERFACE
     ws2_32
@@ -137,6 +177,18 @@ if(UNILINK_ENABLE_MEMORY_TRACKING)
   target_compile_definitions(unilink_dependencies INTERFACE UNILINK_ENABLE_MEMORY_TRACKING=1)
 endif()
 
+if(UNILINK_ENABLE_METRICS)
+  target_compile_definitions(unilink_dependencies INTERFACE UNILINK_ENABLE_METRICS=1)
+endif()
+
+if(UNILINK_HAS_SDT)
+  target_compile_definitions(unilink_dependencies INTERFACE UNILINK_ENABLE_USDT=1)
+endif()
+
+if(UNILINK_HAS_ZLIB)
+  target_compile_definitions(unilink_dependencies INTERFACE UNILINK_HAS_ZLIB=1)
+endif()
+
 # Export dependencies for downstream projects
 set(UNILINK_DEPENDENCIES
   Boost::system
@@ -5,13 +5,19 @@
 option(UNILINK_BUILD_SHARED "Build shared library" ON)
 option(UNILINK_BUILD_STATIC "Build static library" ON)
 option(UNILINK_BUILD_EXAMPLES "Build examples" ON)
+option(UNILINK_BUILD_TOOLS "Build command-line tools" ON)
 option(UNILINK_BUILD_TESTS "Build tests" ON)
 option(UNILINK_BUILD_DOCS "Build documentation" ON)
 
 # Feature options
 option(UNILINK_ENABLE_CONFIG "Enable configuration management API" ON)
-option(UNILINK_ENABLE_MEMORY_TRACKING "Enable memory tracking for debugging" ON)
+option(UNILINK_ENABLE_MEMORY_TRACKING "Enable the sampling allocation profiler" ON)
+option(UNILINK_ENABLE_METRICS "Record per-channel data-plane metrics" ON)
+option(UNILINK_ENABLE_USDT "Add USDT tracepoints when <sys/sdt.h> is available" ON)
+option(UNILINK_ENABLE_LOG_COMPRESSION "Compress rotated log files with zlib when available" ON)
+option(UNILINK_ENABLE_COROUTINES "Build C++20 coroutine API tests and benchmarks" ON)
 option(UNILINK_ENABLE_PERFORMANCE_TESTS "Enable performance/benchmark tests" OFF)
+option(UNILINK_ENABLE_MICROBENCH "Build the Google Benchmark microbenchmarks when the library is available" ON)
 option(UNILINK_ENABLE_SANITIZERS "Enable sanitizers in Debug builds" OFF)
 
 # Installation options
@@ -69,6 +69,9 @@ class UnilinkConan(ConanFile):
         else:
             # Non-Linux platforms: use latest Boost
             self.requires("boost/1.70.0")
+
+        # zlib for compressing rotated log files
+        self.requires("zlib/1.3.1")
     
     def build_requirements(self):
         if self.options.build_tests:
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <thread>
+
+#include "test_utils.hpp"
+#include "unilink/common/io_context_manager.hpp"
+#include "unilink/config/config_binder.hpp"
+#include "unilink/config/config_manager.hpp"
+#include "unilink/transport/tcp_server/tcp_server.hpp"
+
+using namespace unilink;
+using namespace std::chrono_literals;
+using unilink::test::TestUtils;
+namespace net = boost::asio;
+
+class LiveConfigReloadTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    if (!common::IoContextManager::instance().is_running()) {
+      common::IoContextManager::instance().start();
+    }
+    config_path_ = std::filesystem::temp_directory_path() / ("unilink_live_reload_" + std::to_string(port_) + ".conf");
+  }
+
+  void TearDown() override {
+    if (server_) {
+      server_->stop();
+    }
+    std::filesystem::remove(config_path_);
+    std::this_thread::sleep_for(50ms);
+  }
+
+  // True if the server closes the connection within the timeout
+  static bool closed_by_peer(net::ip::tcp::socket& socket) {
+    auto result = std::async(std::launch::async, [&socket] {
+      char byte;
+      boost::system::error_code ec;
+      socket.read_some(net::buffer(&byte, 1), ec);
+      return ec == net::error::eof || ec == net::error::connection_reset;
+    });
+    if (result.wait_for(2s) != std::future_status::ready) {
+      boost::system::error_code ec;
+      socket.shutdown(net::ip::tcp::socket::shutdown_both, ec);
+      result.wait();
+      return false;
+    }
+    return result.get();
+  }
+
+  void write_config(const std::string& content) {
+    std::ofstream file(config_path_);
+    file << content;
+  }
+
+  uint16_t port_ = TestUtils::getAvailableTestPort();
+  std::filesystem::path config_path_;
+  std::shared_ptr<transport::TcpServer> server_;
+};
+
+/**
+ * @brief Client limit follows a config reload without dropping live connections
+ */
+TEST_F(LiveConfigReloadTest, ClientLimitReloadKeepsConnections) {
+  config::TcpServerConfig cfg;
+  cfg.port = port_;
+  server_ = std::make_shared<transport::TcpServer>(cfg);
+
+  auto manager = std::make_shared<config::ConfigManager>();
+  manager->set("tcp.server.max_connections", 1);
+  manager->set("tcp.server.backpressure_threshold", 1 << 20);
+  config::ConfigBinder binder(manager);
+  binder.bind(server_);
+
+  server_->start();
+  net::io_context ioc;
+  net::ip::tcp::endpoint endpoint(net::ip::make_address("127.0.0.1"), port_);
+
+  net::ip::tcp::socket first(ioc);
+  ASSERT_TRUE(TestUtils::waitForCondition([&] {
+    boost::system::error_code ec;
+    first.connect(endpoint, ec);
+    if (ec) first.close();
+    return !ec;
+  })) << "Server did not start listening";
+  ASSERT_TRUE(TestUtils::waitForCondition([&] { return server_->get_client_count() == 1; }));
+
+  // Limit of one: the second client is accepted and closed immediately
+  net::ip::tcp::socket rejected(ioc);
+  rejected.connect(endpoint);
+  EXPECT_TRUE(closed_by_peer(rejected));
+
+  // Raise the limit through the file; the first connection must survive the reapply
+  write_config("tcp.server.max_connections=0\ntcp.server.backpressure_threshold=65536\n");
+  ASSERT_TRUE(manager->reload_from_file(config_path_.string()));
+  EXPECT_EQ(binder.apply(), 0u);  // Already pushed by the reload listener
+
+  net::ip::tcp::socket second(ioc);
+  second.connect(endpoint);
+  EXPECT_TRUE(TestUtils::waitForCondition([&] { return server_->get_client_count() == 2; }));
+  EXPECT_TRUE(first.is_open());
+
+  // Invalid values are rejected and leave the current setting in place
+  write_config("tcp.server.max_connections=-5\ntcp.server.backpressure_threshold=65536\n");
+  ASSERT_TRUE(manager->reload_from_file(config_path_.string()));
+  net::ip::tcp::socket third(ioc);
+  third.connect(endpoint);
+  EXPECT_TRUE(TestUtils::waitForCondition([&] { return server_->get_client_count() == 3; }));
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <boost/asio.hpp>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test_utils.hpp"
+#include "unilink/common/io_context_manager.hpp"
+#include "unilink/transport/tcp_server/tcp_server.hpp"
+
+using namespace unilink;
+using namespace std::chrono_literals;
+using unilink::test::TestUtils;
+namespace net = boost::asio;
+
+class TopicPubSubTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    if (!common::IoContextManager::instance().is_running()) {
+      common::IoContextManager::instance().start();
+    }
+    config::TcpServerConfig cfg;
+    cfg.port = port_;
+    server_ = std::make_shared<transport::TcpServer>(cfg);
+    server_->start();
+  }
+
+  void TearDown() override {
+    clients_.clear();
+    if (server_) {
+      server_->stop();
+    }
+    std::this_thread::sleep_for(50ms);
+  }
+
+  // Connects clients one at a time so their ids follow connection order
+  void connect_clients(size_t count) {
+    net::ip::tcp::endpoint endpoint(net::ip::make_address("127.0.0.1"), port_);
+    for (size_t i = 0; i < count; ++i) {
+      auto socket = std::make_unique<net::ip::tcp::socket>(ioc_);
+      ASSERT_TRUE(TestUtils::waitForCondition([&] {
+        boost::system::error_code ec;
+        socket->connect(endpoint, ec);
+        if (ec) socket->close();
+        return !ec;
+      })) << "Server did not start listening";
+      clients_.push_back(std::move(socket));
+      ASSERT_TRUE(TestUtils::waitForCondition([&] { return server_->get_client_count() == clients_.size(); }));
+    }
+  }
+
+  // Reads exactly expected.size() bytes, or returns what arrived before the timeout
+  static std::string read_exact(net::ip::tcp::socket& socket, size_t size) {
+    auto result = std::async(std::launch::async, [&socket, size] {
+      std::string data(size, '\0');
+      boost::system::error_code ec;
+      size_t n = net::read(socket, net::buffer(data), ec);
+      data.resize(n);
+      return data;
+    });
+    if (result.wait_for(2s) != std::future_status::ready) {
+      boost::system::error_code ec;
+      socket.shutdown(net::ip::tcp::socket::shutdown_both, ec);
+    }
+    return result.get();
+  }
+
+  uint16_t port_ = TestUtils::getAvailableTestPort();
+  net::io_context ioc_;
+  std::vector<std::unique_ptr<net::ip::tcp::socket>> clients_;
+  std::shared_ptr<transport::TcpServer> server_;
+};
+
+/**
+ * @brief A publish is delivered to the topic's subscribers and nobody else
+ */
+TEST_F(TopicPubSubTest, PublishReachesOnlySubscribers) {
+  connect_clients(3);
+  ASSERT_TRUE(server_->subscribe(0, "news"));
+  ASSERT_TRUE(server_->subscribe(2, "news"));
+  ASSERT_TRUE(server_->subscribe(1, "sports"));
+
+  EXPECT_EQ(server_->publish("news", "headline"), 2u);
+  EXPECT_EQ(read_exact(*clients_[0], 8), "headline");
+  EXPECT_EQ(read_exact(*clients_[2], 8), "headline");
+
+  // Client 1 receives the sports update first, so it never saw the news publish
+  EXPECT_EQ(server_->publish("sports", "score"), 1u);
+  EXPECT_EQ(read_exact(*clients_[1], 5), "score");
+}
+
+/**
+ * @brief Subscriptions are per topic and idempotent
+ */
+TEST_F(TopicPubSubTest, SubscribeAndUnsubscribe) {
+  connect_clients(1);
+  EXPECT_TRUE(server_->subscribe(0, "alerts"));
+  EXPECT_FALSE(server_->subscribe(0, "alerts"));
+  EXPECT_FALSE(server_->subscribe(5, "alerts"));
+  EXPECT_EQ(server_->get_subscriber_count("alerts"), 1u);
+
+  EXPECT_TRUE(server_->unsubscribe(0, "alerts"));
+  EXPECT_FALSE(server_->unsubscribe(0, "alerts"));
+  EXPECT_EQ(server_->get_subscriber_count("alerts"), 0u);
+  EXPECT_EQ(server_->publish("alerts", "nobody"), 0u);
+  EXPECT_EQ(server_->publish("unknown", "nobody"), 0u);
+}
+
+/**
+ * @brief A disconnecting client is removed from every topic it joined
+ */
+TEST_F(TopicPubSubTest, DisconnectDropsSubscriptions) {
+  connect_clients(2);
+  ASSERT_TRUE(server_->subscribe(0, "a"));
+  ASSERT_TRUE(server_->subscribe(0, "b"));
+  ASSERT_TRUE(server_->subscribe(1, "a"));
+
+  clients_[0]->close();
+  EXPECT_TRUE(TestUtils::waitForCondition([&] { return server_->get_subscriber_count("b") == 0; }));
+  EXPECT_EQ(server_->get_subscriber_count("a"), 1u);
+
+  EXPECT_EQ(server_->publish("a", "still here"), 1u);
+  EXPECT_EQ(read_exact(*clients_[1], 10), "still here");
+}
@@ -0,0 +1,230 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <boost/asio.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "allocation_counter.hpp"
+#include "test_utils.hpp"
+#include "unilink/common/logger.hpp"
+#include "unilink/transport/tcp_client/tcp_client.hpp"
+#include "unilink/transport/tcp_server/boost_tcp_acceptor.hpp"
+#include "unilink/transport/tcp_server/tcp_server.hpp"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <atomic>
+
+#include "unilink/transport/serial/boost_serial_port.hpp"
+#include "unilink/transport/serial/serial.hpp"
+#endif
+
+using namespace unilink;
+using namespace std::chrono_literals;
+using test::AllocationCounter;
+using test::ScopedAllocationCount;
+using test::TestUtils;
+namespace net = boost::asio;
+
+/**
+ * @brief Heap allocations per message once a channel has warmed up
+ *
+ * Every channel runs on one io_context driven by the test thread, and the
+ * next message is sent from the receive callback, so the whole send/receive
+ * path is counted by the per-thread allocation counter. When a path
+ * allocates more than its budget, the stacks of the first allocations in
+ * the measured window are printed. Set UNILINK_ALLOC_STACKS=1 to print them
+ * even when the budget holds.
+ *
+ * Budgets are the allocations each path makes today; lower them as the
+ * remaining sources are removed. A path at 0 must stay at 0.
+ */
+class ZeroAllocationTest : public ::testing::Test {
+ protected:
+  static constexpr size_t kMessageSize = 64;
+  static constexpr uint64_t kWarmupMessages = 500;
+  static constexpr uint64_t kMeasuredMessages = 2000;
+
+  // Per message today: write and read operations that miss Asio's one-slot
+  // handler cache, the async_write_copy post, and the std::function that
+  // carries the read handler through the socket/port interface.
+  static constexpr double kTcpEchoBudget = 7;
+  static constexpr double kSerialEchoBudget = 5;
+
+  void SetUp() override { common::Logger::instance().set_level(common::LogLevel::CRITICAL); }
+  void TearDown() override { common::Logger::instance().set_level(common::LogLevel::INFO); }
+
+  bool run_until(const std::function<bool()>& condition, std::chrono::milliseconds timeout = 5000ms) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!condition()) {
+      if (std::chrono::steady_clock::now() >= deadline) return false;
+      ioc_.run_one_for(10ms);
+    }
+    return true;
+  }
+
+  /**
+   * @brief Counts allocations while kMeasuredMessages round trips complete
+   * @return Allocations per message, or -1 if traffic stalled
+   */
+  double measure(const char* path, const uint64_t& round_trips, double budget) {
+    if (!run_until([&] { return round_trips >= kWarmupMessages; })) return -1;
+
+    uint64_t target = round_trips + kMeasuredMessages;
+    AllocationCounter::start_capture();
+    ScopedAllocationCount allocations;
+    bool done = run_until([&] { return round_trips >= target; });
+    uint64_t count = allocations.allocations();
+    AllocationCounter::stop_capture();
+    if (!done) return -1;
+
+    double per_message = static_cast<double>(count) / kMeasuredMessages;
+    std::cout << path << ": " << per_message << " allocations/message (budget " << budget << ")" << std::endl;
+    const char* always = std::getenv("UNILINK_ALLOC_STACKS");
+    if ((per_message > budget || (always && *always == '1')) && count > 0) {
+      std::cerr << path << ": first allocations in the steady-state window:" << std::endl;
+      AllocationCounter::print_captured_stacks(8);
+    }
+    return per_message;
+  }
+
+  uint16_t port_ = TestUtils::getAvailableTestPort();
+  net::io_context ioc_;
+  std::vector<uint8_t> message_ = std::vector<uint8_t>(kMessageSize, 0x5a);
+};
+
+/**
+ * @brief Echo between TcpClient and TcpServer, both counted
+ */
+TEST_F(ZeroAllocationTest, TcpEchoSteadyState) {
+  config::TcpServerConfig server_cfg;
+  server_cfg.port = port_;
+  auto server =
+      std::make_shared<transport::TcpServer>(server_cfg, std::make_unique<transport::BoostTcpAcceptor>(ioc_), ioc_);
+  auto* echo = server.get();
+  server->on_bytes([echo](const uint8_t* data, size_t size) { echo->async_write_copy(data, size); });
+
+  config::TcpClientConfig client_cfg;
+  client_cfg.host = "127.0.0.1";
+  client_cfg.port = port_;
+  client_cfg.retry_interval_ms = 50;
+  auto client = std::make_shared<transport::TcpClient>(client_cfg, ioc_);
+
+  uint64_t round_trips = 0;
+  size_t pending = 0;
+  auto* sender = client.get();
+  client->on_bytes([&, sender](const uint8_t*, size_t size) {
+    pending += size;
+    while (pending >= kMessageSize) {
+      pending -= kMessageSize;
+      ++round_trips;
+      sender->async_write_copy(message_.data(), message_.size());
+    }
+  });
+
+  server->start();
+  client->start();
+  ASSERT_TRUE(run_until([&] { return client->is_connected() && server->get_client_count() == 1; }))
+      << "Client did not connect";
+
+  client->async_write_copy(message_.data(), message_.size());
+  double per_message = measure("tcp echo", round_trips, kTcpEchoBudget);
+  ASSERT_GE(per_message, 0) << "Echo traffic stalled";
+  EXPECT_LE(per_message, kTcpEchoBudget);
+
+  client->stop();
+  server->stop();
+  run_until([] { return false; }, 50ms);
+}
+
+#if defined(__linux__)
+/**
+ * @brief Serial over a pseudo-terminal; the far end echoes on its own thread
+ */
+TEST_F(ZeroAllocationTest, SerialPtyEchoSteadyState) {
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+    if (master >= 0) close(master);
+    GTEST_SKIP() << "Pseudo-terminals are not available";
+  }
+  std::string device = ptsname(master);
+
+  // Echo thread: not the measured thread, so its own work is not counted
+  std::atomic<bool> stop_echo{false};
+  std::thread echo([&] {
+    uint8_t buffer[4096];
+    while (!stop_echo) {
+      pollfd fd{master, POLLIN, 0};
+      if (::poll(&fd, 1, 20) <= 0) continue;
+      ssize_t n = ::read(master, buffer, sizeof(buffer));
+      if (n <= 0) continue;
+      for (ssize_t off = 0; off < n;) {
+        ssize_t w = ::write(master, buffer + off, static_cast<size_t>(n - off));
+        if (w <= 0) break;
+        off += w;
+      }
+    }
+  });
+
+  config::SerialConfig cfg;
+  cfg.device = device;
+  cfg.reopen_on_error = false;
+  auto serial = std::make_shared<transport::Serial>(cfg, std::make_unique<transport::BoostSerialPort>(ioc_), ioc_);
+
+  uint64_t round_trips = 0;
+  size_t pending = 0;
+  auto* sender = serial.get();
+  serial->on_bytes([&, sender](const uint8_t*, size_t size) {
+    pending += size;
+    while (pending >= kMessageSize) {
+      pending -= kMessageSize;
+      ++round_trips;
+      sender->async_write_copy(message_.data(), message_.size());
+    }
+  });
+
+  serial->start();
+  bool opened = run_until([&] { return serial->is_connected(); });
+  double per_message = -1;
+  if (opened) {
+    serial->async_write_copy(message_.data(), message_.size());
+    per_message = measure("serial pty echo", round_trips, kSerialEchoBudget);
+  }
+
+  serial->stop();
+  run_until([] { return false; }, 50ms);
+  stop_echo = true;
+  echo.join();
+  close(master);
+
+  ASSERT_TRUE(opened) << "Serial did not open " << device;
+  ASSERT_GE(per_message, 0) << "Echo traffic stalled";
+  EXPECT_LE(per_message, kSerialEchoBudget);
+}
+#endif
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "unilink/common/common.hpp"
+#include "unilink/common/safe_data_buffer.hpp"
+#include "unilink/common/thread_safe_state.hpp"
+
+using unilink::common::ConstByteSpan;
+using unilink::common::LinkState;
+using unilink::common::SafeDataBuffer;
+using unilink::common::ThreadSafeState;
+
+// ============================================================================
+// ThreadSafeState
+// ============================================================================
+
+/**
+ * @brief Concurrent reads of an enum state (lock-free specialization)
+ */
+static void BM_ThreadSafeStateEnumRead(benchmark::State& state) {
+  static ThreadSafeState<LinkState> link_state(LinkState::Connected);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(link_state.get_state());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ThreadSafeStateEnumRead)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief Concurrent reads of a non-enum state (shared-mutex path)
+ */
+static void BM_ThreadSafeStateStringRead(benchmark::State& state) {
+  static ThreadSafeState<std::string> text_state(std::string("connected"));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(text_state.get_state());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ThreadSafeStateStringRead)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * @brief is_state() checks, the form used on transport hot paths
+ */
+static void BM_ThreadSafeStateIsState(benchmark::State& state) {
+  static ThreadSafeState<LinkState> link_state(LinkState::Connected);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(link_state.is_state(LinkState::Connected));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ThreadSafeStateIsState)->ThreadRange(1, 8)->UseRealTime();
+
+// ============================================================================
+// safe_convert
+// ============================================================================
+
+static void BM_SafeConvertBytesToString(benchmark::State& state) {
+  const std::vector<uint8_t> bytes(static_cast<size_t>(state.range(0)), 0x5a);
+  for (auto _ : state) {
+    auto text = unilink::common::safe_convert::uint8_to_string(bytes.data(), bytes.size());
+    benchmark::DoNotOptimize(text.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SafeConvertBytesToString)->RangeMultiplier(8)->Range(16, 64 << 10);
+
+static void BM_SafeConvertStringToBytes(benchmark::State& state) {
+  const std::string text(static_cast<size_t>(state.range(0)), 'z');
+  for (auto _ : state) {
+    auto bytes = unilink::common::safe_convert::string_to_uint8(text);
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SafeConvertStringToBytes)->RangeMultiplier(8)->Range(16, 64 << 10);
+
+// ============================================================================
+// SafeDataBuffer
+// ============================================================================
+
+static void BM_SafeDataBufferFromString(benchmark::State& state) {
+  const std::string text(static_cast<size_t>(state.range(0)), 'z');
+  for (auto _ : state) {
+    SafeDataBuffer buffer(text);
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SafeDataBufferFromString)->RangeMultiplier(8)->Range(16, 64 << 10);
+
+static void BM_SafeDataBufferFromSpan(benchmark::State& state) {
+  const std::vector<uint8_t> bytes(static_cast<size_t>(state.range(0)), 0x5a);
+  for (auto _ : state) {
+    SafeDataBuffer buffer(ConstByteSpan(bytes.data(), bytes.size()));
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SafeDataBufferFromSpan)->RangeMultiplier(8)->Range(16, 64 << 10);
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+
+#include "unilink/common/logger.hpp"
+
+using unilink::common::AsyncLogConfig;
+using unilink::common::Logger;
+using unilink::common::LogLevel;
+
+namespace {
+
+/**
+ * @brief Routes the logger to a scratch file for one benchmark run
+ */
+class ScopedFileLogger {
+ public:
+  explicit ScopedFileLogger(bool async) : async_(async) {
+    path_ = std::filesystem::temp_directory_path() /
+            ("unilink_microbench_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) +
+             ".log");
+    auto& logger = Logger::instance();
+    logger.set_level(LogLevel::INFO);
+    logger.set_console_output(false);
+    logger.set_file_output(path_.string());
+    if (async_) {
+      AsyncLogConfig config;
+      config.max_queue_size = 1 << 16;
+      config.batch_size = 512;
+      config.flush_interval = std::chrono::milliseconds(10);
+      logger.set_async_logging(true, config);
+    }
+  }
+
+  ~ScopedFileLogger() {
+    auto& logger = Logger::instance();
+    if (async_) logger.set_async_logging(false);
+    logger.set_file_output("");
+    logger.set_console_output(true);
+    std::error_code ec;
+    std::filesystem::remove(path_, ec);
+  }
+
+  ScopedFileLogger(const ScopedFileLogger&) = delete;
+  ScopedFileLogger& operator=(const ScopedFileLogger&) = delete;
+
+ private:
+  bool async_;
+  std::filesystem::path path_;
+};
+
+}  // namespace
+
+/**
+ * @brief Synchronous text logging to a file, formatted and written on the caller
+ */
+static void BM_LoggerSync(benchmark::State& state) {
+  ScopedFileLogger scope(false);
+  const std::string message(static_cast<size_t>(state.range(0)), 'x');
+  for (auto _ : state) {
+    UNILINK_LOG_INFO("microbench", "sync", message);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LoggerSync)->Arg(32)->Arg(256);
+
+/**
+ * @brief Asynchronous text logging; measures the producer side of the queue
+ *
+ * Entries the worker could not keep up with are reported as "dropped".
+ */
+static void BM_LoggerAsync(benchmark::State& state) {
+  ScopedFileLogger scope(true);
+  const std::string message(static_cast<size_t>(state.range(0)), 'x');
+  for (auto _ : state) {
+    UNILINK_LOG_INFO("microbench", "async", message);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["dropped"] = static_cast<double>(Logger::instance().get_async_stats().dropped_logs);
+}
+BENCHMARK(BM_LoggerAsync)->Arg(32)->Arg(256)->UseRealTime();
+
+/**
+ * @brief A call below the configured level; should cost one level check
+ */
+static void BM_LoggerFiltered(benchmark::State& state) {
+  ScopedFileLogger scope(false);
+  for (auto _ : state) {
+    UNILINK_LOG_DEBUG("microbench", "filtered", "not emitted");
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LoggerFiltered);
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "unilink/common/memory_pool.hpp"
+
+using unilink::common::MemoryPool;
+using unilink::common::PooledBuffer;
+
+namespace {
+
+// Shared by all threads of a run so contention on the bucket locks is measured
+MemoryPool& shared_pool() {
+  static MemoryPool pool(400, 2000);
+  return pool;
+}
+
+}  // namespace
+
+/**
+ * @brief Acquire/release round trip on a warm pool
+ *
+ * Arg 0 is the requested size; the thread count is swept by the registration.
+ */
+static void BM_MemoryPoolAcquireRelease(benchmark::State& state) {
+  auto& pool = shared_pool();
+  const auto size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    auto buffer = pool.acquire(size);
+    benchmark::DoNotOptimize(buffer.get());
+    pool.release(std::move(buffer), size);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetLabel(std::to_string(size) + "B");
+}
+BENCHMARK(BM_MemoryPoolAcquireRelease)
+    ->Arg(256)
+    ->Arg(1024)
+    ->Arg(4096)
+    ->Arg(16384)
+    ->Arg(65536)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+/**
+ * @brief Baseline: the same sizes straight from the heap
+ */
+static void BM_HeapAllocateFree(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    auto buffer = std::make_unique<uint8_t[]>(size);
+    benchmark::DoNotOptimize(buffer.get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HeapAllocateFree)
+    ->Arg(256)
+    ->Arg(1024)
+    ->Arg(4096)
+    ->Arg(16384)
+    ->Arg(65536)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+/**
+ * @brief PooledBuffer construction and destruction through the global pool
+ */
+static void BM_PooledBufferLifetime(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    PooledBuffer buffer(size);
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PooledBufferLifetime)->Arg(1024)->Arg(4096)->Arg(65536);
+
+/**
+ * @brief Cost of moving a PooledBuffer back and forth (no pool traffic)
+ */
+static void BM_PooledBufferMove(benchmark::State& state) {
+  PooledBuffer a(MemoryPool::BufferSize::MEDIUM);
+  PooledBuffer b(MemoryPool::BufferSize::SMALL);
+  for (auto _ : state) {
+    PooledBuffer tmp(std::move(a));
+    a = std::move(b);
+    b = std::move(tmp);
+    benchmark::DoNotOptimize(a.data());
+    benchmark::DoNotOptimize(b.data());
+  }
+  state.SetItemsProcessed(state.iterations() * 3);
+}
+BENCHMARK(BM_PooledBufferMove);
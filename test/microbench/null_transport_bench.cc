@@ -0,0 +1,454 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @brief Library overhead per message over in-memory devices
+ *
+ * TcpServerSession and Serial are driven through null implementations of
+ * TcpSocketInterface and SerialPortInterface whose operations complete on the
+ * next poll of the io_context, so no kernel work is involved. Each benchmark
+ * reports the time per message and the heap allocations per message made on
+ * the benchmark thread. The RawAsio cases drive the same null devices
+ * directly and are the floor the transports are compared against.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <boost/asio.hpp>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "allocation_counter.hpp"
+#include "unilink/common/logger.hpp"
+#include "unilink/interface/iserial_port.hpp"
+#include "unilink/interface/itcp_socket.hpp"
+#include "unilink/transport/serial/serial.hpp"
+#include "unilink/transport/tcp_server/tcp_server_session.hpp"
+
+namespace net = boost::asio;
+using unilink::test::ScopedAllocationCount;
+using Handler = std::function<void(const boost::system::error_code&, std::size_t)>;
+
+namespace {
+
+/**
+ * @brief Fixed storage for the null devices' own completion handlers
+ *
+ * Completions are posted with an associated allocator backed by this arena,
+ * so the devices add no heap allocations of their own and the counts below
+ * belong to the code under test.
+ */
+class HandlerArena {
+ public:
+  void* allocate(size_t size) {
+    for (auto& slot : slots_) {
+      if (!slot.used && size <= sizeof(slot.storage)) {
+        slot.used = true;
+        return slot.storage;
+      }
+    }
+    return ::operator new(size);
+  }
+
+  void deallocate(void* ptr) {
+    for (auto& slot : slots_) {
+      if (ptr == slot.storage) {
+        slot.used = false;
+        return;
+      }
+    }
+    ::operator delete(ptr);
+  }
+
+ private:
+  struct Slot {
+    alignas(std::max_align_t) unsigned char storage[256];
+    bool used = false;
+  };
+  std::array<Slot, 4> slots_{};
+};
+
+template <typename T>
+struct ArenaAllocator {
+  using value_type = T;
+
+  explicit ArenaAllocator(HandlerArena* arena) noexcept : arena(arena) {}
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+  T* allocate(size_t n) { return static_cast<T*>(arena->allocate(sizeof(T) * n)); }
+  void deallocate(T* ptr, size_t) noexcept { arena->deallocate(ptr); }
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U>& other) const noexcept {
+    return arena == other.arena;
+  }
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+    return arena != other.arena;
+  }
+
+  HandlerArena* arena;
+};
+
+template <typename Function>
+struct ArenaHandler {
+  using allocator_type = ArenaAllocator<void>;
+
+  allocator_type get_allocator() const noexcept { return allocator_type(arena); }
+  void operator()() { function(); }
+
+  HandlerArena* arena;
+  Function function;
+};
+
+/**
+ * @brief Read/write side shared by the null socket and the null serial port
+ *
+ * Writes complete with their full size. Reads stay pending until deliver()
+ * copies bytes into the caller's buffer.
+ */
+class NullStream {
+ public:
+  explicit NullStream(net::io_context& ioc) : ioc_(ioc) {}
+
+  void async_read_some(const net::mutable_buffer& buffer, Handler handler) {
+    read_buffer_ = buffer;
+    read_handler_ = std::move(handler);
+  }
+
+  void async_write(const net::const_buffer& buffer, Handler handler) {
+    complete(std::move(handler), {}, buffer.size());
+  }
+
+  bool deliver(const uint8_t* data, size_t size) {
+    if (!read_handler_) return false;
+    size_t n = std::min(size, read_buffer_.size());
+    std::memcpy(read_buffer_.data(), data, n);
+    complete(std::move(read_handler_), {}, n);
+    read_handler_ = nullptr;
+    return true;
+  }
+
+  // Completes a pending read with an error, as closing a real socket does
+  void abort() {
+    if (!read_handler_) return;
+    complete(std::move(read_handler_), net::error::operation_aborted, 0);
+    read_handler_ = nullptr;
+  }
+
+ private:
+  void complete(Handler handler, boost::system::error_code ec, size_t n) {
+    auto function = [handler = std::move(handler), ec, n] { handler(ec, n); };
+    net::post(ioc_, ArenaHandler<decltype(function)>{&arena_, std::move(function)});
+  }
+
+  net::io_context& ioc_;
+  HandlerArena arena_;
+  net::mutable_buffer read_buffer_;
+  Handler read_handler_;
+};
+
+class NullTcpSocket : public unilink::interface::TcpSocketInterface {
+ public:
+  explicit NullTcpSocket(net::io_context& ioc) : stream_(ioc) {}
+
+  void async_read_some(const net::mutable_buffer& buffer, Handler handler) override {
+    stream_.async_read_some(buffer, std::move(handler));
+  }
+  void async_write(const net::const_buffer& buffer, Handler handler) override {
+    stream_.async_write(buffer, std::move(handler));
+  }
+  void shutdown(net::ip::tcp::socket::shutdown_type, boost::system::error_code& ec) override { ec.clear(); }
+  void close(boost::system::error_code& ec) override {
+    ec.clear();
+    stream_.abort();
+  }
+  net::ip::tcp::endpoint remote_endpoint(boost::system::error_code& ec) const override {
+    ec.clear();
+    return net::ip::tcp::endpoint(net::ip::address_v4::loopback(), 1);
+  }
+
+  NullStream& stream() { return stream_; }
+
+ private:
+  NullStream stream_;
+};
+
+class NullSerialPort : public unilink::interface::SerialPortInterface {
+ public:
+  explicit NullSerialPort(net::io_context& ioc) : stream_(ioc) {}
+
+  void open(const std::string&, boost::system::error_code& ec) override {
+    ec.clear();
+    open_ = true;
+  }
+  bool is_open() const override { return open_; }
+  void close(boost::system::error_code& ec) override {
+    ec.clear();
+    open_ = false;
+    stream_.abort();
+  }
+
+  void set_option(const net::serial_port_base::baud_rate&, boost::system::error_code& ec) override { ec.clear(); }
+  void set_option(const net::serial_port_base::character_size&, boost::system::error_code& ec) override { ec.clear(); }
+  void set_option(const net::serial_port_base::stop_bits&, boost::system::error_code& ec) override { ec.clear(); }
+  void set_option(const net::serial_port_base::parity&, boost::system::error_code& ec) override { ec.clear(); }
+  void set_option(const net::serial_port_base::flow_control&, boost::system::error_code& ec) override { ec.clear(); }
+
+  void async_read_some(const net::mutable_buffer& buffer, Handler handler) override {
+    stream_.async_read_some(buffer, std::move(handler));
+  }
+  void async_write(const net::const_buffer& buffer, Handler handler) override {
+    stream_.async_write(buffer, std::move(handler));
+  }
+
+  NullStream& stream() { return stream_; }
+
+ private:
+  NullStream stream_;
+  bool open_ = false;
+};
+
+/**
+ * @brief io_context polled on the benchmark thread so every handler is counted
+ */
+struct PolledContext {
+  net::io_context ioc;
+  net::executor_work_guard<net::io_context::executor_type> guard = net::make_work_guard(ioc);
+
+  void poll() { ioc.poll(); }
+};
+
+void report(benchmark::State& state, const ScopedAllocationCount& allocations) {
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  state.counters["allocs_per_msg"] =
+      benchmark::Counter(static_cast<double>(allocations.allocations()), benchmark::Counter::kAvgIterations);
+  state.counters["alloc_bytes_per_msg"] =
+      benchmark::Counter(static_cast<double>(allocations.bytes()), benchmark::Counter::kAvgIterations);
+}
+
+constexpr int kWarmupMessages = 64;
+
+}  // namespace
+
+// ============================================================================
+// Raw Asio floor
+// ============================================================================
+
+static void BM_RawAsioSend(benchmark::State& state) {
+  PolledContext context;
+  NullStream stream(context.ioc);
+  const std::vector<uint8_t> payload(static_cast<size_t>(state.range(0)), 0x5a);
+  std::vector<uint8_t> staging(payload.size());
+  size_t written = 0;
+  // One hop to the io thread, then the write, as the transports do
+  auto send = [&] {
+    net::post(context.ioc, [&] {
+      std::memcpy(staging.data(), payload.data(), payload.size());
+      stream.async_write(net::buffer(staging),
+                         [&written](const boost::system::error_code&, size_t n) { written += n; });
+    });
+    context.poll();
+  };
+  for (int i = 0; i < kWarmupMessages; ++i) send();
+
+  ScopedAllocationCount allocations;
+  for (auto _ : state) send();
+  report(state, allocations);
+  benchmark::DoNotOptimize(written);
+}
+BENCHMARK(BM_RawAsioSend)->Arg(64)->Arg(1024)->Arg(4096);
+
+namespace {
+
+// Re-arms itself like a minimal hand-written reader; the handler fits std::function's inline storage
+struct RawReader {
+  NullStream& stream;
+  std::vector<uint8_t> rx;
+  size_t received = 0;
+
+  void arm() {
+    stream.async_read_some(net::buffer(rx), [this](const boost::system::error_code& ec, size_t n) {
+      if (ec) return;
+      received += n;
+      arm();
+    });
+  }
+};
+
+}  // namespace
+
+static void BM_RawAsioReceive(benchmark::State& state) {
+  PolledContext context;
+  NullStream stream(context.ioc);
+  const std::vector<uint8_t> payload(static_cast<size_t>(state.range(0)), 0x5a);
+  RawReader reader{stream, std::vector<uint8_t>(payload.size())};
+  reader.arm();
+  auto receive = [&] {
+    stream.deliver(payload.data(), payload.size());
+    context.poll();
+  };
+  for (int i = 0; i < kWarmupMessages; ++i) receive();
+
+  ScopedAllocationCount allocations;
+  for (auto _ : state) receive();
+  report(state, allocations);
+  stream.abort();
+  context.poll();
+  benchmark::DoNotOptimize(reader.received);
+}
+BENCHMARK(BM_RawAsioReceive)->Arg(64)->Arg(1024)->Arg(4096);
+
+// ============================================================================
+// TcpServerSession
+// ============================================================================
+
+static void BM_TcpSessionSend(benchmark::State& state) {
+  PolledContext context;
+  auto socket = std::make_unique<NullTcpSocket>(context.ioc);
+  auto* null_socket = socket.get();
+  auto session = std::make_shared<unilink::transport::TcpServerSession>(context.ioc, std::move(socket));
+  session->start();
+  context.poll();
+
+  const std::vector<uint8_t> payload(static_cast<size_t>(state.range(0)), 0x5a);
+  auto send = [&] {
+    session->async_write_copy(payload.data(), payload.size());
+    context.poll();
+  };
+  for (int i = 0; i < kWarmupMessages; ++i) send();
+
+  ScopedAllocationCount allocations;
+  for (auto _ : state) send();
+  report(state, allocations);
+  null_socket->stream().abort();
+  context.poll();
+}
+BENCHMARK(BM_TcpSessionSend)->Arg(64)->Arg(1024)->Arg(4096);
+
+static void BM_TcpSessionReceive(benchmark::State& state) {
+  PolledContext context;
+  auto socket = std::make_unique<NullTcpSocket>(context.ioc);
+  auto* null_socket = socket.get();
+  auto session = std::make_shared<unilink::transport::TcpServerSession>(context.ioc, std::move(socket));
+  size_t received = 0;
+  session->on_bytes([&received](const uint8_t*, size_t n) { received += n; });
+  session->start();
+  context.poll();
+
+  const std::vector<uint8_t> payload(static_cast<size_t>(state.range(0)), 0x5a);
+  auto receive = [&] {
+    null_socket->stream().deliver(payload.data(), payload.size());
+    context.poll();
+  };
+  for (int i = 0; i < kWarmupMessages; ++i) receive();
+
+  ScopedAllocationCount allocations;
+  for (auto _ : state) receive();
+  report(state, allocations);
+  null_socket->stream().abort();
+  context.poll();
+  benchmark::DoNotOptimize(received);
+}
+BENCHMARK(BM_TcpSessionReceive)->Arg(64)->Arg(1024)->Arg(4096);
+
+// ============================================================================
+// Serial
+// ============================================================================
+
+namespace {
+
+std::shared_ptr<unilink::transport::Serial> make_null_serial(PolledContext& context, NullSerialPort*& port) {
+  unilink::config::SerialConfig cfg;
+  cfg.device = "/dev/null-bench";
+  auto owned = std::make_unique<NullSerialPort>(context.ioc);
+  port = owned.get();
+  auto serial = std::make_shared<unilink::transport::Serial>(cfg, std::move(owned), context.ioc);
+  return serial;
+}
+
+}  // namespace
+
+static void BM_SerialSend(benchmark::State& state) {
+  PolledContext context;
+  NullSerialPort* port = nullptr;
+  auto serial = make_null_serial(context, port);
+  serial->start();
+  context.poll();
+  if (!serial->is_connected()) {
+    state.SkipWithError("null serial port did not open");
+    return;
+  }
+
+  const std::vector<uint8_t> payload(static_cast<size_t>(state.range(0)), 0x5a);
+  auto send = [&] {
+    serial->async_write_copy(payload.data(), payload.size());
+    context.poll();
+  };
+  for (int i = 0; i < kWarmupMessages; ++i) send();
+
+  ScopedAllocationCount allocations;
+  for (auto _ : state) send();
+  report(state, allocations);
+  serial->stop();
+  context.poll();
+}
+BENCHMARK(BM_SerialSend)->Arg(64)->Arg(1024)->Arg(4096);
+
+static void BM_SerialReceive(benchmark::State& state) {
+  PolledContext context;
+  NullSerialPort* port = nullptr;
+  auto serial = make_null_serial(context, port);
+  size_t received = 0;
+  serial->on_bytes([&received](const uint8_t*, size_t n) { received += n; });
+  serial->start();
+  context.poll();
+  if (!serial->is_connected()) {
+    state.SkipWithError("null serial port did not open");
+    return;
+  }
+
+  const std::vector<uint8_t> payload(static_cast<size_t>(state.range(0)), 0x5a);
+  auto receive = [&] {
+    port->stream().deliver(payload.data(), payload.size());
+    context.poll();
+  };
+  for (int i = 0; i < kWarmupMessages; ++i) receive();
+
+  ScopedAllocationCount allocations;
+  for (auto _ : state) receive();
+  report(state, allocations);
+  serial->stop();
+  context.poll();
+  benchmark::DoNotOptimize(received);
+}
+BENCHMARK(BM_SerialReceive)->Arg(64)->Arg(1024)->Arg(4096);
+
+int main(int argc, char** argv) {
+  // Stopping a channel reports the aborted read as an error; keep the tables readable
+  unilink::common::Logger::instance().set_level(unilink::common::LogLevel::CRITICAL);
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
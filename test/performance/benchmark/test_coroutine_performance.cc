@@ -0,0 +1,197 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "test_utils.hpp"
+#include "unilink/common/logger.hpp"
+#include "unilink/factory/channel_factory.hpp"
+#include "unilink/wrapper/awaitable/awaitable_channel.hpp"
+
+using namespace unilink;
+using namespace std::chrono_literals;
+using unilink::test::TestUtils;
+namespace net = boost::asio;
+
+// ============================================================================
+// COROUTINE API PERFORMANCE BENCHMARKS
+// ============================================================================
+
+/**
+ * @brief Request/response latency: callback state machine vs. coroutine
+ *
+ * One request of kMessageSize bytes is in flight at a time against an echo
+ * server on loopback. The client channel and its handlers share one
+ * io_context run by the benchmark thread, so both variants pay the same I/O
+ * cost and differ only in how the protocol logic is expressed.
+ */
+class CoroutinePerformanceTest : public ::testing::Test {
+ protected:
+  static constexpr size_t kMessageSize = 64;
+  static constexpr size_t kRoundTrips = 5000;
+
+  struct Summary {
+    double mean_us;
+    double p50_us;
+    double p99_us;
+  };
+
+  void SetUp() override {
+    previous_level_ = common::Logger::instance().get_level();
+    common::Logger::instance().set_level(common::LogLevel::WARNING);
+
+    port_ = TestUtils::getAvailableTestPort();
+    config::TcpServerConfig server_cfg;
+    server_cfg.port = port_;
+    server_ = factory::ChannelFactory::create(server_cfg, server_ioc_);
+    server_->on_bytes([this](const uint8_t* data, size_t size) { server_->async_write_copy(data, size); });
+    server_work_ = std::make_unique<WorkGuard>(server_ioc_.get_executor());
+    server_thread_ = std::thread([this] { server_ioc_.run(); });
+    server_->start();
+  }
+
+  void TearDown() override {
+    server_->stop();
+    server_work_.reset();
+    server_ioc_.stop();
+    server_thread_.join();
+    common::Logger::instance().set_level(previous_level_);
+  }
+
+  std::shared_ptr<interface::Channel> make_client(net::io_context& ioc) {
+    config::TcpClientConfig cfg;
+    cfg.host = "127.0.0.1";
+    cfg.port = port_;
+    cfg.retry_interval_ms = 20;
+    return factory::ChannelFactory::create(cfg, ioc);
+  }
+
+  // Stop the client and leave run() once its cleanup handler has executed
+  static void finish(net::io_context& ioc, interface::Channel& client) {
+    client.stop();
+    net::post(ioc, [&ioc] { ioc.stop(); });
+  }
+
+  static void run(net::io_context& ioc) {
+    ioc.run_for(30s);
+    ioc.restart();
+    ioc.run_for(50ms);  // Drain aborted reads so the client is released before the context
+  }
+
+  static Summary summarize(std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (double s : samples) sum += s;
+    return {sum / static_cast<double>(samples.size()), samples[samples.size() / 2], samples[samples.size() * 99 / 100]};
+  }
+
+  static void print(const char* label, const Summary& s) {
+    std::cout << std::left << std::setw(12) << label << std::fixed << std::setprecision(1) << "mean " << s.mean_us
+              << " us, p50 " << s.p50_us << " us, p99 " << s.p99_us << " us" << std::endl;
+  }
+
+  using WorkGuard = net::executor_work_guard<net::io_context::executor_type>;
+
+  uint16_t port_ = 0;
+  net::io_context server_ioc_;
+  std::unique_ptr<WorkGuard> server_work_;
+  std::thread server_thread_;
+  std::shared_ptr<interface::Channel> server_;
+  common::LogLevel previous_level_ = common::LogLevel::INFO;
+};
+
+TEST_F(CoroutinePerformanceTest, RequestResponseLatencyCallbacksVsCoroutine) {
+  const std::array<uint8_t, kMessageSize> request{};
+  std::vector<double> callback_samples;
+  std::vector<double> coroutine_samples;
+  callback_samples.reserve(kRoundTrips);
+  coroutine_samples.reserve(kRoundTrips);
+
+  // Callback variant: explicit state machine driven by on_state/on_bytes
+  {
+    net::io_context ioc;
+    auto client = make_client(ioc);
+    size_t received = 0;
+    auto sent_at = std::chrono::steady_clock::now();
+    auto send = [&] {
+      received = 0;
+      sent_at = std::chrono::steady_clock::now();
+      client->async_write_copy(request.data(), request.size());
+    };
+    client->on_state([&](common::LinkState state) {
+      if (state == common::LinkState::Connected && callback_samples.empty()) send();
+    });
+    client->on_bytes([&](const uint8_t*, size_t size) {
+      received += size;
+      if (received < kMessageSize) return;
+      callback_samples.push_back(
+          std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - sent_at).count());
+      if (callback_samples.size() < kRoundTrips) {
+        send();
+      } else {
+        finish(ioc, *client);
+      }
+    });
+    client->start();
+    run(ioc);
+  }
+  ASSERT_EQ(callback_samples.size(), kRoundTrips);
+
+  // Coroutine variant: the same protocol as straight-line code
+  {
+    net::io_context ioc;
+    auto client = make_client(ioc);
+    wrapper::AwaitableChannel link(client, ioc.get_executor());
+    auto session = [&]() -> net::awaitable<void> {
+      std::array<uint8_t, kMessageSize> reply;
+      co_await link.wait_connected();
+      for (size_t i = 0; i < kRoundTrips; ++i) {
+        auto sent_at = std::chrono::steady_clock::now();
+        co_await link.write(request);
+        for (size_t received = 0; received < kMessageSize;) {
+          received += co_await link.read_some(std::span<uint8_t>(reply).subspan(received));
+        }
+        coroutine_samples.push_back(
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - sent_at).count());
+      }
+      finish(ioc, *client);
+    };
+    net::co_spawn(ioc, session(), net::detached);
+    client->start();
+    run(ioc);
+  }
+  ASSERT_EQ(coroutine_samples.size(), kRoundTrips);
+
+  auto callbacks = summarize(callback_samples);
+  auto coroutine = summarize(coroutine_samples);
+  std::cout << "\n=== Request/Response Latency (" << kRoundTrips << " x " << kMessageSize << " B, loopback) ===\n";
+  print("Callbacks:", callbacks);
+  print("Coroutine:", coroutine);
+
+  // The coroutine adds a buffer copy and a wake-up per read; it must stay in the same range
+  EXPECT_LT(coroutine.p50_us, callbacks.p50_us * 3 + 20);
+}
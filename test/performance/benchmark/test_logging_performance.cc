@@ -0,0 +1,105 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "test_utils.hpp"
+#include "unilink/common/logger.hpp"
+
+using namespace unilink::common;
+using namespace std::chrono_literals;
+using unilink::test::TestUtils;
+
+// ============================================================================
+// LOGGING PERFORMANCE BENCHMARKS
+// ============================================================================
+
+/**
+ * @brief Per-call cost of the binary log mode vs. the text async mode
+ */
+class LoggingPerformanceTest : public ::testing::Test {
+ protected:
+  static constexpr int kIterations = 200000;
+
+  void SetUp() override {
+    auto now = std::chrono::system_clock::now().time_since_epoch().count();
+    test_dir_ = TestUtils::makeTempFilePath("unilink_logging_perf_" + std::to_string(now));
+    std::filesystem::create_directories(test_dir_);
+
+    auto& logger = Logger::instance();
+    logger.set_level(LogLevel::INFO);
+    logger.set_console_output(false);
+  }
+
+  void TearDown() override {
+    auto& logger = Logger::instance();
+    logger.set_binary_output("");
+    logger.set_async_logging(false);
+    logger.set_file_output("");
+    logger.set_console_output(true);
+    std::error_code ec;
+    std::filesystem::remove_all(test_dir_, ec);
+  }
+
+  template <typename LogCall>
+  double measure_ns_per_call(LogCall&& log_call) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+      log_call(i);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / kIterations;
+  }
+
+  std::filesystem::path test_dir_;
+};
+
+TEST_F(LoggingPerformanceTest, BinaryVersusTextAsync) {
+  std::cout << "\n=== Binary vs. Text Async Logging Benchmark ===" << std::endl;
+  auto& logger = Logger::instance();
+
+  // Text async mode: message is built and formatted, then queued for the worker
+  logger.set_file_output((test_dir_ / "text.log").string());
+  AsyncLogConfig async_config;
+  async_config.max_queue_size = kIterations;
+  logger.set_async_logging(true, async_config);
+  double text_ns = measure_ns_per_call([](int i) {
+    UNILINK_LOG_INFO("tcp_client", "write", "sent " + std::to_string(i) + " bytes to " + std::string("peer"));
+  });
+  auto text_stats = logger.get_async_stats();
+  logger.set_async_logging(false);
+  logger.set_file_output("");
+
+  // Binary mode: IDs and raw arguments are copied into the mapped segment
+  logger.set_binary_output((test_dir_ / "binary.ulog").string());
+  double binary_ns = measure_ns_per_call(
+      [](int i) { UNILINK_LOG_FMT(LogLevel::INFO, "tcp_client", "write", "sent {} bytes to {}", i, "peer"); });
+  logger.set_binary_output("");
+
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "Text async:  " << text_ns << " ns/call (dropped " << text_stats.dropped_logs << ")" << std::endl;
+  std::cout << "Binary:      " << binary_ns << " ns/call" << std::endl;
+  std::cout << "Speedup:     " << (text_ns / binary_ns) << "x" << std::endl;
+
+  EXPECT_GT(text_ns, 0.0);
+  EXPECT_GT(binary_ns, 0.0);
+}
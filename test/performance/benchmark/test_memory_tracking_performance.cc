@@ -0,0 +1,102 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "unilink/common/memory_tracker.hpp"
+
+using namespace unilink::common;
+
+// ============================================================================
+// MEMORY TRACKING PERFORMANCE BENCHMARKS
+// ============================================================================
+
+/**
+ * @brief Allocation throughput with the sampling profiler off, sampling, and recording everything
+ */
+class MemoryTrackingPerformanceTest : public ::testing::Test {
+ protected:
+  static constexpr int kIterations = 500000;
+  static constexpr int kThreads = 4;
+
+  void TearDown() override {
+    auto& tracker = MemoryTracker::instance();
+    tracker.set_sample_interval(MemoryTracker::DEFAULT_SAMPLE_INTERVAL);
+    tracker.enable_tracking(true);
+    tracker.clear_tracking_data();
+  }
+
+  // Mixed sizes typical of I/O buffers, freed right away like a transient write
+  static double measure_allocs_per_second(int thread_count) {
+    static const AllocationSiteId site = MemoryTracker::register_site(__FILE__, __LINE__, __FUNCTION__);
+    auto& tracker = MemoryTracker::instance();
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+      threads.emplace_back([&tracker] {
+        for (int i = 0; i < kIterations; ++i) {
+          size_t size = 64u << (i % 6);
+          void* ptr = std::malloc(size);
+          tracker.track_allocation(ptr, size, site);
+          tracker.track_deallocation(ptr);
+          std::free(ptr);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(thread_count) * kIterations / seconds;
+  }
+};
+
+TEST_F(MemoryTrackingPerformanceTest, AllocationThroughput) {
+  std::cout << "\n=== Allocation Throughput With Memory Tracking ===" << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+  auto& tracker = MemoryTracker::instance();
+
+  for (int threads : {1, kThreads}) {
+    tracker.clear_tracking_data();
+    tracker.disable_tracking();
+    double off = measure_allocs_per_second(threads);
+
+    tracker.enable_tracking(true);
+    tracker.set_sample_interval(MemoryTracker::DEFAULT_SAMPLE_INTERVAL);
+    double sampled = measure_allocs_per_second(threads);
+    auto sampled_count = tracker.get_stats().sampled_allocations;
+
+    tracker.clear_tracking_data();
+    tracker.set_sample_interval(1);
+    double every = measure_allocs_per_second(threads);
+
+    std::cout << threads << " thread(s): off " << off / 1e6 << " M/s, sampled " << sampled / 1e6 << " M/s ("
+              << sampled_count << " samples), every allocation " << every / 1e6 << " M/s" << std::endl;
+
+    EXPECT_GT(off, 0.0);
+    EXPECT_GT(sampled, 0.0);
+    EXPECT_GT(every, 0.0);
+  }
+}
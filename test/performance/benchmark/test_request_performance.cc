@@ -0,0 +1,161 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <boost/asio.hpp>
+#include <chrono>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "test_utils.hpp"
+#include "unilink/common/logger.hpp"
+#include "unilink/factory/channel_factory.hpp"
+#include "unilink/wrapper/request/request_channel.hpp"
+
+using namespace unilink;
+using namespace std::chrono_literals;
+using unilink::test::TestUtils;
+namespace net = boost::asio;
+
+// ============================================================================
+// REQUEST/RESPONSE PIPELINING BENCHMARKS
+// ============================================================================
+
+/**
+ * @brief Request throughput vs. window size on a high-latency link
+ *
+ * The server answers every request after kServiceDelay, emulating a slow
+ * peer or a long round trip. With one request in flight throughput is capped
+ * at 1 / delay; pipelining should scale it with the window.
+ */
+class RequestPerformanceTest : public ::testing::Test {
+ protected:
+  static constexpr auto kServiceDelay = 2ms;
+  static constexpr size_t kPayloadSize = 32;
+
+  void SetUp() override {
+    previous_level_ = common::Logger::instance().get_level();
+    common::Logger::instance().set_level(common::LogLevel::WARNING);
+
+    uint16_t port = TestUtils::getAvailableTestPort();
+    config::TcpServerConfig server_cfg;
+    server_cfg.port = port;
+    server_link_ = factory::ChannelFactory::create(server_cfg, ioc_);
+    config::TcpClientConfig client_cfg;
+    client_cfg.host = "127.0.0.1";
+    client_cfg.port = port;
+    client_cfg.retry_interval_ms = 20;
+    client_link_ = factory::ChannelFactory::create(client_cfg, ioc_);
+
+    server_ = wrapper::RequestChannel::create(server_link_, ioc_.get_executor());
+    server_->on_request([this](uint32_t id, const uint8_t* data, size_t size) {
+      auto timer = std::make_shared<net::steady_timer>(ioc_, kServiceDelay);
+      timer->async_wait([this, timer, id, reply = std::vector<uint8_t>(data, data + size)](auto) {
+        server_->respond(id, reply.data(), reply.size());
+      });
+    });
+    client_ = wrapper::RequestChannel::create(client_link_, ioc_.get_executor(), options(256));
+
+    server_link_->start();
+    client_link_->start();
+    auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (!client_link_->is_connected() && std::chrono::steady_clock::now() < deadline) {
+      ioc_.run_for(10ms);
+    }
+  }
+
+  void TearDown() override {
+    client_.reset();
+    server_.reset();
+    client_link_->stop();
+    server_link_->stop();
+    ioc_.restart();
+    ioc_.run_for(50ms);
+    common::Logger::instance().set_level(previous_level_);
+  }
+
+  static wrapper::RequestChannel::Options options(size_t window) {
+    wrapper::RequestChannel::Options opts;
+    opts.window = window;
+    return opts;
+  }
+
+  // Keep `window` requests in flight until `total` are answered; returns requests/second
+  double run_window(size_t window, size_t total) {
+    const std::vector<uint8_t> payload(kPayloadSize, 0xAB);
+    size_t issued = 0;
+    size_t answered = 0;
+    size_t failed = 0;
+
+    std::function<void()> issue;
+    auto on_reply = [&](wrapper::RequestChannel::Status status, const uint8_t*, size_t) {
+      if (status != wrapper::RequestChannel::Status::Ok) ++failed;
+      if (++answered == total) {
+        ioc_.stop();
+      } else if (issued < total) {
+        issue();
+      }
+    };
+    issue = [&] {
+      ++issued;
+      client_->request(payload.data(), payload.size(), on_reply);
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < window && issued < total; ++i) issue();
+    ioc_.restart();
+    ioc_.run_for(60s);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_EQ(answered, total);
+    EXPECT_EQ(failed, 0u);
+    return static_cast<double>(answered) / seconds;
+  }
+
+  net::io_context ioc_;
+  std::shared_ptr<interface::Channel> server_link_;
+  std::shared_ptr<interface::Channel> client_link_;
+  std::shared_ptr<wrapper::RequestChannel> server_;
+  std::shared_ptr<wrapper::RequestChannel> client_;
+  common::LogLevel previous_level_ = common::LogLevel::INFO;
+};
+
+TEST_F(RequestPerformanceTest, ThroughputScalesWithWindow) {
+  ASSERT_TRUE(client_link_->is_connected());
+
+  std::map<size_t, double> throughput;
+  for (size_t window : std::initializer_list<size_t>{1, 4, 16, 64, 256}) {
+    throughput[window] = run_window(window, window == 1 ? 200 : 4000);
+  }
+
+  std::cout << "\n=== Pipelined Requests (" << kServiceDelay.count() << " ms service delay, " << kPayloadSize
+            << " B) ===\n";
+  for (const auto& [window, rps] : throughput) {
+    std::cout << "window " << std::setw(4) << window << ": " << std::fixed << std::setprecision(0) << std::setw(8)
+              << rps << " req/s (" << std::setprecision(1) << rps / throughput[1] << "x)" << std::endl;
+  }
+
+  // Without pipelining the link is bound by the delay; with it, by the window
+  EXPECT_LT(throughput[1], 1000.0 / kServiceDelay.count());
+  EXPECT_GT(throughput[16], throughput[1] * 8);
+  EXPECT_GT(throughput[64], throughput[16]);
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "unilink/common/common.hpp"
+#include "unilink/common/logger.hpp"
+#include "unilink/transport/tcp_server/tcp_server_session.hpp"
+#include "unilink/transport/tcp_server/topic_router.hpp"
+
+using namespace unilink;
+using namespace std::chrono_literals;
+namespace net = boost::asio;
+
+// ============================================================================
+// TOPIC FAN-OUT BENCHMARKS
+// ============================================================================
+
+namespace {
+
+// Counts bytes handed to the "wire" and wakes the benchmark once a round is delivered
+struct DeliverySink {
+  std::atomic<size_t> writes{0};
+  size_t target = 0;
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  void delivered() {
+    if (writes.fetch_add(1, std::memory_order_relaxed) + 1 == target) {
+      std::lock_guard<std::mutex> lock(mutex);
+      cv.notify_all();
+    }
+  }
+};
+
+// Socket that completes every write on the next turn of the io_context and never receives
+class NullSocket : public interface::TcpSocketInterface {
+ public:
+  NullSocket(net::io_context& ioc, DeliverySink& sink) : ioc_(ioc), sink_(sink) {}
+
+  void async_read_some(const net::mutable_buffer&,
+                       std::function<void(const boost::system::error_code&, std::size_t)> handler) override {
+    pending_read_ = std::move(handler);
+  }
+  void async_write(const net::const_buffer& buffer,
+                   std::function<void(const boost::system::error_code&, std::size_t)> handler) override {
+    sink_.delivered();
+    net::post(ioc_, [handler = std::move(handler), n = buffer.size()] { handler({}, n); });
+  }
+  void shutdown(net::ip::tcp::socket::shutdown_type, boost::system::error_code&) override {}
+  void close(boost::system::error_code&) override {}
+  net::ip::tcp::endpoint remote_endpoint(boost::system::error_code&) const override { return {}; }
+
+ private:
+  net::io_context& ioc_;
+  DeliverySink& sink_;
+  std::function<void(const boost::system::error_code&, std::size_t)> pending_read_;
+};
+
+}  // namespace
+
+/**
+ * @brief Publish latency to 10k subscribers
+ *
+ * Compares TopicRouter::publish() against the per-client loop the multi-chat
+ * example uses (lock, copy, async_write_copy for every client). Latency is
+ * measured from the publish call until the last subscriber's write reaches
+ * its socket. Sessions use a null socket, since 10k real connections exceed
+ * the descriptor limit of most CI machines.
+ */
+class TopicPerformanceTest : public ::testing::Test {
+ protected:
+  static constexpr size_t kSubscribers = 10000;
+  static constexpr size_t kRounds = 50;
+  static constexpr size_t kPayloadSize = 256;
+
+  void SetUp() override {
+    previous_level_ = common::Logger::instance().get_level();
+    common::Logger::instance().set_level(common::LogLevel::WARNING);
+
+    sessions_.reserve(kSubscribers);
+    for (size_t i = 0; i < kSubscribers; ++i) {
+      auto session = std::make_shared<transport::TcpServerSession>(ioc_, std::make_unique<NullSocket>(ioc_, sink_));
+      session->start();
+      router_.subscribe(session, "ticker");
+      sessions_.push_back(std::move(session));
+    }
+    io_thread_ = std::thread([this] { ioc_.run(); });
+  }
+
+  void TearDown() override {
+    work_.reset();
+    ioc_.stop();
+    io_thread_.join();
+    router_.clear();
+    sessions_.clear();
+    common::Logger::instance().set_level(previous_level_);
+  }
+
+  struct Stats {
+    double p50_us;
+    double p99_us;
+    double call_us;  // Time the publishing thread spends inside the call
+  };
+
+  template <typename Publish>
+  Stats measure(Publish publish) {
+    std::vector<double> latency;
+    std::vector<double> call;
+    for (size_t round = 0; round < kRounds; ++round) {
+      sink_.target = sink_.writes.load() + kSubscribers;
+      auto start = std::chrono::steady_clock::now();
+      publish();
+      call.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+
+      std::unique_lock<std::mutex> lock(sink_.mutex);
+      EXPECT_TRUE(sink_.cv.wait_for(lock, 10s, [this] { return sink_.writes.load() >= sink_.target; }));
+      latency.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::sort(latency.begin(), latency.end());
+    std::sort(call.begin(), call.end());
+    return Stats{latency[latency.size() / 2], latency[latency.size() * 99 / 100], call[call.size() / 2]};
+  }
+
+  net::io_context ioc_;
+  std::unique_ptr<net::executor_work_guard<net::io_context::executor_type>> work_ =
+      std::make_unique<net::executor_work_guard<net::io_context::executor_type>>(ioc_.get_executor());
+  std::thread io_thread_;
+  DeliverySink sink_;
+  std::vector<std::shared_ptr<transport::TcpServerSession>> sessions_;
+  std::mutex sessions_mutex_;
+  transport::TopicRouter router_;
+  common::LogLevel previous_level_ = common::LogLevel::INFO;
+};
+
+TEST_F(TopicPerformanceTest, PublishLatencyAt10kSubscribers) {
+  const std::string message(kPayloadSize, 'x');
+
+  auto per_client = measure([&] {
+    for (size_t id = 0; id < sessions_.size(); ++id) {
+      std::lock_guard<std::mutex> lock(sessions_mutex_);  // As TcpServer::send_to_client does per call
+      auto data = common::safe_convert::string_to_uint8(message);
+      sessions_[id]->async_write_copy(data.data(), data.size());
+    }
+  });
+  auto topic = measure([&] {
+    EXPECT_EQ(router_.publish(ioc_, "ticker", reinterpret_cast<const uint8_t*>(message.data()), message.size()),
+              kSubscribers);
+  });
+
+  std::cout << "\n=== Publish to " << kSubscribers << " subscribers (" << kPayloadSize << " B, " << kRounds
+            << " rounds) ===\n"
+            << std::fixed << std::setprecision(1) << "per-client send loop: p50 " << std::setw(9) << per_client.p50_us
+            << " us, p99 " << std::setw(9) << per_client.p99_us << " us, caller " << std::setw(9)
+            << per_client.call_us << " us\n"
+            << "topic publish:        p50 " << std::setw(9) << topic.p50_us << " us, p99 " << std::setw(9)
+            << topic.p99_us << " us, caller " << std::setw(9) << topic.call_us << " us" << std::endl;
+
+  EXPECT_LT(topic.p50_us, per_client.p50_us);
+  EXPECT_LT(topic.call_us, per_client.call_us / 10);
+}
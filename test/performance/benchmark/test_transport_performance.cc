@@ -19,10 +19,12 @@
 
 #include <atomic>
 #include <chrono>
+#include <iostream>
 #include <memory>
 #include <thread>
 #include <vector>
 
+#include "unilink/common/io_context_manager.hpp"
 #include "unilink/config/serial_config.hpp"
 #include "unilink/config/tcp_client_config.hpp"
 #include "unilink/config/tcp_server_config.hpp"
@@ -83,6 +85,8 @@ class TransportPerformanceTest : public ::testing::Test {
     return port_counter.fetch_add(1);
   }
 
+  void runTcpLoopback(bool track_tx_latency);
+
  protected:
   std::shared_ptr<TcpClient> client_;
   std::shared_ptr<TcpServer> server_;
@@ -496,6 +500,81 @@ TEST_F(TransportPerformanceTest, TcpServerThroughput) {
   EXPECT_TRUE(server_ != nullptr);
 }
 
+/**
+ * @brief Connected TCP loopback throughput
+ *
+ * Unlike the tests above this measures bytes actually delivered, so it
+ * covers the read and write paths that update channel metrics. Building
+ * with -DUNILINK_ENABLE_METRICS=OFF gives the baseline for their overhead;
+ * comparing the two variants gives the cost of enqueue-to-wire tracking.
+ */
+void TransportPerformanceTest::runTcpLoopback(bool track_tx_latency) {
+  if (!IoContextManager::instance().is_running()) IoContextManager::instance().start();
+
+  TcpServerConfig server_cfg;
+  server_cfg.port = getTestPort();
+  server_ = std::make_shared<TcpServer>(server_cfg);
+  std::atomic<size_t> received{0};
+  server_->on_bytes([&received](const uint8_t*, size_t n) { received.fetch_add(n, std::memory_order_relaxed); });
+  server_->start();
+
+  TcpClientConfig client_cfg;
+  client_cfg.host = "127.0.0.1";
+  client_cfg.port = server_cfg.port;
+  client_cfg.retry_interval_ms = 50;
+  client_ = std::make_shared<TcpClient>(client_cfg);
+  client_->start();
+
+  auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (!(client_->is_connected() && server_->get_client_count() == 1) &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(5ms);
+  }
+  ASSERT_TRUE(client_->is_connected());
+  client_->set_tx_latency_tracking(track_tx_latency);
+
+  const size_t num_messages = 100000;
+  const size_t message_size = 100;
+  const size_t total_data = num_messages * message_size;
+  const std::vector<uint8_t> data(message_size, 0x42);
+
+  auto start_time = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < num_messages; ++i) {
+    client_->async_write_copy(data.data(), data.size());
+  }
+  deadline = std::chrono::steady_clock::now() + 30s;
+  while (received.load() < total_data && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(1ms);
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+  ASSERT_EQ(received.load(), total_data);
+
+  auto metrics = client_->metrics();
+  auto us = [](uint64_t ns) { return static_cast<double>(ns) / 1000.0; };
+  std::cout << "\n=== TCP loopback (" << num_messages << " x " << message_size << " B, metrics "
+            << (ChannelMetrics::enabled ? "on" : "off") << ", tx tracking " << (track_tx_latency ? "on" : "off")
+            << ") ===\n"
+            << "throughput: " << static_cast<double>(num_messages) / seconds / 1000.0 << " kmsg/s, "
+            << static_cast<double>(total_data) / seconds / (1024 * 1024) << " MiB/s" << std::endl;
+  if (ChannelMetrics::enabled) {
+    std::cout << "write latency: p50 " << us(metrics.write_latency_ns.percentile(50)) << " us, p99 "
+              << us(metrics.write_latency_ns.percentile(99)) << " us, max queue " << metrics.queue_high_watermark
+              << " B" << std::endl;
+    EXPECT_EQ(metrics.bytes_out, total_data);
+    EXPECT_EQ(server_->metrics().bytes_in, total_data);
+  }
+  if (track_tx_latency && ChannelMetrics::enabled) {
+    const auto& queue = metrics.queue_latency_ns;
+    std::cout << "enqueue-to-wire: p50 " << us(queue.percentile(50)) << " us, p99 " << us(queue.percentile(99))
+              << " us, p999 " << us(queue.percentile(99.9)) << " us" << std::endl;
+    EXPECT_EQ(queue.count, num_messages);
+  }
+}
+
+TEST_F(TransportPerformanceTest, TcpLoopbackThroughput) { runTcpLoopback(false); }
+
+TEST_F(TransportPerformanceTest, TcpLoopbackThroughputWithTxLatency) { runTcpLoopback(true); }
+
 // ============================================================================
 // 메모리 누수 테스트
 // ============================================================================
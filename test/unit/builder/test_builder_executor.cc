@@ -0,0 +1,159 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "test_utils.hpp"
+#include "unilink/common/io_context_manager.hpp"
+#include "unilink/common/io_context_pool.hpp"
+#include "unilink/unilink.hpp"
+
+using namespace unilink;
+using namespace std::chrono_literals;
+using unilink::test::TestUtils;
+namespace net = boost::asio;
+
+class BuilderExecutorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    work_ = std::make_unique<net::executor_work_guard<net::io_context::executor_type>>(ioc_.get_executor());
+    app_thread_ = std::thread([this] { ioc_.run(); });
+  }
+
+  void TearDown() override {
+    if (client_) client_->stop();
+    if (server_) server_->stop();
+    client_.reset();
+    server_.reset();
+    work_.reset();
+    ioc_.stop();
+    if (app_thread_.joinable()) app_thread_.join();
+  }
+
+  void record_thread() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    callback_threads_.insert(std::this_thread::get_id());
+  }
+
+  std::set<std::thread::id> callback_threads() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return callback_threads_;
+  }
+
+  uint16_t port_ = TestUtils::getAvailableTestPort();
+  net::io_context ioc_;
+  std::unique_ptr<net::executor_work_guard<net::io_context::executor_type>> work_;
+  std::thread app_thread_;
+
+  std::unique_ptr<wrapper::TcpServer> server_;
+  std::unique_ptr<wrapper::TcpClient> client_;
+
+  std::mutex mutex_;
+  std::set<std::thread::id> callback_threads_;
+};
+
+/**
+ * @brief Channels built with an application io_context run all callbacks on its thread
+ */
+TEST_F(BuilderExecutorTest, CallbacksRunOnApplicationContext) {
+  std::atomic<bool> client_connected{false};
+  std::string received;
+
+  server_ = unilink::tcp_server(port_)
+                .unlimited_clients()
+                .executor(ioc_)
+                .on_multi_connect([this](size_t, const std::string&) { record_thread(); })
+                .on_multi_data([this, &received](size_t, const std::string& data) {
+                  record_thread();
+                  received += data;  // Only touched from the application thread
+                })
+                .build();
+  server_->start();
+
+  client_ = unilink::tcp_client("127.0.0.1", port_)
+                .executor(ioc_)
+                .retry_interval(100)
+                .on_connect([this, &client_connected] {
+                  record_thread();
+                  client_connected = true;
+                })
+                .build();
+  client_->start();
+
+  ASSERT_TRUE(TestUtils::waitForCondition([&] { return client_connected.load(); }));
+  client_->send("ping");
+
+  // Read the result on the application thread, like an application handler would
+  ASSERT_TRUE(TestUtils::waitForCondition([&] {
+    std::promise<bool> done;
+    net::post(ioc_, [&] { done.set_value(received == "ping"); });
+    return done.get_future().get();
+  }));
+
+  EXPECT_EQ(callback_threads(), std::set<std::thread::id>{app_thread_.get_id()});
+  EXPECT_FALSE(common::IoContextManager::instance().is_running()) << "Executor must not start the global context";
+}
+
+/**
+ * @brief Channels built from a pool are spread over its contexts
+ */
+TEST_F(BuilderExecutorTest, PoolExecutorSpreadsChannels) {
+  common::IoContextPool pool(2);
+  pool.start();
+
+  std::set<std::thread::id> pool_threads;
+  for (size_t i = 0; i < pool.size(); ++i) {
+    std::promise<std::thread::id> id;
+    net::post(pool.get_context(i), [&id] { id.set_value(std::this_thread::get_id()); });
+    pool_threads.insert(id.get_future().get());
+  }
+
+  std::atomic<bool> client_connected{false};
+  server_ = unilink::tcp_server(port_)
+                .single_client()
+                .executor(pool)
+                .on_multi_connect([this](size_t, const std::string&) { record_thread(); })
+                .build();
+  server_->start();
+
+  client_ = unilink::tcp_client("127.0.0.1", port_)
+                .executor(pool)
+                .retry_interval(100)
+                .on_connect([this, &client_connected] {
+                  record_thread();
+                  client_connected = true;
+                })
+                .build();
+  client_->start();
+
+  ASSERT_TRUE(TestUtils::waitForCondition([&] { return client_connected.load() && server_->get_client_count() == 1; }));
+  EXPECT_EQ(callback_threads(), pool_threads);
+
+  client_->stop();
+  server_->stop();
+  client_.reset();
+  server_.reset();
+  pool.stop();
+}
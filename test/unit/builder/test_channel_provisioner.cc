@@ -0,0 +1,177 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include "test_utils.hpp"
+#include "unilink/common/exceptions.hpp"
+#include "unilink/common/io_context_pool.hpp"
+#include "unilink/config/config_manager.hpp"
+#include "unilink/factory/channel_provisioner.hpp"
+
+using namespace unilink;
+using namespace std::chrono_literals;
+using unilink::test::TestUtils;
+
+class ChannelProvisionerTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    for (auto& result : report_.channels) {
+      if (result.channel) result.channel->stop();
+    }
+    report_.channels.clear();
+    pool_.stop();
+  }
+
+  common::IoContextPool pool_{4};
+  factory::ProvisionReport report_;
+  std::atomic<int> connected_{0};  // Outlives the callbacks, which may fire until TearDown stops the channels
+};
+
+/**
+ * @brief Test parsing of a declarative fleet file
+ */
+TEST_F(ChannelProvisionerTest, LoadFileParsesAllChannelTypes) {
+  auto path = std::filesystem::temp_directory_path() / "unilink_channels_test.conf";
+  {
+    std::ofstream file(path);
+    file << "# gateway fleet\n"
+         << "channels.upstream.type=tcp_client\n"
+         << "channels.upstream.host=10.0.0.5\n"
+         << "channels.upstream.port=5000\n"
+         << "channels.upstream.retry_interval_ms=250\n"
+         << "channels.listener.type=tcp_server\n"
+         << "channels.listener.port=9100\n"
+         << "channels.listener.max_connections=8\n"
+         << "channels.tty0.type=serial\n"
+         << "channels.tty0.device=/dev/ttyS0\n"
+         << "channels.tty0.baud_rate=9600\n"
+         << "channels.tty0.parity=even\n"
+         << "unrelated.key=1\n";
+  }
+
+  auto specs = factory::ChannelProvisioner::load_file(path.string());
+  std::filesystem::remove(path);
+  ASSERT_EQ(specs.size(), 3u);
+
+  // Specs are ordered by name
+  EXPECT_EQ(specs[0].name, "listener");
+  const auto& server = std::get<config::TcpServerConfig>(specs[0].options);
+  EXPECT_EQ(server.port, 9100);
+  EXPECT_EQ(server.max_connections, 8);
+
+  EXPECT_EQ(specs[1].name, "tty0");
+  const auto& serial = std::get<config::SerialConfig>(specs[1].options);
+  EXPECT_EQ(serial.device, "/dev/ttyS0");
+  EXPECT_EQ(serial.baud_rate, 9600u);
+  EXPECT_EQ(serial.parity, config::SerialConfig::Parity::Even);
+
+  EXPECT_EQ(specs[2].name, "upstream");
+  const auto& client = std::get<config::TcpClientConfig>(specs[2].options);
+  EXPECT_EQ(client.host, "10.0.0.5");
+  EXPECT_EQ(client.port, 5000);
+  EXPECT_EQ(client.retry_interval_ms, 250u);
+}
+
+/**
+ * @brief Test that invalid channel descriptions are rejected with the channel name
+ */
+TEST_F(ChannelProvisionerTest, ParseRejectsInvalidChannels) {
+  auto parse_with = [](const std::string& key, const std::any& value) {
+    config::ConfigManager config;
+    config.set("channels.bad.type", std::string("tcp_client"));
+    config.set(key, value);
+    return factory::ChannelProvisioner::parse(config);
+  };
+
+  EXPECT_THROW(parse_with("channels.bad.type", std::string("carrier_pigeon")), common::ConfigurationException);
+  EXPECT_THROW(parse_with("channels.bad.prot", 80), common::ConfigurationException);
+  EXPECT_THROW(parse_with("channels.bad.port", 70000), common::ConfigurationException);
+  EXPECT_THROW(parse_with("channels.bad.retry_interval_ms", std::string("soon")), common::ConfigurationException);
+  EXPECT_NO_THROW(parse_with("channels.bad.port", 8080));
+}
+
+/**
+ * @brief Test that provisioned channels share the pool and talk to each other
+ */
+TEST_F(ChannelProvisionerTest, ProvisionedChannelsRunOnSharedPool) {
+  uint16_t port = TestUtils::getAvailableTestPort();
+  config::TcpServerConfig server_cfg;
+  server_cfg.port = port;
+
+  std::vector<factory::ChannelSpec> specs;
+  specs.push_back({"server", server_cfg});
+  for (int i = 0; i < 16; ++i) {
+    config::TcpClientConfig client_cfg;
+    client_cfg.host = "127.0.0.1";
+    client_cfg.port = port;
+    client_cfg.retry_interval_ms = 100;
+    specs.push_back({"client" + std::to_string(i), client_cfg});
+  }
+
+  factory::ChannelProvisioner provisioner(pool_);
+  report_ = provisioner.provision(specs, [&](const std::string& name, interface::Channel& channel) {
+    if (name == "server") return;
+    channel.on_state([&](common::LinkState state) {
+      if (state == common::LinkState::Connected) connected_++;
+    });
+  });
+
+  ASSERT_EQ(report_.channels.size(), specs.size());
+  EXPECT_EQ(report_.failed, 0u);
+  for (const auto& result : report_.channels) {
+    EXPECT_TRUE(result.ok()) << result.name << ": " << result.error;
+    EXPECT_LE(result.startup_latency, report_.total_time);
+  }
+  EXPECT_LE(report_.latency_percentile(50), report_.latency_percentile(99));
+
+  // Clients retry until the server is bound, then every one of them connects
+  auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (connected_.load() < 16 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_EQ(connected_.load(), 16);
+}
+
+/**
+ * @brief Test that provisioning from a pool thread is refused instead of deadlocking
+ */
+TEST_F(ChannelProvisionerTest, ProvisionFromPoolThreadThrows) {
+  pool_.start();
+  factory::ChannelProvisioner provisioner(pool_);
+  std::promise<bool> threw;
+  boost::asio::post(pool_.get_context(0), [&] {
+    try {
+      provisioner.provision({});
+      threw.set_value(false);
+    } catch (const std::logic_error&) {
+      threw.set_value(true);
+    }
+  });
+  auto result = threw.get_future();
+  ASSERT_EQ(result.wait_for(5s), std::future_status::ready);
+  EXPECT_TRUE(result.get());
+}
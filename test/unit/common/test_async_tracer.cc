@@ -0,0 +1,188 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test_utils.hpp"
+#include "unilink/common/async_tracer.hpp"
+#include "unilink/common/io_context_manager.hpp"
+#include "unilink/transport/tcp_client/tcp_client.hpp"
+#include "unilink/transport/tcp_server/tcp_server.hpp"
+
+using namespace unilink;
+using namespace unilink::common;
+using namespace std::chrono_literals;
+using unilink::test::TestUtils;
+using Track = AsyncTracer::Track;
+
+namespace {
+
+constexpr size_t kCapacity = 1024;
+
+size_t count_of(const std::string& text, const std::string& needle) {
+  size_t count = 0;
+  for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + needle.size())) {
+    ++count;
+  }
+  return count;
+}
+
+}  // namespace
+
+class AsyncTracerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    tracer_.enable(kCapacity);
+    tracer_.clear();
+  }
+
+  void TearDown() override { tracer_.disable(); }
+
+  std::string dump(size_t* events = nullptr) {
+    std::ostringstream out;
+    size_t n = tracer_.dump(out);
+    if (events) *events = n;
+    return out.str();
+  }
+
+  AsyncTracer& tracer_ = AsyncTracer::instance();
+  int writers_marker_[4] = {};
+};
+
+TEST_F(AsyncTracerTest, DisabledRecordsNothing) {
+  int channel = 0;
+  tracer_.disable();
+  EXPECT_FALSE(AsyncTracer::enabled());
+  tracer_.begin(&channel, Track::Read, "read");
+  tracer_.counter(&channel, "queued_bytes", 1);
+
+  tracer_.enable(kCapacity);
+  size_t events = 0;
+  dump(&events);
+  EXPECT_EQ(events, 0u);
+  EXPECT_EQ(tracer_.capacity(), kCapacity);
+}
+
+TEST_F(AsyncTracerTest, WritesChromeTraceEvents) {
+  int client = 0;
+  int session = 0;
+  tracer_.name_channel(&client, "client \"a\"");
+  tracer_.begin(&client, Track::Lifecycle, "connect");
+  tracer_.end(&client, Track::Lifecycle, "connect");
+  tracer_.counter(&client, "queued_bytes", 42);
+  tracer_.begin(&session, Track::Write, "write");
+
+  size_t events = 0;
+  std::string json = dump(&events);
+  EXPECT_EQ(events, 4u);
+  EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0u);
+  EXPECT_NE(json.find("\"args\":{\"name\":\"client \\\"a\\\" 0x"), std::string::npos);
+  EXPECT_NE(json.find("\"args\":{\"name\":\"channel 0x"), std::string::npos);
+  EXPECT_EQ(count_of(json, "\"name\":\"thread_name\""), 6u);  // Three tracks per channel
+  EXPECT_NE(json.find("\"name\":\"connect\",\"cat\":\"unilink\",\"ph\":\"B\""), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"connect\",\"cat\":\"unilink\",\"ph\":\"E\""), std::string::npos);
+  EXPECT_NE(json.find("\"args\":{\"queued_bytes\":42}"), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"B\",\"ts\":"), std::string::npos);
+  EXPECT_NE(json.find("\"pid\":2,\"tid\":2"), std::string::npos);  // Second channel, write track
+  EXPECT_EQ(count_of(json, "{"), count_of(json, "}"));
+
+  tracer_.clear();
+  dump(&events);
+  EXPECT_EQ(events, 0u);
+}
+
+TEST_F(AsyncTracerTest, KeepsNewestEventsWhenFull) {
+  int channel = 0;
+  for (uint64_t i = 0; i < kCapacity + 100; ++i) tracer_.counter(&channel, "value", i);
+
+  size_t events = 0;
+  std::string json = dump(&events);
+  EXPECT_EQ(events, kCapacity);
+  EXPECT_EQ(json.find("\"value\":99}"), std::string::npos);
+  EXPECT_NE(json.find("\"value\":100}"), std::string::npos);
+  EXPECT_NE(json.find("\"value\":" + std::to_string(kCapacity + 99) + "}"), std::string::npos);
+}
+
+TEST_F(AsyncTracerTest, ConcurrentWritersAndDumps) {
+  constexpr int kThreads = 4;
+  constexpr int kEventsPerThread = 20000;
+  std::atomic<bool> done{false};
+  std::vector<std::thread> writers;
+  for (int t = 0; t < kThreads; ++t) {
+    writers.emplace_back([this, t] {
+      for (int i = 0; i < kEventsPerThread; ++i) {
+        tracer_.begin(&writers_marker_[t], Track::Read, "read");
+        tracer_.end(&writers_marker_[t], Track::Read, "read");
+      }
+    });
+  }
+  std::thread reader([this, &done] {
+    while (!done.load()) {
+      size_t events = 0;
+      dump(&events);
+      EXPECT_LE(events, kCapacity);
+    }
+  });
+  for (auto& writer : writers) writer.join();
+  done = true;
+  reader.join();
+
+  size_t events = 0;
+  dump(&events);
+  EXPECT_EQ(events, kCapacity);
+}
+
+TEST_F(AsyncTracerTest, TcpLoopbackTimeline) {
+  if (!IoContextManager::instance().is_running()) IoContextManager::instance().start();
+
+  auto port = TestUtils::getAvailableTestPort();
+  config::TcpServerConfig server_cfg;
+  server_cfg.port = port;
+  auto server = std::make_shared<transport::TcpServer>(server_cfg);
+  std::atomic<size_t> received{0};
+  server->on_bytes([&received](const uint8_t*, size_t n) { received += n; });
+  server->start();
+
+  config::TcpClientConfig client_cfg;
+  client_cfg.host = "127.0.0.1";
+  client_cfg.port = port;
+  client_cfg.retry_interval_ms = 50;
+  auto client = std::make_shared<transport::TcpClient>(client_cfg, IoContextManager::instance().get_context());
+  client->start();
+  ASSERT_TRUE(TestUtils::waitForCondition([&] { return client->is_connected() && server->get_client_count() == 1; }));
+
+  const std::vector<uint8_t> payload(32, 0x11);
+  for (int i = 0; i < 10; ++i) client->async_write_copy(payload.data(), payload.size());
+  ASSERT_TRUE(TestUtils::waitForCondition([&] { return received.load() == 10 * payload.size(); }));
+
+  std::string json = dump();
+  for (const char* name : {"\"name\":\"resolve\"", "\"name\":\"connect\"", "\"name\":\"accept\"", "\"name\":\"read\"",
+                           "\"name\":\"write\"", "\"queued_bytes\":", "tcp_client 127.0.0.1:", "tcp_session 0 ",
+                           "tcp_server :"}) {
+    EXPECT_NE(json.find(name), std::string::npos) << name;
+  }
+
+  client->stop();
+  server->stop();
+}
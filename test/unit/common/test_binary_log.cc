@@ -0,0 +1,213 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+#include "unilink/common/binary_log.hpp"
+#include "unilink/common/logger.hpp"
+
+using namespace unilink::common;
+using unilink::test::TestUtils;
+
+/**
+ * @brief Binary log writer, decoder and Logger binary mode tests
+ */
+class BinaryLogTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto now = std::chrono::system_clock::now().time_since_epoch().count();
+    test_dir_ = TestUtils::makeTempFilePath("unilink_binary_log_test_" + std::to_string(now));
+    std::filesystem::create_directories(test_dir_);
+    log_file_ = (test_dir_ / "app.ulog").string();
+  }
+
+  void TearDown() override {
+    Logger::instance().set_binary_output("");
+    Logger::instance().set_level(LogLevel::INFO);
+    std::error_code ec;
+    std::filesystem::remove_all(test_dir_, ec);
+  }
+
+  std::vector<DecodedRecord> decode(const std::string& path) {
+    std::vector<DecodedRecord> records;
+    std::string error;
+    EXPECT_TRUE(BinaryLogReader::decode_file(
+        path, [&records](const DecodedRecord& record) { records.push_back(record); }, &error))
+        << error;
+    return records;
+  }
+
+  std::filesystem::path test_dir_;
+  std::string log_file_;
+};
+
+TEST_F(BinaryLogTest, RenderSubstitutesArguments) {
+  binary_log::ArgBuffer buffer;
+  binary_log::encode_args(buffer, 42, std::string("peer"), true, -7, 2u);
+  EXPECT_EQ(binary_log::render("{} bytes to {} ok={} delta={} retries={}", buffer.data(), buffer.size()),
+            "42 bytes to peer ok=true delta=-7 retries=2");
+  EXPECT_EQ(binary_log::render("missing {} {}", buffer.data(), 0), "missing {} {}");
+}
+
+TEST_F(BinaryLogTest, WriterRoundTrip) {
+  auto& registry = ComponentRegistry::instance();
+  FormatId format = registry.register_format("sent {} bytes");
+
+  BinaryLogWriter writer;
+  ASSERT_TRUE(writer.open(log_file_));
+
+  binary_log::ArgBuffer buffer;
+  binary_log::encode_args(buffer, 128);
+  EXPECT_TRUE(writer.write(static_cast<uint8_t>(LogLevel::WARNING), component::TCP_CLIENT,
+                           registry.register_operation("write"), format, buffer.data(), buffer.size()));
+  writer.close();
+
+  auto records = decode(log_file_);
+  ASSERT_EQ(records.size(), 1u);
+  EXPECT_EQ(records[0].component, "tcp_client");
+  EXPECT_EQ(records[0].operation, "write");
+  EXPECT_EQ(records[0].message, "sent 128 bytes");
+  EXPECT_EQ(records[0].level, static_cast<uint8_t>(LogLevel::WARNING));
+  EXPECT_GT(records[0].timestamp_ns, 0u);
+}
+
+TEST_F(BinaryLogTest, WriterRotatesSegments) {
+  auto& registry = ComponentRegistry::instance();
+  FormatId format = registry.register_format("payload {}");
+  OperationId operation = registry.register_operation("rotate");
+
+  BinaryLogWriter writer;
+  ASSERT_TRUE(writer.open(log_file_, BinaryLogConfig(64 * 1024, 2)));
+
+  binary_log::ArgBuffer buffer;
+  binary_log::encode_args(buffer, std::string(512, 'x'));
+  for (int i = 0; i < 1000; ++i) {
+    writer.write(static_cast<uint8_t>(LogLevel::INFO), component::SERIAL, operation, format, buffer.data(),
+                 buffer.size());
+  }
+  writer.close();
+
+  EXPECT_EQ(writer.records_written(), 1000u);
+  EXPECT_EQ(writer.records_dropped(), 0u);
+
+  // Only max_files rotated segments are kept, and every segment decodes on its own
+  size_t segments = 0;
+  size_t records = 0;
+  for (const auto& entry : std::filesystem::directory_iterator(test_dir_)) {
+    ++segments;
+    for (const auto& record : decode(entry.path().string())) {
+      EXPECT_EQ(record.component, "serial");
+      ++records;
+    }
+  }
+  EXPECT_EQ(segments, 3u);
+  EXPECT_GT(records, 0u);
+  EXPECT_LT(records, 1000u);
+}
+
+TEST_F(BinaryLogTest, LoggerBinaryMode) {
+  Logger::instance().set_level(LogLevel::DEBUG);
+  Logger::instance().set_binary_output(log_file_);
+  ASSERT_TRUE(Logger::instance().is_binary_output_enabled());
+
+  UNILINK_LOG_INFO("tcp_server", "accept", "plain message");
+  UNILINK_LOG_FMT(LogLevel::ERROR, "tcp_server", "accept", "client {} rejected: {}", 3, "limit reached");
+  Logger::instance().set_binary_output("");
+
+  auto records = decode(log_file_);
+  ASSERT_EQ(records.size(), 2u);
+  EXPECT_EQ(records[0].message, "plain message");
+  EXPECT_EQ(records[1].message, "client 3 rejected: limit reached");
+  EXPECT_EQ(records[1].level, static_cast<uint8_t>(LogLevel::ERROR));
+}
+
+TEST_F(BinaryLogTest, LongPlainMessageIsKeptWhole) {
+  std::string message(8 * 1024, 'm');
+  Logger::instance().set_level(LogLevel::DEBUG);
+  Logger::instance().set_binary_output(log_file_);
+  UNILINK_LOG_INFO("tcp_server", "accept", message);
+  Logger::instance().set_binary_output("");
+
+  auto records = decode(log_file_);
+  ASSERT_EQ(records.size(), 1u);
+  EXPECT_EQ(records[0].message, message);
+  EXPECT_FALSE(records[0].truncated);
+}
+
+TEST_F(BinaryLogTest, OversizedRecordsAreMarkedTruncated) {
+  auto& registry = ComponentRegistry::instance();
+  FormatId format = registry.register_format("{}");
+  OperationId operation = registry.register_operation("oversize");
+
+  BinaryLogWriter writer;
+  ASSERT_TRUE(writer.open(log_file_, BinaryLogConfig(64 * 1024, 2)));
+  EXPECT_TRUE(writer.write_message(static_cast<uint8_t>(LogLevel::INFO), component::SERIAL, operation, format,
+                                   std::string(128 * 1024, 'x')));
+
+  binary_log::ArgBuffer buffer;
+  binary_log::encode_args(buffer, std::string(2 * binary_log::MAX_ARGS_SIZE, 'y'));
+  EXPECT_TRUE(buffer.truncated());
+  EXPECT_TRUE(writer.write(static_cast<uint8_t>(LogLevel::INFO), component::SERIAL, operation, format, buffer.data(),
+                           buffer.size(), buffer.truncated()));
+  writer.close();
+
+  size_t records = 0;
+  for (const auto& entry : std::filesystem::directory_iterator(test_dir_)) {
+    for (const auto& record : decode(entry.path().string())) {
+      EXPECT_TRUE(record.truncated);
+      EXPECT_FALSE(record.message.empty());
+      EXPECT_LT(record.message.size(), 64u * 1024u);
+      ++records;
+    }
+  }
+  EXPECT_EQ(records, 2u);
+  EXPECT_EQ(writer.records_dropped(), 0u);
+}
+
+TEST_F(BinaryLogTest, FormatMacroRendersTextWithoutBinaryMode) {
+  std::vector<std::string> messages;
+  Logger::instance().set_level(LogLevel::DEBUG);
+  Logger::instance().set_format("{message}");
+  Logger::instance().set_callback(
+      [&messages](LogLevel, const std::string& formatted) { messages.push_back(formatted); });
+  Logger::instance().set_outputs(static_cast<int>(LogOutput::CALLBACK));
+
+  UNILINK_LOG_FMT(LogLevel::INFO, "serial", "read", "read {} bytes", 16);
+
+  Logger::instance().set_callback(nullptr);
+  Logger::instance().set_outputs(static_cast<int>(LogOutput::CONSOLE));
+  Logger::instance().set_format("{timestamp} [{level}] [{component}] [{operation}] {message}");
+
+  ASSERT_EQ(messages.size(), 1u);
+  EXPECT_EQ(messages[0], "read 16 bytes");
+}
+
+TEST_F(BinaryLogTest, DecoderRejectsForeignFiles) {
+  {
+    std::ofstream file(log_file_);
+    file << "not a binary log";
+  }
+  std::string error;
+  EXPECT_FALSE(BinaryLogReader::decode_file(log_file_, [](const DecodedRecord&) {}, &error));
+  EXPECT_FALSE(error.empty());
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test_utils.hpp"
+#include "unilink/common/channel_metrics.hpp"
+#include "unilink/common/io_context_manager.hpp"
+#include "unilink/transport/tcp_client/tcp_client.hpp"
+#include "unilink/transport/tcp_server/tcp_server.hpp"
+
+using namespace unilink;
+using namespace unilink::common;
+using namespace std::chrono_literals;
+using unilink::test::TestUtils;
+
+TEST(LatencyHistogramTest, BucketsBoundValuesWithinPrecision) {
+  std::vector<uint64_t> values = {0, 1, 7, 8, 9, 15, 16, 17, 100, 1000, 123456, 1ull << 40, UINT64_MAX};
+  for (uint64_t value : values) {
+    size_t index = LatencyHistogram::bucket_index(value);
+    ASSERT_LT(index, LatencyHistogram::kBucketCount) << value;
+    uint64_t upper = LatencyHistogram::bucket_upper_bound(index);
+    EXPECT_GE(upper, value);
+    EXPECT_LE(static_cast<double>(upper - value), static_cast<double>(value) * 0.125 + 1.0) << value;
+  }
+
+  // Indices never go backwards as values grow
+  size_t previous = 0;
+  for (uint64_t value = 0; value < 100000; value += 7) {
+    size_t index = LatencyHistogram::bucket_index(value);
+    EXPECT_GE(index, previous);
+    previous = index;
+  }
+}
+
+TEST(LatencyHistogramTest, PercentilesTrackRecordedValues) {
+  LatencyHistogram histogram;
+  for (uint64_t value = 1; value <= 1000; ++value) {
+    histogram.record(value * 1000);
+  }
+
+  auto snap = histogram.snapshot();
+  EXPECT_EQ(snap.count, 1000u);
+  EXPECT_EQ(snap.max, 1000000u);
+  EXPECT_DOUBLE_EQ(snap.mean(), 500500.0);
+  EXPECT_NEAR(static_cast<double>(snap.percentile(50)), 500000.0, 500000.0 * 0.125);
+  EXPECT_NEAR(static_cast<double>(snap.percentile(99)), 990000.0, 990000.0 * 0.125);
+  EXPECT_EQ(snap.percentile(100), 1000000u);
+
+  histogram.reset();
+  EXPECT_EQ(histogram.snapshot().count, 0u);
+  EXPECT_EQ(histogram.snapshot().percentile(50), 0u);
+}
+
+TEST(LatencyHistogramTest, ConcurrentRecordAndSnapshot) {
+  LatencyHistogram histogram;
+  constexpr uint64_t kSamples = 200000;
+
+  std::thread writer([&] {
+    for (uint64_t i = 0; i < kSamples; ++i) histogram.record(i % 5000);
+  });
+  uint64_t last = 0;
+  while (last < kSamples) {
+    uint64_t count = histogram.snapshot().count;
+    EXPECT_GE(count, last);  // Snapshots never run backwards
+    last = count;
+    if (count == kSamples) break;
+    std::this_thread::yield();
+  }
+  writer.join();
+  EXPECT_EQ(histogram.snapshot().count, kSamples);
+}
+
+TEST(ChannelMetricsTest, QueueGaugeAndCounters) {
+  if (!ChannelMetrics::enabled) GTEST_SKIP() << "Built without UNILINK_ENABLE_METRICS";
+
+  ChannelMetrics metrics;
+  metrics.record_enqueue(100);
+  metrics.record_enqueue(50);
+  metrics.record_backpressure();
+  auto started = ChannelMetrics::now();
+  metrics.record_dequeue(100);
+  metrics.record_write(100, started);
+  metrics.record_read(42);
+
+  auto snap = metrics.snapshot();
+  EXPECT_EQ(snap.queue_bytes, 50u);
+  EXPECT_EQ(snap.queue_high_watermark, 150u);
+  EXPECT_EQ(snap.backpressure_events, 1u);
+  EXPECT_EQ(snap.bytes_out, 100u);
+  EXPECT_EQ(snap.messages_out, 1u);
+  EXPECT_EQ(snap.bytes_in, 42u);
+  EXPECT_EQ(snap.messages_in, 1u);
+  EXPECT_EQ(snap.write_latency_ns.count, 1u);
+
+  // reset() clears totals but keeps the live queue gauge
+  metrics.reset();
+  snap = metrics.snapshot();
+  EXPECT_EQ(snap.bytes_out, 0u);
+  EXPECT_EQ(snap.write_latency_ns.count, 0u);
+  EXPECT_EQ(snap.queue_bytes, 50u);
+}
+
+TEST(FastClockTest, ConvertsTicksToNanoseconds) {
+  FastClock::calibrate();
+  uint64_t start = FastClock::now();
+  auto wall_start = std::chrono::steady_clock::now();
+  std::this_thread::sleep_for(20ms);
+  uint64_t ticks = FastClock::now() - start;
+  auto wall = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - wall_start);
+
+  double wall_ns = static_cast<double>(wall.count());
+  EXPECT_NEAR(static_cast<double>(FastClock::to_ns(ticks)), wall_ns, wall_ns * 0.1);
+}
+
+TEST(TxLatencyTrackerTest, SkipsEntriesQueuedBeforeEnabling) {
+  if (!ChannelMetrics::enabled) GTEST_SKIP() << "Built without UNILINK_ENABLE_METRICS";
+  ChannelMetrics metrics;
+  TxLatencyTracker tracker;
+
+  // Disabled: nothing is stored or recorded
+  tracker.on_enqueue();
+  tracker.on_complete(metrics);
+  EXPECT_FALSE(tracker.enabled());
+  EXPECT_EQ(metrics.snapshot().queue_latency_ns.count, 0u);
+
+  // Two entries were already queued when tracking started
+  tracker.set_enabled(true, 2);
+  tracker.on_enqueue();
+  tracker.on_complete(metrics);
+  tracker.on_complete(metrics);
+  EXPECT_EQ(metrics.snapshot().queue_latency_ns.count, 0u);
+  tracker.on_complete(metrics);
+  EXPECT_EQ(metrics.snapshot().queue_latency_ns.count, 1u);
+
+  // A dropped queue drops its stamps too
+  tracker.on_enqueue();
+  tracker.clear();
+  tracker.on_complete(metrics);
+  EXPECT_EQ(metrics.snapshot().queue_latency_ns.count, 1u);
+
+  tracker.set_enabled(false, 0);
+  tracker.on_enqueue();
+  tracker.on_complete(metrics);
+  EXPECT_EQ(metrics.snapshot().queue_latency_ns.count, 1u);
+}
+
+TEST(ChannelMetricsTest, TcpLoopbackCountsBothEnds) {
+  if (!ChannelMetrics::enabled) GTEST_SKIP() << "Built without UNILINK_ENABLE_METRICS";
+  if (!IoContextManager::instance().is_running()) IoContextManager::instance().start();
+
+  auto port = TestUtils::getAvailableTestPort();
+  config::TcpServerConfig server_cfg;
+  server_cfg.port = port;
+  auto server = std::make_shared<transport::TcpServer>(server_cfg);
+  server->on_bytes([](const uint8_t*, size_t) {});
+  server->start();
+
+  config::TcpClientConfig client_cfg;
+  client_cfg.host = "127.0.0.1";
+  client_cfg.port = port;
+  client_cfg.retry_interval_ms = 50;
+  auto client = std::make_shared<transport::TcpClient>(client_cfg, IoContextManager::instance().get_context());
+  client->start();
+  ASSERT_TRUE(TestUtils::waitForCondition([&] { return client->is_connected() && server->get_client_count() == 1; }));
+
+  client->set_tx_latency_tracking(true);
+  constexpr size_t kMessages = 100;
+  const std::vector<uint8_t> payload(64, 0x5A);
+  for (size_t i = 0; i < kMessages; ++i) client->async_write_copy(payload.data(), payload.size());
+
+  const uint64_t total = kMessages * payload.size();
+  ASSERT_TRUE(TestUtils::waitForCondition([&] { return server->metrics().bytes_in == total; }));
+
+  auto sent = client->metrics();
+  EXPECT_EQ(sent.bytes_out, total);
+  EXPECT_EQ(sent.messages_out, kMessages);
+  EXPECT_EQ(sent.queue_bytes, 0u);
+  EXPECT_GE(sent.queue_high_watermark, payload.size());
+  EXPECT_EQ(sent.connects, 1u);
+  EXPECT_EQ(sent.write_latency_ns.count, kMessages);
+  EXPECT_GT(sent.write_latency_ns.percentile(50), 0u);
+  EXPECT_EQ(sent.queue_latency_ns.count, kMessages);
+  EXPECT_GE(sent.queue_latency_ns.percentile(99.9), sent.queue_latency_ns.percentile(50));
+
+  auto received = server->metrics();
+  EXPECT_EQ(received.accepted, 1u);
+  EXPECT_EQ(received.rejected, 0u);
+  EXPECT_GE(received.messages_in, 1u);
+
+  client->stop();
+  EXPECT_TRUE(TestUtils::waitForCondition([&] { return server->metrics().disconnects == 1; }));
+  server->stop();
+}
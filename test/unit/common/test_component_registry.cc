@@ -0,0 +1,200 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <boost/asio/error.hpp>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "test_utils.hpp"
+#include "unilink/common/component_registry.hpp"
+#include "unilink/common/error_handler.hpp"
+#include "unilink/common/logger.hpp"
+
+using namespace unilink::common;
+using unilink::test::TestUtils;
+
+/**
+ * @brief Component registry and per-component log level tests
+ */
+class ComponentRegistryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto now = std::chrono::system_clock::now().time_since_epoch().count();
+    test_log_file_ = TestUtils::makeTempFilePath("unilink_component_level_test_" + std::to_string(now) + ".log");
+    TestUtils::removeFileIfExists(test_log_file_);
+
+    Logger::instance().set_enabled(true);
+    Logger::instance().set_console_output(false);
+    Logger::instance().set_file_output(test_log_file_.string());
+    ErrorHandler::instance().reset_stats();
+  }
+
+  void TearDown() override {
+    Logger::instance().clear_component_levels();
+    Logger::instance().set_level(LogLevel::INFO);
+    Logger::instance().set_file_output("");
+    TestUtils::removeFileIfExists(test_log_file_);
+    ErrorHandler::instance().reset_stats();
+  }
+
+  std::string read_log() {
+    Logger::instance().flush();
+    std::ifstream file(test_log_file_);
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  }
+
+  std::filesystem::path test_log_file_;
+};
+
+TEST_F(ComponentRegistryTest, BuiltInComponentsHaveStableIds) {
+  auto& registry = ComponentRegistry::instance();
+  EXPECT_EQ(registry.find_component("tcp_server"), component::TCP_SERVER);
+  EXPECT_EQ(registry.find_component("tcp_client"), component::TCP_CLIENT);
+  EXPECT_EQ(registry.find_component("serial"), component::SERIAL);
+  EXPECT_EQ(registry.component_name(component::MEMORY_TRACKER), "memory_tracker");
+}
+
+TEST_F(ComponentRegistryTest, InterningIsIdempotent) {
+  auto& registry = ComponentRegistry::instance();
+  ComponentId id = registry.register_component("registry_test_component");
+  EXPECT_EQ(registry.register_component(std::string("registry_test_component")), id);
+  EXPECT_EQ(registry.component_name(id), "registry_test_component");
+
+  OperationId op = registry.register_operation("registry_test_operation");
+  EXPECT_EQ(registry.register_operation("registry_test_operation"), op);
+  EXPECT_EQ(registry.operation_name(op), "registry_test_operation");
+}
+
+TEST_F(ComponentRegistryTest, UnknownComponentIsNotRegisteredByLookup) {
+  auto& registry = ComponentRegistry::instance();
+  size_t count = registry.component_count();
+  EXPECT_EQ(registry.find_component("never_registered_component"), ComponentRegistry::INVALID_COMPONENT);
+  EXPECT_EQ(registry.component_count(), count);
+  EXPECT_EQ(registry.component_name(ComponentRegistry::INVALID_COMPONENT), "unknown");
+}
+
+TEST_F(ComponentRegistryTest, LoggingWithOverridesDoesNotRegisterComponents) {
+  auto& registry = ComponentRegistry::instance();
+  Logger::instance().set_level(LogLevel::INFO);
+  Logger::instance().set_component_level(component::SERIAL, LogLevel::ERROR);
+  size_t count = registry.component_count();
+
+  Logger::instance().info("registry_test_unlisted", "log", "unlisted component uses global level");
+  EXPECT_EQ(registry.find_component("registry_test_unlisted"), ComponentRegistry::INVALID_COMPONENT);
+  EXPECT_EQ(registry.component_count(), count);
+  EXPECT_NE(read_log().find("unlisted component uses global level"), std::string::npos);
+
+  // A level set after the first lookup still applies on the same thread
+  EXPECT_TRUE(Logger::instance().set_component_level("registry_test_unlisted", LogLevel::ERROR));
+  Logger::instance().info("registry_test_unlisted", "log", "unlisted component now silenced");
+  EXPECT_EQ(read_log().find("unlisted component now silenced"), std::string::npos);
+}
+
+TEST_F(ComponentRegistryTest, OverflowSlotRejectsLevelOverride) {
+  Logger::instance().set_level(LogLevel::INFO);
+  EXPECT_FALSE(Logger::instance().set_component_level(ComponentRegistry::OVERFLOW_COMPONENT, LogLevel::DEBUG));
+  EXPECT_FALSE(Logger::instance().set_component_level(ComponentRegistry::INVALID_COMPONENT, LogLevel::DEBUG));
+  EXPECT_FALSE(Logger::instance().should_log(LogLevel::DEBUG, ComponentRegistry::OVERFLOW_COMPONENT));
+  EXPECT_TRUE(Logger::instance().set_component_level(component::TCP_CLIENT, LogLevel::DEBUG));
+}
+
+TEST_F(ComponentRegistryTest, RuntimeCharBufferTagIsNotFrozen) {
+  char buffer[32];
+  static_assert(is_static_log_tag_v<decltype("tcp_client"), decltype("connect")>);
+  static_assert(!is_log_tag_literal_v<decltype(buffer)>);
+
+  Logger::instance().set_level(LogLevel::INFO);
+  for (const char* name : {"registry_buffer_first", "registry_buffer_second"}) {
+    std::snprintf(buffer, sizeof(buffer), "%s", name);
+    UNILINK_LOG_INFO(buffer, "log", std::string("message from ") + name);
+  }
+
+  std::string content = read_log();
+  EXPECT_NE(content.find("[registry_buffer_first] [log] message from registry_buffer_first"), std::string::npos);
+  EXPECT_NE(content.find("[registry_buffer_second] [log] message from registry_buffer_second"), std::string::npos);
+}
+
+TEST_F(ComponentRegistryTest, ComponentLevelOverridesGlobalLevel) {
+  Logger::instance().set_level(LogLevel::WARNING);
+  Logger::instance().set_component_level("tcp_client", LogLevel::DEBUG);
+
+  EXPECT_TRUE(Logger::instance().should_log(LogLevel::DEBUG, component::TCP_CLIENT));
+  EXPECT_FALSE(Logger::instance().should_log(LogLevel::DEBUG, component::TCP_SERVER));
+  EXPECT_EQ(Logger::instance().get_component_level(component::TCP_SERVER), LogLevel::WARNING);
+
+  UNILINK_LOG_DEBUG("tcp_client", "connect", "client debug visible");
+  UNILINK_LOG_DEBUG("tcp_server", "accept", "server debug hidden");
+
+  std::string content = read_log();
+  EXPECT_NE(content.find("client debug visible"), std::string::npos);
+  EXPECT_EQ(content.find("server debug hidden"), std::string::npos);
+}
+
+TEST_F(ComponentRegistryTest, ComponentLevelCanSilenceNoisyComponent) {
+  Logger::instance().set_level(LogLevel::DEBUG);
+  Logger::instance().set_component_level(component::SERIAL, LogLevel::ERROR);
+
+  UNILINK_LOG_INFO("serial", "read", "serial info hidden");
+  std::string dynamic_component = "serial";
+  Logger::instance().info(dynamic_component, "read", "dynamic serial info hidden");
+  UNILINK_LOG_INFO("tcp_client", "read", "client info visible");
+
+  std::string content = read_log();
+  EXPECT_EQ(content.find("serial info hidden"), std::string::npos);
+  EXPECT_EQ(content.find("dynamic serial info hidden"), std::string::npos);
+  EXPECT_NE(content.find("client info visible"), std::string::npos);
+}
+
+TEST_F(ComponentRegistryTest, ClearComponentLevelRestoresGlobalLevel) {
+  Logger::instance().set_level(LogLevel::INFO);
+  Logger::instance().set_component_level("tcp_server", LogLevel::CRITICAL);
+  EXPECT_FALSE(Logger::instance().should_log(LogLevel::ERROR, component::TCP_SERVER));
+
+  Logger::instance().clear_component_level("tcp_server");
+  EXPECT_TRUE(Logger::instance().should_log(LogLevel::ERROR, component::TCP_SERVER));
+}
+
+TEST_F(ComponentRegistryTest, DisabledMessageIsNotEvaluated) {
+  Logger::instance().set_level(LogLevel::ERROR);
+  int evaluations = 0;
+  auto expensive = [&evaluations]() {
+    ++evaluations;
+    return std::string("expensive");
+  };
+
+  UNILINK_LOG_DEBUG("tcp_client", "send", expensive());
+  EXPECT_EQ(evaluations, 0);
+
+  Logger::instance().set_component_level("tcp_client", LogLevel::DEBUG);
+  UNILINK_LOG_DEBUG("tcp_client", "send", expensive());
+  EXPECT_EQ(evaluations, 1);
+}
+
+TEST_F(ComponentRegistryTest, ErrorHandlerSharesComponentIds) {
+  error_reporting::report_connection_error("tcp_client", "connect", boost::asio::error::connection_refused, false);
+  error_reporting::report_connection_error("registry_test_errors", "connect", boost::asio::error::timed_out, true);
+
+  EXPECT_TRUE(ErrorHandler::instance().has_errors("tcp_client"));
+  EXPECT_EQ(ErrorHandler::instance().get_errors_by_component("registry_test_errors").size(), 1u);
+  EXPECT_NE(ComponentRegistry::instance().find_component("registry_test_errors"),
+            ComponentRegistry::INVALID_COMPONENT);
+  EXPECT_FALSE(ErrorHandler::instance().has_errors("never_registered_component"));
+}
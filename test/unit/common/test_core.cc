@@ -21,13 +21,17 @@
 #include <fstream>
 #include <memory>
 #include <random>
+#include <string>
 #include <system_error>
 #include <thread>
+#include <type_traits>
+#include <vector>
 
 #include "test_utils.hpp"
 #include "unilink/common/common.hpp"
 #include "unilink/common/io_context_manager.hpp"
 #include "unilink/common/memory_pool.hpp"
+#include "unilink/common/thread_safe_state.hpp"
 #include "unilink/config/config_manager.hpp"
 
 using namespace unilink;
@@ -188,6 +192,66 @@ TEST_F(MemoryTest, MemoryPoolStatistics) {
   EXPECT_GE(memory_usage.second, 0);
 }
 
+// ============================================================================
+// THREAD SAFE STATE TESTS
+// ============================================================================
+
+/**
+ * @brief Enum states use the lock-free specialization without changing behavior
+ */
+TEST(ThreadSafeStateTest, LinkStateBasicOperations) {
+  common::ThreadSafeLinkState state(common::LinkState::Idle);
+
+  EXPECT_TRUE(state.is_state(common::LinkState::Idle));
+  state.set_state(common::LinkState::Connecting);
+  EXPECT_EQ(state.get_state(), common::LinkState::Connecting);
+
+  EXPECT_FALSE(state.compare_and_set(common::LinkState::Idle, common::LinkState::Connected));
+  EXPECT_TRUE(state.compare_and_set(common::LinkState::Connecting, common::LinkState::Connected));
+  EXPECT_EQ(state.exchange(common::LinkState::Closed), common::LinkState::Connected);
+  EXPECT_TRUE(state.is_state(common::LinkState::Closed));
+}
+
+TEST(ThreadSafeStateTest, LinkStateCallbacks) {
+  common::ThreadSafeLinkState state(common::LinkState::Idle);
+  std::vector<common::LinkState> seen;
+
+  state.set_state(common::LinkState::Connecting);  // No observers yet
+  state.add_state_change_callback([&seen](const common::LinkState& s) { seen.push_back(s); });
+  state.set_state(common::LinkState::Connected);
+  state.compare_and_set(common::LinkState::Connected, common::LinkState::Closed);
+  state.clear_state_change_callbacks();
+  state.set_state(common::LinkState::Error);
+
+  ASSERT_EQ(seen.size(), 2u);
+  EXPECT_EQ(seen[0], common::LinkState::Connected);
+  EXPECT_EQ(seen[1], common::LinkState::Closed);
+}
+
+TEST(ThreadSafeStateTest, LinkStateWaitWakesOnWrite) {
+  common::ThreadSafeLinkState state(common::LinkState::Connecting);
+
+  std::thread writer([&state] {
+    std::this_thread::sleep_for(20ms);
+    state.set_state(common::LinkState::Connected);
+  });
+
+  auto start = std::chrono::steady_clock::now();
+  state.wait_for_state(common::LinkState::Connected, 5000ms);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  writer.join();
+
+  EXPECT_TRUE(state.is_state(common::LinkState::Connected));
+  EXPECT_LT(elapsed, 2000ms);
+}
+
+TEST(ThreadSafeStateTest, NonEnumStatesUseGenericTemplate) {
+  common::ThreadSafeState<std::string> state("initial");
+  state.set_state(std::string("updated"));
+  EXPECT_TRUE(state.is_state("updated"));
+  EXPECT_TRUE((std::is_same<common::ThreadSafeLinkState::State, common::LinkState>::value));
+}
+
 // ============================================================================
 // LOG ROTATION TESTS
 // ============================================================================
@@ -382,6 +446,79 @@ TEST_F(LogRotationTest, LogRotationWithoutRotation) {
   EXPECT_LT(file_size, config.max_file_size_bytes) << "File should be smaller than rotation threshold";
 }
 
+TEST_F(LogRotationTest, RetentionUsesIndexAcrossRotations) {
+  common::LogRotationConfig config;
+  config.max_file_size_bytes = 16;
+  config.max_files = 2;
+
+  common::LogRotation rotation(config);
+  std::string test_file = base_log_path_.string();
+
+  // A rotated file left by an earlier run is picked up by the index
+  std::ofstream(test_dir_ / (base_name_ + ".3.log")) << "old";
+
+  for (int i = 0; i < 4; ++i) {
+    std::ofstream(test_file) << "rotation " << i;
+    rotation.rotate(test_file);
+  }
+  rotation.wait_for_pending();
+
+  auto files = common::LogRotation::get_log_files(test_file);
+  ASSERT_EQ(files.size(), 2u);
+  EXPECT_EQ(std::filesystem::path(files[0]).filename().string(), base_name_ + ".6.log");
+  EXPECT_EQ(std::filesystem::path(files[1]).filename().string(), base_name_ + ".7.log");
+  EXPECT_EQ(rotation.get_next_file_path(test_file), test_dir_.string() + "/" + base_name_ + ".8.log");
+}
+
+TEST_F(LogRotationTest, CompressesRotatedFilesInBackground) {
+  if (!common::LogRotation::compression_available()) {
+    GTEST_SKIP() << "Built without zlib";
+  }
+
+  common::LogRotationConfig config;
+  config.max_file_size_bytes = 16;
+  config.max_files = 3;
+  config.enable_compression = true;
+
+  common::LogRotation rotation(config);
+  std::string test_file = base_log_path_.string();
+  std::ofstream(test_file) << std::string(4096, 'x');
+
+  EXPECT_EQ(rotation.rotate(test_file), test_file);
+  rotation.wait_for_pending();
+
+  auto rotated = test_dir_ / (base_name_ + ".0.log");
+  EXPECT_FALSE(std::filesystem::exists(rotated)) << "Uncompressed segment should be removed";
+  ASSERT_TRUE(std::filesystem::exists(rotated.string() + ".gz"));
+  EXPECT_LT(get_file_size(rotated.string() + ".gz"), 4096u);
+
+  auto files = common::LogRotation::get_log_files(test_file);
+  ASSERT_EQ(files.size(), 1u);
+  EXPECT_EQ(files[0], rotated.string() + ".gz");
+}
+
+TEST_F(LogRotationTest, CompressedLoggerRotationRespectsFileCount) {
+  common::LogRotationConfig config;
+  config.max_file_size_bytes = 256;
+  config.max_files = 2;
+  config.enable_compression = true;
+
+  common::Logger::instance().set_file_output_with_rotation(base_log_path_.string(), config);
+
+  for (int i = 0; i < 50; ++i) {
+    UNILINK_LOG_INFO("test", "compressed_rotation",
+                     "Message " + std::to_string(i) + " - enough data to rotate several compressed segments.");
+  }
+
+  // flush() waits for background compression and cleanup
+  common::Logger::instance().flush();
+
+  EXPECT_LE(count_log_files(), config.max_files + 1);
+  for (const auto& entry : std::filesystem::directory_iterator(test_dir_)) {
+    EXPECT_EQ(entry.path().extension().string().find(".tmp"), std::string::npos) << entry.path();
+  }
+}
+
 // ============================================================================
 // ASYNC LOGGING TESTS
 // ============================================================================
@@ -19,7 +19,10 @@
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -384,6 +387,347 @@ TEST_F(ErrorHandlerTest, ErrorHandlerEnableDisable) {
   error_handler.set_enabled(true);
 }
 
+// ============================================================================
+// ERROR HISTORY TESTS
+// ============================================================================
+
+/**
+ * @brief Test that the recent and per-component rings keep only the newest errors
+ */
+TEST_F(ErrorHandlerTest, ErrorHistoryRingsKeepNewest) {
+  auto& error_handler = common::ErrorHandler::instance();
+
+  for (int i = 0; i < 1100; ++i) {
+    common::error_reporting::report_communication_error("ring_component", "write", "ring " + std::to_string(i));
+  }
+
+  auto recent = error_handler.get_recent_errors(3);
+  ASSERT_EQ(recent.size(), 3u);
+  EXPECT_EQ(recent[0].message, "ring 1097");
+  EXPECT_EQ(recent[2].message, "ring 1099");
+
+  auto by_component = error_handler.get_errors_by_component("ring_component");
+  ASSERT_EQ(by_component.size(), 100u);
+  EXPECT_EQ(by_component.front().message, "ring 1000");
+  EXPECT_EQ(by_component.back().message, "ring 1099");
+  EXPECT_EQ(error_handler.get_error_count("ring_component", common::ErrorLevel::ERROR), 100u);
+}
+
+/**
+ * @brief Test that counters stay exact under concurrent reporting
+ */
+TEST_F(ErrorHandlerTest, ConcurrentReportingCounts) {
+  auto& error_handler = common::ErrorHandler::instance();
+
+  std::atomic<int> callback_count{0};
+  error_handler.register_callback([&callback_count](const common::ErrorInfo&) { callback_count++; });
+
+  constexpr int kThreads = 4;
+  constexpr int kErrorsPerThread = 500;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([t] {
+      for (int i = 0; i < kErrorsPerThread; ++i) {
+        common::error_reporting::report_connection_error("storm_" + std::to_string(t), "connect",
+                                                         boost::system::error_code{}, true);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  error_handler.clear_callbacks();
+
+  auto stats = error_handler.get_error_stats();
+  EXPECT_EQ(stats.total_errors, static_cast<size_t>(kThreads * kErrorsPerThread));
+  EXPECT_EQ(stats.retryable_errors, static_cast<size_t>(kThreads * kErrorsPerThread));
+  EXPECT_EQ(stats.errors_by_category[static_cast<int>(common::ErrorCategory::CONNECTION)],
+            static_cast<size_t>(kThreads * kErrorsPerThread));
+  EXPECT_EQ(callback_count.load(), kThreads * kErrorsPerThread);
+  EXPECT_LE(stats.first_error, stats.last_error);
+}
+
+/**
+ * @brief Test that a callback may report errors without deadlocking
+ */
+TEST_F(ErrorHandlerTest, CallbackCanReportErrors) {
+  auto& error_handler = common::ErrorHandler::instance();
+
+  std::atomic<int> nested{0};
+  error_handler.register_callback([&nested](const common::ErrorInfo& error) {
+    if (error.component == "outer") {
+      nested++;
+      common::error_reporting::report_warning("inner", "callback", "reported from callback");
+    }
+  });
+
+  common::error_reporting::report_system_error("outer", "operation", "outer error");
+  error_handler.clear_callbacks();
+
+  EXPECT_EQ(nested.load(), 1);
+  EXPECT_TRUE(error_handler.has_errors("inner"));
+}
+
+// ============================================================================
+// AGGREGATION TESTS
+// ============================================================================
+
+/**
+ * @brief Test that identical errors within the window become one aggregated record
+ */
+TEST_F(ErrorHandlerTest, AggregationCoalescesIdenticalErrors) {
+  auto& error_handler = common::ErrorHandler::instance();
+  error_handler.set_aggregation_window(std::chrono::milliseconds(60000));
+
+  std::vector<common::ErrorInfo> delivered;
+  std::mutex delivered_mutex;
+  error_handler.register_callback([&](const common::ErrorInfo& error) {
+    std::lock_guard<std::mutex> lock(delivered_mutex);
+    delivered.push_back(error);
+  });
+
+  auto refused = boost::system::errc::make_error_code(boost::system::errc::connection_refused);
+  for (int i = 0; i < 50; ++i) {
+    common::error_reporting::report_connection_error("agg_client", "connect", refused, true);
+  }
+  // A different operation is a different key
+  common::error_reporting::report_connection_error("agg_client", "resolve", refused, true);
+
+  ASSERT_EQ(delivered.size(), 2u);
+  EXPECT_EQ(delivered[0].occurrences, 1u);
+
+  error_handler.flush_aggregated_errors(true);
+  error_handler.clear_callbacks();
+
+  ASSERT_EQ(delivered.size(), 3u);
+  const auto& summary = delivered[2];
+  EXPECT_EQ(summary.operation, "connect");
+  EXPECT_EQ(summary.occurrences, 50u);
+  EXPECT_LE(summary.timestamp, summary.last_occurrence);
+  EXPECT_NE(summary.get_summary().find("[x50]"), std::string::npos);
+
+  auto stats = error_handler.get_error_stats();
+  EXPECT_EQ(stats.total_errors, 51u);
+  EXPECT_EQ(stats.coalesced_errors, 49u);
+  EXPECT_EQ(stats.retryable_errors, 51u);
+
+  error_handler.set_aggregation_window(std::chrono::milliseconds(0));
+}
+
+/**
+ * @brief Test that a closed window starts a new one
+ */
+TEST_F(ErrorHandlerTest, AggregationWindowExpires) {
+  auto& error_handler = common::ErrorHandler::instance();
+  error_handler.set_aggregation_window(std::chrono::milliseconds(20));
+
+  std::atomic<int> delivered{0};
+  std::atomic<uint32_t> aggregated{0};
+  error_handler.register_callback([&](const common::ErrorInfo& error) {
+    delivered++;
+    if (error.occurrences > 1) {
+      aggregated += error.occurrences;
+    }
+  });
+
+  for (int i = 0; i < 3; ++i) {
+    common::error_reporting::report_communication_error("agg_serial", "read", "timeout");
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(40));
+
+  // Closes the previous window (delivering its record) and opens a new one
+  common::error_reporting::report_communication_error("agg_serial", "read", "timeout");
+  EXPECT_EQ(delivered.load(), 3);
+  EXPECT_EQ(aggregated.load(), 3u);
+
+  // Disabling aggregation delivers what is pending; a single occurrence needs no record
+  error_handler.set_aggregation_window(std::chrono::milliseconds(0));
+  error_handler.clear_callbacks();
+  EXPECT_EQ(delivered.load(), 3);
+  EXPECT_EQ(error_handler.get_error_stats().total_errors, 4u);
+}
+
+/**
+ * @brief Test that the last burst is delivered once its window closes without a later report
+ */
+TEST_F(ErrorHandlerTest, AggregationDeliversQuietWindow) {
+  auto& error_handler = common::ErrorHandler::instance();
+  error_handler.set_aggregation_window(std::chrono::milliseconds(20));
+
+  std::atomic<uint32_t> aggregated{0};
+  error_handler.register_callback([&](const common::ErrorInfo& error) {
+    if (error.occurrences > 1) {
+      aggregated += error.occurrences;
+    }
+  });
+
+  for (int i = 0; i < 5; ++i) {
+    common::error_reporting::report_communication_error("agg_quiet", "write", "broken pipe");
+  }
+  EXPECT_TRUE(TestUtils::waitForCondition([&] { return aggregated.load() == 5u; }, 1000));
+
+  error_handler.set_aggregation_window(std::chrono::milliseconds(0));
+  error_handler.clear_callbacks();
+}
+
+// ============================================================================
+// ASYNC DISPATCH TESTS
+// ============================================================================
+
+/**
+ * @brief Test that a slow callback no longer blocks the reporting thread
+ */
+TEST_F(ErrorHandlerTest, AsyncDispatchRunsCallbacksOffThread) {
+  auto& error_handler = common::ErrorHandler::instance();
+  error_handler.enable_async_dispatch();
+  EXPECT_TRUE(error_handler.is_async_dispatch_enabled());
+
+  auto reporter = std::this_thread::get_id();
+  std::atomic<int> delivered{0};
+  std::atomic<bool> off_thread{true};
+  error_handler.register_callback([&](const common::ErrorInfo&) {
+    if (std::this_thread::get_id() == reporter) {
+      off_thread = false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    delivered++;
+  });
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 5; ++i) {
+    common::error_reporting::report_system_error("async_component", "operation", "slow " + std::to_string(i));
+  }
+  // Synchronous delivery would have taken 250ms
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+
+  error_handler.wait_for_dispatch();
+  EXPECT_EQ(delivered.load(), 5);
+  EXPECT_TRUE(off_thread.load());
+
+  error_handler.disable_async_dispatch();
+  error_handler.clear_callbacks();
+  EXPECT_FALSE(error_handler.is_async_dispatch_enabled());
+
+  auto stats = error_handler.get_dispatch_stats();
+  EXPECT_EQ(stats.enqueued, 5u);
+  EXPECT_EQ(stats.dispatched, 5u);
+  EXPECT_EQ(stats.dropped, 0u);
+  EXPECT_EQ(stats.queue_size, 0u);
+}
+
+/**
+ * @brief Test the overflow policies using a manually driven executor
+ */
+TEST_F(ErrorHandlerTest, AsyncDispatchDropPolicies) {
+  auto& error_handler = common::ErrorHandler::instance();
+
+  std::vector<std::function<void()>> posted;
+  common::ErrorDispatchConfig config(3, common::ErrorDropPolicy::DROP_OLDEST);
+  config.executor = [&posted](std::function<void()> work) { posted.push_back(std::move(work)); };
+
+  std::vector<std::string> delivered;
+  error_handler.register_callback([&delivered](const common::ErrorInfo& error) { delivered.push_back(error.message); });
+
+  for (auto policy : {common::ErrorDropPolicy::DROP_OLDEST, common::ErrorDropPolicy::DROP_NEWEST}) {
+    config.drop_policy = policy;
+    error_handler.enable_async_dispatch(config);
+    posted.clear();
+    delivered.clear();
+
+    for (int i = 0; i < 5; ++i) {
+      common::error_reporting::report_warning("drop_component", "queue", "error " + std::to_string(i));
+    }
+    EXPECT_TRUE(delivered.empty());
+    ASSERT_EQ(posted.size(), 1u);  // One drain task per burst
+    EXPECT_EQ(error_handler.get_dispatch_stats().queue_size, 3u);
+
+    posted.front()();
+    ASSERT_EQ(delivered.size(), 3u);
+    if (policy == common::ErrorDropPolicy::DROP_OLDEST) {
+      EXPECT_EQ(delivered.front(), "error 2");
+      EXPECT_EQ(delivered.back(), "error 4");
+    } else {
+      EXPECT_EQ(delivered.front(), "error 0");
+      EXPECT_EQ(delivered.back(), "error 2");
+    }
+
+    auto stats = error_handler.get_dispatch_stats();
+    EXPECT_EQ(stats.dropped, 2u);
+    EXPECT_EQ(stats.max_queue_size_reached, 3u);
+    error_handler.disable_async_dispatch();
+    error_handler.reset_stats();
+  }
+  error_handler.clear_callbacks();
+}
+
+/**
+ * @brief Test that disabling does not wait on an executor that never runs the drain
+ */
+TEST_F(ErrorHandlerTest, AsyncDispatchDisableWithStoppedExecutor) {
+  auto& error_handler = common::ErrorHandler::instance();
+
+  std::vector<std::function<void()>> posted;  // Never run, like a stopped io_context
+  common::ErrorDispatchConfig config;
+  config.executor = [&posted](std::function<void()> work) { posted.push_back(std::move(work)); };
+
+  std::vector<std::string> delivered;
+  error_handler.register_callback([&delivered](const common::ErrorInfo& error) { delivered.push_back(error.message); });
+
+  error_handler.enable_async_dispatch(config);
+  for (int i = 0; i < 3; ++i) {
+    common::error_reporting::report_warning("stopped_executor", "queue", "error " + std::to_string(i));
+  }
+  EXPECT_TRUE(delivered.empty());
+
+  error_handler.disable_async_dispatch();
+  ASSERT_EQ(delivered.size(), 3u);
+  EXPECT_EQ(delivered.front(), "error 0");
+  EXPECT_EQ(error_handler.get_dispatch_stats().dispatched, 3u);
+
+  // A drain left over from the previous dispatcher does nothing once it is re-enabled
+  error_handler.enable_async_dispatch(config);
+  common::error_reporting::report_warning("stopped_executor", "queue", "error 3");
+  ASSERT_EQ(posted.size(), 2u);
+  posted.front()();
+  EXPECT_EQ(delivered.size(), 3u);
+  posted.back()();
+  EXPECT_EQ(delivered.size(), 4u);
+
+  error_handler.disable_async_dispatch();
+  error_handler.clear_callbacks();
+}
+
+/**
+ * @brief Test that a callback running on the executor can disable and re-enable async dispatch
+ */
+TEST_F(ErrorHandlerTest, AsyncDispatchReconfigureFromCallback) {
+  auto& error_handler = common::ErrorHandler::instance();
+
+  std::vector<std::function<void()>> posted;
+  common::ErrorDispatchConfig config;
+  config.executor = [&posted](std::function<void()> work) { posted.push_back(std::move(work)); };
+
+  std::vector<std::string> delivered;
+  error_handler.register_callback([&](const common::ErrorInfo& error) {
+    delivered.push_back(error.message);
+    if (error.message == "error 0") {
+      error_handler.enable_async_dispatch(config);  // Disables first, from inside the drain
+    }
+  });
+
+  error_handler.enable_async_dispatch(config);
+  for (int i = 0; i < 3; ++i) {
+    common::error_reporting::report_warning("callback_reconfigure", "queue", "error " + std::to_string(i));
+  }
+  ASSERT_EQ(posted.size(), 1u);
+  posted.front()();  // Returns instead of deadlocking
+  EXPECT_EQ(delivered, (std::vector<std::string>{"error 0", "error 1", "error 2"}));
+  EXPECT_TRUE(error_handler.is_async_dispatch_enabled());
+
+  error_handler.disable_async_dispatch();
+  error_handler.clear_callbacks();
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
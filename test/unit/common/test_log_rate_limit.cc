@@ -0,0 +1,190 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "unilink/common/logger.hpp"
+
+using namespace unilink::common;
+using namespace std::chrono_literals;
+
+/**
+ * @brief Per-call-site rate limiting, sampling and suppression summaries
+ */
+class LogRateLimitTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto& logger = Logger::instance();
+    logger.report_suppressed();  // Drop counts left over from other tests
+    logger.set_level(LogLevel::DEBUG);
+    logger.set_format("{message}");
+    logger.set_callback([this](LogLevel, const std::string& message) { messages_.push_back(message); });
+    logger.set_outputs(static_cast<int>(LogOutput::CALLBACK));
+  }
+
+  void TearDown() override {
+    auto& logger = Logger::instance();
+    logger.set_callback(nullptr);
+    logger.set_outputs(static_cast<int>(LogOutput::CONSOLE));
+    logger.set_format("{timestamp} [{level}] [{component}] [{operation}] {message}");
+    logger.set_suppression_summary_interval(10s);
+    logger.set_level(LogLevel::INFO);
+  }
+
+  size_t count_prefix(const std::string& prefix) const {
+    size_t count = 0;
+    for (const auto& message : messages_) {
+      if (message.compare(0, prefix.size(), prefix) == 0) {
+        ++count;
+      }
+    }
+    return count;
+  }
+
+  std::vector<std::string> messages_;
+};
+
+TEST_F(LogRateLimitTest, RateLimiterAllowsBurstThenSuppresses) {
+  LogRateLimiter limiter(LogLevel::INFO, "rate_test", "burst", 1.0, 3);
+
+  int allowed = 0;
+  for (int i = 0; i < 100; ++i) {
+    if (limiter.allow()) {
+      ++allowed;
+    }
+  }
+
+  EXPECT_EQ(allowed, 3);
+  EXPECT_EQ(limiter.take_suppressed(), 97u);
+  EXPECT_EQ(limiter.take_suppressed(), 0u);
+}
+
+TEST_F(LogRateLimitTest, RateLimiterRefills) {
+  LogRateLimiter limiter(LogLevel::INFO, "rate_test", "refill", 50.0, 1);
+
+  EXPECT_TRUE(limiter.allow());
+  EXPECT_FALSE(limiter.allow());
+  std::this_thread::sleep_for(40ms);
+  EXPECT_TRUE(limiter.allow());
+}
+
+TEST_F(LogRateLimitTest, RateLimiterIsThreadSafe) {
+  LogRateLimiter limiter(LogLevel::INFO, "rate_test", "threads", 0.001, 10);
+  std::atomic<int> allowed{0};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 1000; ++i) {
+        if (limiter.allow()) {
+          allowed.fetch_add(1);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(allowed.load(), 10);
+  EXPECT_EQ(limiter.take_suppressed(), 3990u);
+}
+
+TEST_F(LogRateLimitTest, SamplerKeepsOneInN) {
+  LogSampler sampler(LogLevel::DEBUG, "rate_test", "sample", 10);
+
+  int allowed = 0;
+  for (int i = 0; i < 100; ++i) {
+    if (sampler.allow()) {
+      ++allowed;
+    }
+  }
+
+  EXPECT_EQ(allowed, 10);
+  EXPECT_EQ(sampler.take_suppressed(), 90u);
+}
+
+TEST_F(LogRateLimitTest, MacrosWriteSummaryLine) {
+  auto& logger = Logger::instance();
+  uint64_t suppressed_before = logger.get_suppressed_count();
+
+  for (int i = 0; i < 20; ++i) {
+    UNILINK_LOG_RATE_LIMITED(LogLevel::ERROR, "rate_test", "macro", 0.001, 2, "retry " + std::to_string(i));
+    UNILINK_LOG_SAMPLED(LogLevel::INFO, "rate_test", "sampled", 5, "sample " + std::to_string(i));
+  }
+
+  EXPECT_EQ(count_prefix("retry "), 2u);
+  EXPECT_EQ(count_prefix("sample "), 4u);
+  EXPECT_EQ(logger.get_suppressed_count() - suppressed_before, 34u);
+
+  logger.report_suppressed();
+  EXPECT_EQ(count_prefix("Suppressed 18 messages (rate limit"), 1u);
+  EXPECT_EQ(count_prefix("Suppressed 16 messages (sampled 1 in 5)"), 1u);
+
+  // Counts were reset by the summary
+  logger.report_suppressed();
+  EXPECT_EQ(count_prefix("Suppressed"), 2u);
+}
+
+TEST_F(LogRateLimitTest, SummaryIsWrittenPeriodically) {
+  auto& logger = Logger::instance();
+  logger.set_suppression_summary_interval(0ms);
+
+  for (int i = 0; i < 5; ++i) {
+    UNILINK_LOG_RATE_LIMITED(LogLevel::WARNING, "rate_test", "periodic", 0.001, 1, "flap");
+  }
+
+  // Each suppressed call is past the (zero) interval, so it reports itself
+  EXPECT_EQ(count_prefix("flap"), 1u);
+  EXPECT_EQ(count_prefix("Suppressed 1 messages"), 4u);
+}
+
+TEST_F(LogRateLimitTest, QuietSiteSummaryIsWrittenByLaterMessages) {
+  auto& logger = Logger::instance();
+  logger.set_suppression_summary_interval(50ms);
+
+  for (int i = 0; i < 10; ++i) {
+    UNILINK_LOG_RATE_LIMITED(LogLevel::WARNING, "rate_test", "quiet", 0.001, 1, "flap");
+  }
+  EXPECT_EQ(count_prefix("Suppressed"), 0u);
+
+  // The flapping site has gone quiet; an unrelated message after the interval carries its summary out
+  std::this_thread::sleep_for(80ms);
+  logger.info("rate_test", "steady", "steady");
+
+  ASSERT_EQ(messages_.size(), 3u);
+  EXPECT_EQ(messages_[1].rfind("Suppressed 9 messages (rate limit", 0), 0u);
+  EXPECT_EQ(messages_[2], "steady");
+}
+
+TEST_F(LogRateLimitTest, DisabledLevelIsNotCounted) {
+  auto& logger = Logger::instance();
+  logger.set_level(LogLevel::ERROR);
+  uint64_t suppressed_before = logger.get_suppressed_count();
+
+  for (int i = 0; i < 10; ++i) {
+    UNILINK_LOG_RATE_LIMITED(LogLevel::INFO, "rate_test", "filtered", 0.001, 1, "filtered");
+  }
+
+  EXPECT_EQ(count_prefix("filtered"), 0u);
+  EXPECT_EQ(logger.get_suppressed_count(), suppressed_before);
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "test_utils.hpp"
+#include "unilink/common/io_context_manager.hpp"
+#include "unilink/common/loop_monitor.hpp"
+#include "unilink/transport/tcp_client/tcp_client.hpp"
+
+using namespace unilink;
+using namespace unilink::common;
+using namespace std::chrono_literals;
+using unilink::test::TestUtils;
+namespace net = boost::asio;
+
+namespace {
+
+// io_context run on its own thread for the lifetime of the object
+class RunningContext {
+ public:
+  RunningContext() : guard_(net::make_work_guard(ioc_)), thread_([this] { ioc_.run(); }) {}
+  ~RunningContext() {
+    guard_.reset();
+    ioc_.stop();
+    thread_.join();
+  }
+
+  net::io_context& get() { return ioc_; }
+  std::thread::id thread_id() const { return thread_.get_id(); }
+
+ private:
+  net::io_context ioc_;
+  net::executor_work_guard<net::io_context::executor_type> guard_;
+  std::thread thread_;
+};
+
+LoopMonitorConfig fast_config() {
+  LoopMonitorConfig config;
+  config.interval = 5ms;
+  config.lag_threshold = 30ms;
+  return config;
+}
+
+}  // namespace
+
+TEST(LoopMonitorTest, IdleLoopStaysBelowThreshold) {
+  RunningContext ioc;
+  LoopMonitor monitor(fast_config());
+  std::atomic<int> lag_events{0};
+  monitor.on_lag([&lag_events](std::chrono::nanoseconds) { ++lag_events; });
+  monitor.start(ioc.get());
+
+  ASSERT_TRUE(TestUtils::waitForCondition([&] { return monitor.snapshot().probes >= 10; }));
+  monitor.stop();
+
+  auto snap = monitor.snapshot();
+  EXPECT_EQ(snap.lag_ns.count, snap.probes);
+  EXPECT_LT(snap.lag_ns.percentile(50), static_cast<uint64_t>(std::chrono::nanoseconds(30ms).count()));
+  ASSERT_EQ(snap.threads.size(), 1u);
+  EXPECT_EQ(snap.threads[0].thread, ioc.thread_id());
+  EXPECT_EQ(static_cast<uint64_t>(lag_events.load()), snap.lagging);
+}
+
+TEST(LoopMonitorTest, BlockedLoopFiresLagCallback) {
+  RunningContext ioc;
+  LoopMonitor monitor(fast_config());
+  std::atomic<int64_t> worst_lag_ns{0};
+  monitor.on_lag([&worst_lag_ns](std::chrono::nanoseconds lag) {
+    if (lag.count() > worst_lag_ns.load()) worst_lag_ns = lag.count();
+  });
+  monitor.start(ioc.get());
+  ASSERT_TRUE(TestUtils::waitForCondition([&] { return monitor.snapshot().probes >= 2; }));
+
+  // A handler that blocks the loop delays the next probe
+  net::post(ioc.get(), [] { std::this_thread::sleep_for(150ms); });
+  ASSERT_TRUE(TestUtils::waitForCondition([&] { return monitor.snapshot().lagging >= 1; }));
+
+  auto snap = monitor.snapshot();
+  EXPECT_GE(worst_lag_ns.load(), std::chrono::nanoseconds(30ms).count());
+  EXPECT_EQ(snap.lag_ns.max, static_cast<uint64_t>(worst_lag_ns.load()));
+}
+
+TEST(LoopMonitorTest, SamplesThreadCpuTime) {
+  RunningContext ioc;
+  LoopMonitor monitor(fast_config());
+  monitor.start(ioc.get());
+  ASSERT_TRUE(TestUtils::waitForCondition([&] { return monitor.snapshot().probes >= 1; }));
+  uint64_t cpu_before = monitor.snapshot().threads.at(0).cpu_ns;
+
+  net::post(ioc.get(), [] {
+    auto end = std::chrono::steady_clock::now() + 100ms;
+    volatile uint64_t spin = 0;
+    while (std::chrono::steady_clock::now() < end) spin = spin + 1;
+  });
+  uint64_t probes = monitor.snapshot().probes;
+  ASSERT_TRUE(TestUtils::waitForCondition([&] { return monitor.snapshot().probes >= probes + 3; }));
+
+  auto thread = monitor.snapshot().threads.at(0);
+  EXPECT_GT(thread.cpu_ns, cpu_before);
+  EXPECT_GE(thread.utilization, 0.0);
+}
+
+TEST(LoopMonitorTest, OutlivesContextAndRestarts) {
+  LoopMonitor monitor(fast_config());
+  {
+    RunningContext first;
+    monitor.start(first.get());
+    ASSERT_TRUE(TestUtils::waitForCondition([&] { return monitor.snapshot().probes >= 2; }));
+  }  // Context destroyed with a probe still pending
+
+  monitor.stop();
+  uint64_t probes = monitor.snapshot().probes;
+
+  RunningContext second;
+  monitor.start(second.get());
+  EXPECT_TRUE(TestUtils::waitForCondition([&] { return monitor.snapshot().probes >= probes + 2; }));
+  EXPECT_FALSE(monitor.snapshot().threads.empty());
+
+  monitor.reset();
+  EXPECT_EQ(monitor.snapshot().lag_ns.count, 0u);
+}
+
+TEST(LoopMonitorTest, IoContextManagerMonitor) {
+  auto& manager = IoContextManager::instance();
+  manager.start();
+  auto monitor = manager.enable_loop_monitor(fast_config());
+  ASSERT_NE(monitor, nullptr);
+  EXPECT_EQ(manager.enable_loop_monitor(), monitor);
+  EXPECT_TRUE(TestUtils::waitForCondition([&] { return monitor->snapshot().probes >= 2; }));
+
+  // Follows the manager across a restart
+  manager.stop();
+  EXPECT_FALSE(monitor->is_running());
+  manager.start();
+  EXPECT_TRUE(monitor->is_running());
+
+  manager.disable_loop_monitor();
+  EXPECT_EQ(manager.loop_monitor(), nullptr);
+  EXPECT_FALSE(monitor->is_running());
+  manager.stop();
+}
+
+TEST(LoopMonitorTest, ChannelWithOwnedContext) {
+  config::TcpClientConfig cfg;
+  cfg.host = "127.0.0.1";
+  cfg.port = 1;  // Nothing listens; the client keeps retrying
+  cfg.retry_interval_ms = 50;
+  auto client = std::make_shared<transport::TcpClient>(cfg);
+  auto monitor = std::make_shared<LoopMonitor>(fast_config());
+
+  client->set_loop_monitor(monitor);
+  client->start();
+  EXPECT_TRUE(TestUtils::waitForCondition([&] { return monitor->snapshot().probes >= 3; }));
+  client->stop();
+  EXPECT_FALSE(monitor->is_running());
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "unilink/common/memory_tracker.hpp"
+
+using namespace unilink::common;
+
+namespace {
+
+void* fake_ptr(uintptr_t base, size_t index) { return reinterpret_cast<void*>(base + index * 64); }
+
+}  // namespace
+
+/**
+ * @brief Sampling allocation profiler
+ */
+class MemoryTrackerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto& tracker = MemoryTracker::instance();
+    tracker.enable_tracking(true);
+    tracker.clear_tracking_data();
+  }
+
+  void TearDown() override {
+    auto& tracker = MemoryTracker::instance();
+    tracker.set_sample_interval(MemoryTracker::DEFAULT_SAMPLE_INTERVAL);
+    tracker.clear_tracking_data();
+    tracker.enable_tracking(true);
+  }
+};
+
+TEST_F(MemoryTrackerTest, IntervalOneTracksExactly) {
+  auto& tracker = MemoryTracker::instance();
+  tracker.set_sample_interval(1);
+  const char* function = "exact_site";
+  auto site = MemoryTracker::register_site(__FILE__, 1, function);
+  EXPECT_EQ(MemoryTracker::register_site(__FILE__, 1, function), site);
+
+  for (size_t i = 0; i < 10; ++i) {
+    tracker.track_allocation(fake_ptr(0x10000, i), 100, site);
+  }
+  for (size_t i = 0; i < 5; ++i) {
+    tracker.track_deallocation(fake_ptr(0x10000, i));
+  }
+
+  auto stats = tracker.get_stats();
+  EXPECT_EQ(stats.total_allocations, 10u);
+  EXPECT_EQ(stats.total_deallocations, 5u);
+  EXPECT_EQ(stats.current_allocations, 5u);
+  EXPECT_EQ(stats.current_bytes_allocated, 500u);
+  EXPECT_EQ(stats.peak_bytes_allocated, 1000u);
+  EXPECT_EQ(tracker.get_current_allocations().size(), 5u);
+
+  auto top = tracker.get_top_allocation_sites(1);
+  ASSERT_EQ(top.size(), 1u);
+  EXPECT_EQ(top[0].site, site);
+  EXPECT_EQ(top[0].function, "exact_site");
+  EXPECT_EQ(top[0].live_bytes, 500u);
+  EXPECT_EQ(top[0].total_bytes, 1000u);
+
+  auto profile = tracker.export_heap_snapshot();
+  EXPECT_NE(profile.find("# sample_interval: 1"), std::string::npos);
+  EXPECT_NE(profile.find("500 5 1000 10 "), std::string::npos);
+}
+
+TEST_F(MemoryTrackerTest, SamplingEstimatesLiveHeap) {
+  auto& tracker = MemoryTracker::instance();
+  tracker.set_sample_interval(4096);
+  auto small_site = MemoryTracker::register_site(__FILE__, __LINE__, "small_allocations");
+  auto large_site = MemoryTracker::register_site(__FILE__, __LINE__, "large_allocations");
+
+  constexpr size_t kSmallCount = 200000;
+  constexpr size_t kLargeCount = 100;
+  for (size_t i = 0; i < kSmallCount; ++i) {
+    tracker.track_allocation(fake_ptr(0x100000000ULL, i), 64, small_site);
+  }
+  for (size_t i = 0; i < kLargeCount; ++i) {
+    tracker.track_allocation(fake_ptr(0x900000000ULL, i * 1024), 65536, large_site);
+  }
+
+  auto stats = tracker.get_stats();
+  EXPECT_EQ(stats.total_allocations, kSmallCount + kLargeCount);
+  EXPECT_LT(stats.sampled_allocations, kSmallCount / 10);
+
+  double small_estimate = 0.0;
+  double large_estimate = 0.0;
+  for (const auto& site : tracker.take_heap_snapshot().sites) {
+    if (site.site == small_site) small_estimate = static_cast<double>(site.live_bytes);
+    if (site.site == large_site) large_estimate = static_cast<double>(site.live_bytes);
+  }
+
+  // Small allocations are rarely sampled but weighted up; large ones are almost always sampled
+  double small_actual = static_cast<double>(kSmallCount * 64);
+  double large_actual = static_cast<double>(kLargeCount * 65536);
+  EXPECT_NEAR(small_estimate / small_actual, 1.0, 0.15);
+  EXPECT_NEAR(large_estimate / large_actual, 1.0, 0.05);
+}
+
+TEST_F(MemoryTrackerTest, ConcurrentTrackingBalances) {
+  auto& tracker = MemoryTracker::instance();
+  tracker.set_sample_interval(1);
+  auto site = MemoryTracker::register_site(__FILE__, __LINE__, "threads");
+
+  constexpr size_t kPerThread = 10000;
+  std::vector<std::thread> threads;
+  for (uintptr_t t = 0; t < 4; ++t) {
+    threads.emplace_back([&tracker, site, t] {
+      for (size_t i = 0; i < kPerThread; ++i) {
+        void* ptr = fake_ptr(0x200000000ULL * (t + 1), i);
+        tracker.track_allocation(ptr, 32, site);
+        tracker.track_deallocation(ptr);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto stats = tracker.get_stats();
+  EXPECT_EQ(stats.total_allocations, 4 * kPerThread);
+  EXPECT_EQ(stats.total_deallocations, 4 * kPerThread);
+  EXPECT_EQ(stats.current_allocations, 0u);
+  EXPECT_EQ(stats.current_bytes_allocated, 0u);
+  EXPECT_TRUE(tracker.get_current_allocations().empty());
+}
+
+TEST_F(MemoryTrackerTest, DisabledTrackingRecordsNothing) {
+  auto& tracker = MemoryTracker::instance();
+  tracker.set_sample_interval(1);
+  tracker.disable_tracking();
+
+  tracker.track_allocation(fake_ptr(0x30000, 0), 128, __FILE__, __LINE__, __FUNCTION__);
+  auto stats = tracker.get_stats();
+  EXPECT_EQ(stats.total_allocations, 0u);
+  EXPECT_TRUE(tracker.take_heap_snapshot().sites.empty());
+}
+
+#ifdef UNILINK_ENABLE_MEMORY_TRACKING
+TEST_F(MemoryTrackerTest, MacroTagsCallSite) {
+  auto& tracker = MemoryTracker::instance();
+  tracker.set_sample_interval(1);
+
+  for (size_t i = 0; i < 3; ++i) {
+    MEMORY_TRACK_ALLOCATION(fake_ptr(0x40000, i), 16);
+  }
+
+  auto top = tracker.get_top_allocation_sites(5);
+  ASSERT_EQ(top.size(), 1u);
+  EXPECT_EQ(top[0].live_allocations, 3u);
+  EXPECT_NE(top[0].file.find("test_memory_tracker.cc"), std::string::npos);
+
+  MEMORY_TRACK_DEALLOCATION(fake_ptr(0x40000, 0));
+  EXPECT_EQ(tracker.get_stats().current_allocations, 2u);
+}
+#endif
@@ -580,6 +580,155 @@ TEST_F(ConfigTest, ConfigPerformanceLargeDataset) {
   EXPECT_LT(total_duration.count() / num_items, 100);
 }
 
+// ============================================================================
+// SNAPSHOT TESTS
+// ============================================================================
+
+/**
+ * @brief Test typed reads through precompiled key handles
+ */
+TEST_F(ConfigTest, SnapshotTypedReads) {
+  config_manager_->set("retry_interval_ms", 3000);
+  auto retry_key = config_manager_->key<int>("retry_interval_ms");
+  auto host_key = config_manager_->key<std::string>("host");
+  auto wrong_type_key = config_manager_->key<bool>("retry_interval_ms");
+
+  auto before = config_manager_->snapshot();
+  EXPECT_EQ(before->get(retry_key, 0), 3000);
+  EXPECT_FALSE(before->has(host_key));
+  EXPECT_EQ(before->get(host_key, std::string("localhost")), "localhost");
+  EXPECT_TRUE(before->get(wrong_type_key, true));  // Type mismatch falls back to the default
+
+  config_manager_->set("host", std::string("10.0.0.1"));
+  config_manager_->set("retry_interval_ms", 500);
+  auto after = config_manager_->snapshot();
+  EXPECT_EQ(after->get(retry_key), 500);
+  EXPECT_EQ(after->get(host_key), "10.0.0.1");
+  EXPECT_GT(after->version(), before->version());
+
+  // Published snapshots are immutable
+  EXPECT_EQ(before->get(retry_key), 3000);
+
+  // Keys without a handle do not republish
+  uint64_t version = config_manager_->snapshot_version();
+  config_manager_->set("untracked", 1);
+  EXPECT_EQ(config_manager_->snapshot_version(), version);
+
+  config_manager_->remove("host");
+  EXPECT_FALSE(config_manager_->snapshot()->has(host_key));
+}
+
+/**
+ * @brief Test that cached readers see every write without blocking writers
+ */
+TEST_F(ConfigTest, SnapshotReadersDuringWrites) {
+  auto counter_key = config_manager_->key<int>("counter");
+  config_manager_->set("counter", 0);
+
+  std::atomic<bool> done{false};
+  std::atomic<bool> monotonic{true};
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 3; ++r) {
+    readers.emplace_back([&] {
+      ConfigReader reader(*config_manager_);
+      int last = 0;
+      while (!done.load()) {
+        int value = reader.get(counter_key, -1);
+        if (value < last) {
+          monotonic = false;
+        }
+        last = value;
+      }
+      if (reader.get(counter_key, -1) != 1000) {
+        monotonic = false;
+      }
+    });
+  }
+
+  for (int i = 1; i <= 1000; ++i) {
+    config_manager_->set("counter", i);
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_TRUE(monotonic.load());
+}
+
+// ============================================================================
+// LIVE RELOAD TESTS
+// ============================================================================
+
+/**
+ * @brief Test that a reload validates values and reports only changed keys
+ */
+TEST_F(ConfigTest, ReloadAppliesValidatedChanges) {
+  config_manager_->register_item(ConfigItem("tcp.client.retry_interval_ms", 1000, ConfigType::Integer));
+  config_manager_->register_validator("tcp.client.retry_interval_ms", [](const std::any& value) {
+    if (value.type() != typeid(int) || std::any_cast<int>(value) < 100) {
+      return ValidationResult::error("retry interval must be at least 100ms");
+    }
+    return ValidationResult::success();
+  });
+  config_manager_->set("tcp.server.max_connections", 10);
+  auto retry_key = config_manager_->key<int>("tcp.client.retry_interval_ms");
+
+  std::vector<std::vector<std::string>> reloads;
+  config_manager_->add_reload_listener([&](const std::vector<std::string>& keys) { reloads.push_back(keys); });
+
+  auto write_file = [&](const std::string& content) {
+    std::ofstream file(test_file_path_);
+    file << content;
+  };
+
+  // Invalid value is rejected, unchanged value is not reported
+  write_file("tcp.client.retry_interval_ms=5\ntcp.server.max_connections=10\n");
+  EXPECT_TRUE(config_manager_->reload_from_file(test_file_path_.string()));
+  EXPECT_EQ(std::any_cast<int>(config_manager_->get("tcp.client.retry_interval_ms")), 1000);
+  EXPECT_TRUE(reloads.empty());
+
+  write_file("tcp.client.retry_interval_ms=2500\ntcp.server.max_connections=10\nnew.key=on\n");
+  EXPECT_TRUE(config_manager_->reload_from_file(test_file_path_.string()));
+  ASSERT_EQ(reloads.size(), 1u);
+  EXPECT_THAT(reloads[0], ::testing::UnorderedElementsAre("tcp.client.retry_interval_ms", "new.key"));
+  EXPECT_EQ(config_manager_->snapshot()->get(retry_key), 2500);
+  EXPECT_EQ(std::any_cast<std::string>(config_manager_->get("new.key")), "on");
+
+  EXPECT_FALSE(config_manager_->reload_from_file(test_file_path_.string() + ".missing"));
+}
+
+/**
+ * @brief Test that a burst of file writes is coalesced into one reload
+ */
+TEST_F(ConfigTest, WatchFileCoalescesWriteBurst) {
+  config_manager_->set("tcp.client.retry_interval_ms", 1000);
+  {
+    std::ofstream file(test_file_path_);
+    file << "tcp.client.retry_interval_ms=1000\n";
+  }
+
+  std::atomic<int> reloads{0};
+  config_manager_->add_reload_listener([&](const std::vector<std::string>&) { reloads++; });
+  ASSERT_TRUE(config_manager_->watch_file(test_file_path_.string(), 300ms));
+  EXPECT_TRUE(config_manager_->is_watching());
+
+  for (int i = 1; i <= 5; ++i) {
+    std::ofstream file(test_file_path_);
+    file << "tcp.client.retry_interval_ms=" << (1000 + i * 100) << "\n";
+    file.close();
+    std::this_thread::sleep_for(20ms);
+  }
+
+  EXPECT_TRUE(TestUtils::waitForCondition([&] { return reloads.load() > 0; }, 5000));
+  std::this_thread::sleep_for(500ms);
+  EXPECT_EQ(reloads.load(), 1);
+  EXPECT_EQ(std::any_cast<int>(config_manager_->get("tcp.client.retry_interval_ms")), 1500);
+
+  config_manager_->stop_watching();
+  EXPECT_FALSE(config_manager_->is_watching());
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,170 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <boost/asio.hpp>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "unilink/wrapper/awaitable/awaitable_channel.hpp"
+
+using namespace unilink;
+using namespace std::chrono_literals;
+namespace net = boost::asio;
+
+namespace {
+
+// Channel whose events are driven by the test
+class FakeChannel : public interface::Channel {
+ public:
+  void start() override {}
+  void stop() override {}
+  bool is_connected() const override { return connected_; }
+  void async_write_copy(const uint8_t* data, size_t size) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    written_.insert(written_.end(), data, data + size);
+  }
+  void on_bytes(OnBytes cb) override { on_bytes_ = std::move(cb); }
+  void on_state(OnState cb) override { on_state_ = std::move(cb); }
+  void on_backpressure(OnBackpressure) override {}
+
+  void deliver(const std::string& text) {
+    on_bytes_(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+  }
+  void set_connected(bool connected) {
+    connected_ = connected;
+    on_state_(connected ? common::LinkState::Connected : common::LinkState::Closed);
+  }
+  std::string written() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::string(written_.begin(), written_.end());
+  }
+
+ private:
+  std::atomic<bool> connected_{false};
+  OnBytes on_bytes_;
+  OnState on_state_;
+  std::mutex mutex_;
+  std::vector<uint8_t> written_;
+};
+
+}  // namespace
+
+class AwaitableChannelTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    channel_ = std::make_shared<FakeChannel>();
+    link_ = std::make_unique<wrapper::AwaitableChannel>(channel_, ioc_.get_executor());
+  }
+
+  // Run a coroutine to completion on the test's io_context
+  template <typename T>
+  T run(net::awaitable<T> coroutine) {
+    auto future = net::co_spawn(ioc_, std::move(coroutine), net::use_future);
+    ioc_.run();
+    ioc_.restart();
+    return future.get();
+  }
+
+  net::io_context ioc_;
+  std::shared_ptr<FakeChannel> channel_;
+  std::unique_ptr<wrapper::AwaitableChannel> link_;
+};
+
+/**
+ * @brief Bytes delivered on another thread resume a suspended reader
+ */
+TEST_F(AwaitableChannelTest, ReadSomeResumesWhenBytesArrive) {
+  auto work = net::make_work_guard(ioc_);
+  std::thread producer([&] {
+    std::this_thread::sleep_for(20ms);
+    channel_->deliver("hello world");
+  });
+
+  auto read = [&]() -> net::awaitable<std::string> {
+    std::string text;
+    uint8_t buf[5];
+    while (text.size() < 11) {
+      size_t n = co_await link_->read_some(buf);
+      text.append(reinterpret_cast<char*>(buf), n);
+    }
+    work.reset();
+    co_return text;
+  };
+  EXPECT_EQ(run(read()), "hello world");
+  EXPECT_EQ(link_->available(), 0u);
+  producer.join();
+}
+
+/**
+ * @brief wait_connected() completes on the Connected state and write() forwards bytes
+ */
+TEST_F(AwaitableChannelTest, WaitConnectedThenWrite) {
+  auto work = net::make_work_guard(ioc_);
+  std::thread connector([&] {
+    std::this_thread::sleep_for(20ms);
+    channel_->set_connected(true);
+  });
+
+  auto session = [&]() -> net::awaitable<void> {
+    co_await link_->wait_connected();
+    const uint8_t request[] = {'p', 'i', 'n', 'g'};
+    co_await link_->write(request);
+    work.reset();
+  };
+  run(session());
+  EXPECT_EQ(channel_->written(), "ping");
+  connector.join();
+}
+
+/**
+ * @brief write() on a link that is down fails with not_connected
+ */
+TEST_F(AwaitableChannelTest, WriteWhileDisconnectedThrows) {
+  auto session = [&]() -> net::awaitable<void> {
+    const uint8_t request[] = {1};
+    co_await link_->write(request);
+  };
+  try {
+    run(session());
+    FAIL() << "write() should throw";
+  } catch (const boost::system::system_error& e) {
+    EXPECT_EQ(e.code(), net::error::not_connected);
+  }
+}
+
+/**
+ * @brief cancel() aborts a pending read
+ */
+TEST_F(AwaitableChannelTest, CancelAbortsPendingRead) {
+  auto session = [&]() -> net::awaitable<void> {
+    uint8_t buf[16];
+    co_await link_->read_some(buf);
+  };
+  net::post(ioc_, [this] { link_->cancel(); });
+  try {
+    run(session());
+    FAIL() << "read_some() should be aborted";
+  } catch (const boost::system::system_error& e) {
+    EXPECT_EQ(e.code(), net::error::operation_aborted);
+  }
+}
@@ -0,0 +1,249 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "unilink/wrapper/request/request_channel.hpp"
+
+using namespace unilink;
+using namespace std::chrono_literals;
+namespace net = boost::asio;
+using Status = wrapper::RequestChannel::Status;
+
+namespace {
+
+// One end of an in-memory link; writes are delivered to the peer on the io_context
+class PipeChannel : public interface::Channel {
+ public:
+  explicit PipeChannel(net::io_context& ioc) : ioc_(ioc) {}
+
+  static void connect(const std::shared_ptr<PipeChannel>& a, const std::shared_ptr<PipeChannel>& b) {
+    a->peer_ = b;
+    b->peer_ = a;
+  }
+
+  void start() override {}
+  void stop() override {}
+  bool is_connected() const override { return connected_; }
+  void async_write_copy(const uint8_t* data, size_t size) override {
+    net::post(ioc_, [peer = peer_, bytes = std::vector<uint8_t>(data, data + size)] {
+      if (auto p = peer.lock()) p->deliver(bytes);
+    });
+  }
+  void on_bytes(OnBytes cb) override { on_bytes_ = std::move(cb); }
+  void on_state(OnState cb) override { on_state_ = std::move(cb); }
+  void on_backpressure(OnBackpressure) override {}
+
+  void drop() {
+    connected_ = false;
+    if (on_state_) on_state_(common::LinkState::Closed);
+  }
+
+  size_t chunk_size = 0;  // Deliver in pieces of this size when non-zero
+
+ private:
+  void deliver(const std::vector<uint8_t>& bytes) {
+    if (!on_bytes_) return;
+    size_t step = chunk_size ? chunk_size : bytes.size();
+    for (size_t offset = 0; offset < bytes.size(); offset += step) {
+      on_bytes_(bytes.data() + offset, std::min(step, bytes.size() - offset));
+    }
+  }
+
+  net::io_context& ioc_;
+  std::weak_ptr<PipeChannel> peer_;
+  bool connected_ = true;
+  OnBytes on_bytes_;
+  OnState on_state_;
+};
+
+const uint8_t* bytes(const std::string& text) { return reinterpret_cast<const uint8_t*>(text.data()); }
+
+}  // namespace
+
+class RequestChannelTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    client_link_ = std::make_shared<PipeChannel>(ioc_);
+    server_link_ = std::make_shared<PipeChannel>(ioc_);
+    PipeChannel::connect(client_link_, server_link_);
+  }
+
+  void make(const wrapper::RequestChannel::Options& options = {}) {
+    client_ = wrapper::RequestChannel::create(client_link_, ioc_.get_executor(), options);
+    server_ = wrapper::RequestChannel::create(server_link_, ioc_.get_executor(), options);
+  }
+
+  // Answer every request with its own payload
+  void serve_echo() {
+    server_->on_request([this](uint32_t id, const uint8_t* data, size_t size) {
+      server_->respond(id, data, size);
+    });
+  }
+
+  void run_for(std::chrono::milliseconds duration) {
+    ioc_.restart();
+    ioc_.run_for(duration);
+  }
+
+  net::io_context ioc_;
+  std::shared_ptr<PipeChannel> client_link_;
+  std::shared_ptr<PipeChannel> server_link_;
+  std::shared_ptr<wrapper::RequestChannel> client_;
+  std::shared_ptr<wrapper::RequestChannel> server_;
+};
+
+/**
+ * @brief Many requests in flight are matched to replies that arrive out of order
+ */
+TEST_F(RequestChannelTest, PipelinedRequestsMatchOutOfOrderResponses) {
+  make();
+  std::vector<std::pair<uint32_t, std::string>> received;
+  server_->on_request([&](uint32_t id, const uint8_t* data, size_t size) {
+    received.emplace_back(id, std::string(reinterpret_cast<const char*>(data), size));
+    if (received.size() < 8) return;
+    for (auto it = received.rbegin(); it != received.rend(); ++it) {  // Answer newest first
+      std::string reply = "re:" + it->second;
+      server_->respond(it->first, bytes(reply), reply.size());
+    }
+  });
+
+  int answered = 0;
+  for (int i = 0; i < 8; ++i) {
+    std::string request = "req" + std::to_string(i);
+    ASSERT_TRUE(client_->request(bytes(request), request.size(),
+                                 [&answered, request](Status status, const uint8_t* data, size_t size) {
+                                   EXPECT_EQ(status, Status::Ok);
+                                   EXPECT_EQ(std::string(reinterpret_cast<const char*>(data), size), "re:" + request);
+                                   ++answered;
+                                 }));
+  }
+  EXPECT_EQ(client_->in_flight(), 8u);
+
+  run_for(200ms);
+  EXPECT_EQ(answered, 8);
+  EXPECT_EQ(client_->in_flight(), 0u);
+}
+
+/**
+ * @brief The window bounds outstanding requests and frees up as replies arrive
+ */
+TEST_F(RequestChannelTest, WindowLimitsOutstandingRequests) {
+  wrapper::RequestChannel::Options options;
+  options.window = 2;
+  make(options);
+  serve_echo();
+
+  auto ignore = [](Status, const uint8_t*, size_t) {};
+  EXPECT_TRUE(client_->request(bytes("a"), 1, ignore));
+  EXPECT_TRUE(client_->request(bytes("b"), 1, ignore));
+  EXPECT_FALSE(client_->request(bytes("c"), 1, ignore));
+
+  run_for(100ms);
+  EXPECT_EQ(client_->in_flight(), 0u);
+  EXPECT_TRUE(client_->request(bytes("c"), 1, ignore));
+}
+
+/**
+ * @brief The largest window keeps every slot on the deadline list
+ */
+TEST_F(RequestChannelTest, MaximumWindowTimesOutEverySlot) {
+  wrapper::RequestChannel::Options options;
+  options.window = 65536;
+  make(options);
+  ASSERT_EQ(client_->window(), 65535u);
+  server_->on_request([](uint32_t, const uint8_t*, size_t) {});
+
+  size_t timeouts = 0;
+  auto record = [&timeouts](Status status, const uint8_t*, size_t) {
+    if (status == Status::Timeout) ++timeouts;
+  };
+  for (size_t i = 0; i < client_->window(); ++i) {
+    ASSERT_TRUE(client_->request(bytes("x"), 1, record, 50ms));
+  }
+  EXPECT_FALSE(client_->request(bytes("x"), 1, record, 50ms));
+
+  for (int i = 0; i < 50 && timeouts < client_->window(); ++i) run_for(100ms);
+  EXPECT_EQ(timeouts, client_->window());
+  EXPECT_EQ(client_->in_flight(), 0u);
+}
+
+/**
+ * @brief Unanswered requests time out, and a late reply is ignored
+ */
+TEST_F(RequestChannelTest, TimeoutThenLateResponseIgnored) {
+  make();
+  uint32_t pending_id = 0;
+  server_->on_request([&](uint32_t id, const uint8_t*, size_t) { pending_id = id; });
+
+  std::vector<Status> results;
+  auto record = [&results](Status status, const uint8_t*, size_t) { results.push_back(status); };
+  ASSERT_TRUE(client_->request(bytes("slow"), 4, record, 30ms));
+  ASSERT_TRUE(client_->request(bytes("slower"), 6, record, 60ms));
+
+  run_for(45ms);
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_EQ(results[0], Status::Timeout);
+
+  run_for(100ms);
+  ASSERT_EQ(results.size(), 2u);
+  EXPECT_EQ(results[1], Status::Timeout);
+
+  server_->respond(pending_id, bytes("late"), 4);
+  run_for(50ms);
+  EXPECT_EQ(results.size(), 2u);
+  EXPECT_EQ(client_->in_flight(), 0u);
+}
+
+/**
+ * @brief Dropping the link fails outstanding requests
+ */
+TEST_F(RequestChannelTest, ConnectionLossFailsOutstandingRequests) {
+  make();
+  std::vector<Status> results;
+  for (int i = 0; i < 3; ++i) {
+    client_->request(bytes("x"), 1, [&results](Status status, const uint8_t*, size_t) { results.push_back(status); });
+  }
+  client_link_->drop();
+  EXPECT_EQ(results, std::vector<Status>(3, Status::ConnectionLost));
+  EXPECT_FALSE(client_->request(bytes("x"), 1, [](Status, const uint8_t*, size_t) {}));
+}
+
+/**
+ * @brief Frames split across reads are reassembled
+ */
+TEST_F(RequestChannelTest, FragmentedFramesAreReassembled) {
+  make();
+  serve_echo();
+  client_link_->chunk_size = 1;
+  server_link_->chunk_size = 3;
+
+  std::string echoed;
+  std::string payload(100, 'z');
+  client_->request(bytes(payload), payload.size(), [&echoed](Status status, const uint8_t* data, size_t size) {
+    if (status == Status::Ok) echoed.assign(reinterpret_cast<const char*>(data), size);
+  });
+  run_for(100ms);
+  EXPECT_EQ(echoed, payload);
+}
@@ -0,0 +1,259 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "allocation_counter.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#if defined(__GLIBC__)
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#endif
+
+// The sanitizers interpose malloc themselves; count operator new only under them
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+#define UNILINK_COUNT_MALLOC 1
+#endif
+
+namespace {
+
+// Plain integers: thread_local with trivial types needs no allocation or TLS guard
+thread_local uint64_t t_allocations = 0;
+thread_local uint64_t t_bytes = 0;
+
+#if defined(__GLIBC__)
+constexpr int kMaxFrames = 24;
+
+struct CapturedStack {
+  void* frames[kMaxFrames];
+  int depth;
+  size_t size;
+};
+
+// Shared storage, owned by the one thread that is capturing
+CapturedStack g_stacks[unilink::test::AllocationCounter::kMaxStacks];
+std::atomic<size_t> g_stack_count{0};
+thread_local bool t_capturing = false;
+thread_local bool t_in_hook = false;  // backtrace() may allocate on its first call
+
+void capture_stack(size_t size) {
+  if (!t_capturing || t_in_hook) return;
+  size_t index = g_stack_count.load(std::memory_order_relaxed);
+  if (index >= unilink::test::AllocationCounter::kMaxStacks) return;
+  t_in_hook = true;
+  auto& stack = g_stacks[index];
+  stack.depth = backtrace(stack.frames, kMaxFrames);
+  stack.size = size;
+  g_stack_count.store(index + 1, std::memory_order_relaxed);
+  t_in_hook = false;
+}
+#else
+void capture_stack(size_t) {}
+#endif
+
+inline void note_allocation(size_t size) {
+  ++t_allocations;
+  t_bytes += size;
+  capture_stack(size);
+}
+
+void* counted_alloc(std::size_t size) {
+#if !defined(UNILINK_COUNT_MALLOC)
+  note_allocation(size);
+#endif
+  return std::malloc(size ? size : 1);
+}
+
+void* counted_aligned_alloc(std::size_t size, std::align_val_t alignment) {
+  note_allocation(size);
+  auto align = static_cast<std::size_t>(alignment);
+  if (align < sizeof(void*)) align = sizeof(void*);
+  void* ptr = nullptr;
+#if defined(_WIN32)
+  ptr = _aligned_malloc(size ? size : 1, align);
+#else
+  if (posix_memalign(&ptr, align, size ? size : 1) != 0) ptr = nullptr;
+#endif
+  return ptr;
+}
+
+void aligned_free(void* ptr) noexcept {
+#if defined(_WIN32)
+  _aligned_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+
+}  // namespace
+
+namespace unilink {
+namespace test {
+
+uint64_t AllocationCounter::thread_allocations() noexcept { return t_allocations; }
+uint64_t AllocationCounter::thread_bytes() noexcept { return t_bytes; }
+
+void AllocationCounter::start_capture() noexcept {
+#if defined(__GLIBC__)
+  void* warmup[2];
+  t_in_hook = true;
+  backtrace(warmup, 2);  // Loads the unwinder outside the capture window
+  t_in_hook = false;
+  g_stack_count.store(0, std::memory_order_relaxed);
+  t_capturing = true;
+#endif
+}
+
+void AllocationCounter::stop_capture() noexcept {
+#if defined(__GLIBC__)
+  t_capturing = false;
+#endif
+}
+
+size_t AllocationCounter::captured_stacks() noexcept {
+#if defined(__GLIBC__)
+  return g_stack_count.load(std::memory_order_relaxed);
+#else
+  return 0;
+#endif
+}
+
+void AllocationCounter::print_captured_stacks(size_t max_stacks) {
+#if defined(__GLIBC__)
+  size_t count = captured_stacks();
+  if (count > max_stacks) count = max_stacks;
+  for (size_t i = 0; i < count; ++i) {
+    const auto& stack = g_stacks[i];
+    std::fprintf(stderr, "allocation #%zu (%zu bytes):\n", i + 1, stack.size);
+    // Skip the hook frames; the first interesting frame is the allocating function's caller
+    for (int f = 2; f < stack.depth; ++f) {
+      Dl_info info{};
+      const char* module = "?";
+      const char* symbol = nullptr;
+      char* demangled = nullptr;
+      if (dladdr(stack.frames[f], &info)) {
+        if (info.dli_fname) module = info.dli_fname;
+        if (info.dli_sname) {
+          int status = 0;
+          demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+          symbol = status == 0 ? demangled : info.dli_sname;
+        }
+      }
+      // Hidden symbols have no name here; the module offset resolves them with addr2line -Cfe <module>
+      auto offset = static_cast<const char*>(stack.frames[f]) - static_cast<const char*>(info.dli_fbase);
+      std::fprintf(stderr, "  #%-2d %s (%s+0x%tx)\n", f - 2, symbol ? symbol : "??", module, offset);
+      std::free(demangled);
+    }
+  }
+#else
+  (void)max_stacks;
+  std::fprintf(stderr, "allocation stacks are not available on this platform\n");
+#endif
+}
+
+bool AllocationCounter::counts_malloc() noexcept {
+#if defined(UNILINK_COUNT_MALLOC)
+  return true;
+#else
+  return false;
+#endif
+}
+
+}  // namespace test
+}  // namespace unilink
+
+// ============================================================================
+// malloc family (glibc): forward to the allocator's internal entry points
+// ============================================================================
+
+#if defined(UNILINK_COUNT_MALLOC)
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(size_t size) {
+  note_allocation(size);
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+  note_allocation(count * size);
+  return __libc_calloc(count, size);
+}
+
+// Counted as an allocation even when the block grows in place
+void* realloc(void* ptr, size_t size) {
+  if (size != 0) note_allocation(size);
+  return __libc_realloc(ptr, size);
+}
+
+void free(void* ptr) { __libc_free(ptr); }
+}
+#endif
+
+// ============================================================================
+// Global operator new/delete replacements
+// ============================================================================
+
+void* operator new(std::size_t size) {
+  if (void* ptr = counted_alloc(size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+  if (void* ptr = counted_alloc(size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  if (void* ptr = counted_aligned_alloc(size, alignment)) return ptr;
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  if (void* ptr = counted_aligned_alloc(size, alignment)) return ptr;
+  throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  return counted_aligned_alloc(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  return counted_aligned_alloc(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { aligned_free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { aligned_free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { aligned_free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { aligned_free(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { aligned_free(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { aligned_free(ptr); }
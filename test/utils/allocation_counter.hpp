@@ -0,0 +1,75 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace unilink {
+namespace test {
+
+/**
+ * @brief Per-thread heap allocation counts
+ *
+ * Backed by replacements of the global operator new/delete in
+ * allocation_counter.cc; only executables that compile that file count
+ * anything. With glibc the malloc family is interposed as well, so C-level
+ * allocations are included. Counts cover the calling thread only, so code
+ * under test must run its handlers on the measuring thread (for example by
+ * running the io_context there).
+ */
+class AllocationCounter {
+ public:
+  static uint64_t thread_allocations() noexcept;
+  static uint64_t thread_bytes() noexcept;
+
+  /**
+   * @brief Record the call stacks of this thread's allocations
+   *
+   * Only one thread captures at a time; the first kMaxStacks allocations
+   * after start_capture() are kept. No-op where stack walking is unavailable.
+   */
+  static void start_capture() noexcept;
+  static void stop_capture() noexcept;
+  static size_t captured_stacks() noexcept;
+
+  // Write the captured stacks, symbolized where possible, to stderr
+  static void print_captured_stacks(size_t max_stacks = kMaxStacks);
+
+  static bool counts_malloc() noexcept;
+
+  static constexpr size_t kMaxStacks = 32;
+};
+
+/**
+ * @brief Allocations made by this thread since construction
+ */
+class ScopedAllocationCount {
+ public:
+  ScopedAllocationCount() noexcept
+      : allocations_(AllocationCounter::thread_allocations()), bytes_(AllocationCounter::thread_bytes()) {}
+
+  uint64_t allocations() const noexcept { return AllocationCounter::thread_allocations() - allocations_; }
+  uint64_t bytes() const noexcept { return AllocationCounter::thread_bytes() - bytes_; }
+
+ private:
+  uint64_t allocations_;
+  uint64_t bytes_;
+};
+
+}  // namespace test
+}  // namespace unilink
@@ -60,8 +60,9 @@ class TestUtils {
     // Use very wide port spacing (100) to completely avoid TIME_WAIT conflicts
     // Each test gets ports with 100-port gaps (30000, 30100, 30200, ...)
     // This ensures that even in heavy parallel execution, ports don't conflict
-    static std::atomic<uint16_t> port_counter{30000};  // Start from higher port range
-    uint16_t port = port_counter.fetch_add(100);       // Skip 100 ports for each test
+    // ctest runs every test in its own process, so each process starts at a random slot
+    static std::atomic<uint16_t> port_counter{static_cast<uint16_t>(30000 + 100 * (std::random_device{}() % 300))};
+    uint16_t port = port_counter.fetch_add(100);  // Skip 100 ports for each test
 
     // Ensure port is in valid range and avoid system ports
     if (port < 30000 || port > 60000) {
@@ -77,9 +78,12 @@ class TestUtils {
    * @return uint16_t Available port number
    */
   static uint16_t getAvailableTestPort() {
-    // Use atomic counter with very wide spacing (100 ports) for parallel execution
-    // This completely prevents TIME_WAIT state conflicts and TOCTOU race conditions
-    return getTestPort();  // No delay or checking needed with 100-port spacing
+    // Wide spacing avoids TIME_WAIT conflicts within a process; skip ports another test process holds
+    uint16_t port = getTestPort();
+    for (int attempt = 0; attempt < 10 && !isPortAvailable(port); ++attempt) {
+      port = getTestPort();
+    }
+    return port;
   }
 
   /**
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @brief Render binary log segments written by Logger::set_binary_output
+ *
+ * Usage: unilink_log_decode <file> [<file>...]
+ *
+ * Segments are decoded in the order given; pass rotated segments oldest
+ * first (app.1.ulog app.2.ulog app.ulog) to get a chronological log.
+ */
+
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "unilink/common/binary_log.hpp"
+
+namespace {
+
+const char* level_name(uint8_t level) {
+  static const char* const names[] = {"DEBUG", "INFO", "WARNING", "ERROR", "CRITICAL"};
+  return level < 5 ? names[level] : "UNKNOWN";
+}
+
+std::string format_timestamp(uint64_t timestamp_ns) {
+  auto seconds = static_cast<std::time_t>(timestamp_ns / 1000000000ULL);
+  auto micros = (timestamp_ns / 1000ULL) % 1000000ULL;
+
+  std::tm tm_buf{};
+#if defined(_WIN32)
+  localtime_s(&tm_buf, &seconds);
+#else
+  localtime_r(&seconds, &tm_buf);
+#endif
+
+  std::ostringstream oss;
+  oss << std::put_time(&tm_buf, "%Y-%m-%d %H:%M:%S") << '.' << std::setfill('0') << std::setw(6) << micros;
+  return oss.str();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <binary-log> [<binary-log>...]" << std::endl;
+    return 2;
+  }
+
+  int status = 0;
+  for (int i = 1; i < argc; ++i) {
+    std::string error;
+    bool ok = unilink::common::BinaryLogReader::decode_file(
+        argv[i],
+        [](const unilink::common::DecodedRecord& record) {
+          std::cout << format_timestamp(record.timestamp_ns) << " [" << level_name(record.level) << "] ["
+                    << record.component << "] [" << record.operation << "] " << record.message
+                    << (record.truncated ? " [truncated]" : "") << '\n';
+        },
+        &error);
+
+    if (!ok) {
+      std::cerr << "unilink_log_decode: " << error << std::endl;
+      status = 1;
+    }
+  }
+
+  std::cout.flush();
+  return status;
+}
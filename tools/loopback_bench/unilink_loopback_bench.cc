@@ -0,0 +1,356 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @brief Loopback throughput/latency matrix for TcpServer and TcpClient
+ *
+ * Usage: unilink_loopback_bench [--payload=64,1024,16384] [--clients=1,8,32]
+ *                               [--threads=1,4] [--batch=1,16] [--window=64]
+ *                               [--duration=1.0] [--warmup=0.25] [--port=47000]
+ *                               [--output=results.json]
+ *
+ * Every combination of payload size, client count, io thread count and batch
+ * size is run against a fresh echo server on 127.0.0.1. Each client keeps up
+ * to <window> messages in flight and sends <batch> messages per
+ * async_write_copy() call. Messages carry their send time, so the round-trip
+ * latency of every echoed message is recorded. Results are written as JSON to
+ * stdout (or --output); progress goes to stderr.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "unilink/common/channel_metrics.hpp"
+#include "unilink/common/constants.hpp"
+#include "unilink/common/io_context_pool.hpp"
+#include "unilink/common/logger.hpp"
+#include "unilink/transport/tcp_client/tcp_client.hpp"
+#include "unilink/transport/tcp_server/boost_tcp_acceptor.hpp"
+#include "unilink/transport/tcp_server/tcp_server.hpp"
+
+namespace {
+
+using namespace unilink;
+using Clock = std::chrono::steady_clock;
+
+// Every message starts with its send time and a sequence number
+constexpr size_t kHeaderSize = 2 * sizeof(uint64_t);
+
+struct Options {
+  std::vector<size_t> payloads{64, 1024, 16384};
+  std::vector<size_t> clients{1, 8, 32};
+  std::vector<size_t> threads{1, 4};
+  std::vector<size_t> batches{1, 16};
+  size_t window = 64;
+  double duration_s = 1.0;
+  double warmup_s = 0.25;
+  uint16_t port = 47000;
+  std::string output;
+};
+
+struct RunConfig {
+  size_t payload;
+  size_t clients;
+  size_t threads;
+  size_t batch;
+};
+
+// Shared by all clients of one run
+struct RunState {
+  std::atomic<bool> measuring{false};
+  std::atomic<bool> stopping{false};
+  common::PaddedCounter messages;
+  common::LatencyHistogram latency_ns;
+};
+
+uint64_t now_ns() {
+  auto since_epoch = Clock::now().time_since_epoch();
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch).count());
+}
+
+/**
+ * @brief One pipelining client; all members are used on its io_context only
+ */
+class ClientDriver : public std::enable_shared_from_this<ClientDriver> {
+ public:
+  ClientDriver(const RunConfig& run, size_t window, RunState& state, uint16_t port, boost::asio::io_context& ioc)
+      : run_(run), window_(std::max(window, run.batch)), state_(state), ioc_(ioc) {
+    config::TcpClientConfig cfg;
+    cfg.host = "127.0.0.1";
+    cfg.port = port;
+    cfg.retry_interval_ms = 50;
+    cfg.backpressure_threshold = common::constants::MAX_BACKPRESSURE_THRESHOLD;
+    client_ = std::make_shared<transport::TcpClient>(cfg, ioc);
+    partial_.resize(run.payload);
+    send_buffer_.resize(run.payload * run.batch);
+  }
+
+  void start() {
+    client_->on_bytes([weak = weak_from_this()](const uint8_t* data, size_t size) {
+      if (auto self = weak.lock()) self->on_bytes(data, size);
+    });
+    client_->start();
+  }
+
+  // Fill the window once connected; later sends are driven by echoes
+  void kick() {
+    boost::asio::post(ioc_, [self = shared_from_this()] { self->pump(); });
+  }
+
+  void stop() { client_->stop(); }
+  bool connected() const { return client_->is_connected(); }
+
+ private:
+  void pump() {
+    while (!state_.stopping.load(std::memory_order_relaxed) && in_flight_ + run_.batch <= window_) {
+      for (size_t i = 0; i < run_.batch; ++i) {
+        uint8_t* message = send_buffer_.data() + i * run_.payload;
+        uint64_t header[2] = {now_ns(), sequence_++};
+        std::memcpy(message, header, sizeof(header));
+      }
+      client_->async_write_copy(send_buffer_.data(), send_buffer_.size());
+      in_flight_ += run_.batch;
+    }
+  }
+
+  void on_bytes(const uint8_t* data, size_t size) {
+    while (size > 0) {
+      size_t take = std::min(size, run_.payload - filled_);
+      std::memcpy(partial_.data() + filled_, data, take);
+      filled_ += take;
+      data += take;
+      size -= take;
+      if (filled_ < run_.payload) break;
+
+      filled_ = 0;
+      uint64_t sent_ns;
+      std::memcpy(&sent_ns, partial_.data(), sizeof(sent_ns));
+      if (state_.measuring.load(std::memory_order_relaxed)) {
+        state_.latency_ns.record(now_ns() - sent_ns);
+        state_.messages.add();
+      }
+      if (in_flight_ > 0) --in_flight_;
+    }
+    pump();
+  }
+
+  RunConfig run_;
+  size_t window_;
+  RunState& state_;
+  boost::asio::io_context& ioc_;
+  std::shared_ptr<transport::TcpClient> client_;
+  std::vector<uint8_t> partial_;
+  size_t filled_ = 0;
+  std::vector<uint8_t> send_buffer_;
+  size_t in_flight_ = 0;
+  uint64_t sequence_ = 0;
+};
+
+template <typename Condition>
+bool wait_until(Condition condition, std::chrono::milliseconds timeout) {
+  auto deadline = Clock::now() + timeout;
+  while (Clock::now() < deadline) {
+    if (condition()) return true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  return condition();
+}
+
+std::string run_matrix_cell(const RunConfig& run, const Options& options, uint16_t port) {
+  common::IoContextPool pool(run.threads);
+  RunState state;
+
+  // Echo server on the first context; sessions share its thread
+  config::TcpServerConfig server_cfg;
+  server_cfg.port = port;
+  server_cfg.backpressure_threshold = common::constants::MAX_BACKPRESSURE_THRESHOLD;
+  auto& server_ioc = pool.get_context(0);
+  auto server = std::make_shared<transport::TcpServer>(
+      server_cfg, std::make_unique<transport::BoostTcpAcceptor>(server_ioc), server_ioc);
+  transport::TcpServer* echo = server.get();
+  server->on_bytes([](const uint8_t*, size_t) {});
+  server->on_multi_data([echo](size_t client_id, const std::string& data) { echo->send_to_client(client_id, data); });
+
+  std::vector<std::shared_ptr<ClientDriver>> drivers;
+  for (size_t i = 0; i < run.clients; ++i) {
+    drivers.push_back(std::make_shared<ClientDriver>(run, options.window, state, port, pool.get_context(i)));
+  }
+
+  pool.start();
+  server->start();
+  for (auto& driver : drivers) driver->start();
+
+  std::ostringstream json;
+  json << "{\"payload\":" << run.payload << ",\"clients\":" << run.clients << ",\"io_threads\":" << run.threads
+       << ",\"batch\":" << run.batch << ",\"window\":" << std::max(options.window, run.batch);
+
+  bool ready = wait_until(
+      [&] {
+        return server->get_client_count() == run.clients &&
+               std::all_of(drivers.begin(), drivers.end(), [](const auto& d) { return d->connected(); });
+      },
+      std::chrono::seconds(10));
+
+  if (ready) {
+    for (auto& driver : drivers) driver->kick();
+    std::this_thread::sleep_for(std::chrono::duration<double>(options.warmup_s));
+
+    state.measuring = true;
+    auto started = Clock::now();
+    std::this_thread::sleep_for(std::chrono::duration<double>(options.duration_s));
+    state.measuring = false;
+    double elapsed = std::chrono::duration<double>(Clock::now() - started).count();
+
+    uint64_t messages = state.messages.load();
+    auto latency = state.latency_ns.snapshot();
+    double rate = static_cast<double>(messages) / elapsed;
+    json << ",\"messages\":" << messages << ",\"seconds\":" << elapsed << ",\"messages_per_second\":" << rate
+         << ",\"megabytes_per_second\":" << rate * static_cast<double>(run.payload) / 1e6 << ",\"latency_ns\":{"
+         << "\"mean\":" << static_cast<uint64_t>(latency.mean()) << ",\"p50\":" << latency.percentile(50)
+         << ",\"p90\":" << latency.percentile(90) << ",\"p99\":" << latency.percentile(99)
+         << ",\"p999\":" << latency.percentile(99.9) << ",\"max\":" << latency.max << "}}";
+
+    std::cerr << "payload=" << run.payload << " clients=" << run.clients << " threads=" << run.threads
+              << " batch=" << run.batch << ": " << static_cast<uint64_t>(rate) << " msg/s, p50 "
+              << latency.percentile(50) / 1000 << " us, p99 " << latency.percentile(99) / 1000 << " us" << std::endl;
+  } else {
+    json << ",\"error\":\"clients did not connect\"}";
+    std::cerr << "payload=" << run.payload << " clients=" << run.clients << ": clients did not connect" << std::endl;
+  }
+
+  state.stopping = true;
+  for (auto& driver : drivers) driver->stop();
+  server->stop();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  pool.stop();
+  drivers.clear();
+  server.reset();
+  return json.str();
+}
+
+bool parse_list(const std::string& text, std::vector<size_t>& out) {
+  std::vector<size_t> values;
+  std::istringstream stream(text);
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    try {
+      size_t value = std::stoul(item);
+      if (value == 0) return false;
+      values.push_back(value);
+    } catch (const std::exception&) {
+      return false;
+    }
+  }
+  if (values.empty()) return false;
+  out = std::move(values);
+  return true;
+}
+
+bool parse_options(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    auto eq = arg.find('=');
+    if (arg.rfind("--", 0) != 0 || eq == std::string::npos) return false;
+    std::string key = arg.substr(2, eq - 2);
+    std::string value = arg.substr(eq + 1);
+    try {
+      if (key == "payload") {
+        if (!parse_list(value, options.payloads)) return false;
+      } else if (key == "clients") {
+        if (!parse_list(value, options.clients)) return false;
+      } else if (key == "threads") {
+        if (!parse_list(value, options.threads)) return false;
+      } else if (key == "batch") {
+        if (!parse_list(value, options.batches)) return false;
+      } else if (key == "window") {
+        options.window = std::stoul(value);
+      } else if (key == "duration") {
+        options.duration_s = std::stod(value);
+      } else if (key == "warmup") {
+        options.warmup_s = std::stod(value);
+      } else if (key == "port") {
+        options.port = static_cast<uint16_t>(std::stoul(value));
+      } else if (key == "output") {
+        options.output = value;
+      } else {
+        return false;
+      }
+    } catch (const std::exception&) {
+      return false;
+    }
+  }
+  return std::all_of(options.payloads.begin(), options.payloads.end(), [](size_t p) { return p >= kHeaderSize; }) &&
+         options.window > 0 && options.duration_s > 0 && options.port > 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!parse_options(argc, argv, options)) {
+    std::cerr << "Usage: " << argv[0]
+              << " [--payload=N,...] [--clients=N,...] [--threads=N,...] [--batch=N,...]"
+                 " [--window=N] [--duration=SEC] [--warmup=SEC] [--port=N] [--output=FILE]\n"
+                 "Payloads must be at least "
+              << kHeaderSize << " bytes." << std::endl;
+    return 2;
+  }
+
+  common::Logger::instance().set_level(common::LogLevel::ERROR);
+
+  std::ostringstream json;
+  json << "{\"host\":\"127.0.0.1\",\"hardware_threads\":" << std::thread::hardware_concurrency()
+       << ",\"duration_s\":" << options.duration_s << ",\"warmup_s\":" << options.warmup_s << ",\"results\":[";
+
+  uint16_t port = options.port;
+  bool first = true;
+  for (size_t payload : options.payloads) {
+    for (size_t clients : options.clients) {
+      for (size_t threads : options.threads) {
+        for (size_t batch : options.batches) {
+          if (!first) json << ',';
+          first = false;
+          // A fresh port per cell keeps TIME_WAIT sockets of the previous one out of the way
+          json << run_matrix_cell(RunConfig{payload, clients, threads, batch}, options, port++);
+        }
+      }
+    }
+  }
+  json << "]}";
+
+  if (options.output.empty()) {
+    std::cout << json.str() << std::endl;
+  } else {
+    std::ofstream file(options.output);
+    file << json.str() << '\n';
+    if (!file) {
+      std::cerr << "unilink_loopback_bench: cannot write " << options.output << std::endl;
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -29,6 +29,7 @@ SerialBuilder::SerialBuilder(const std::string& device, uint32_t baud_rate)
       baud_rate_(baud_rate),
       auto_manage_(false),
       use_independent_context_(false),
+      executor_(nullptr),
       retry_interval_ms_(3000) {
   // Validate input parameters
   try {
@@ -48,7 +49,9 @@ std::unique_ptr<wrapper::Serial> SerialBuilder::build() {
     common::InputValidator::validate_retry_interval(retry_interval_ms_);
 
     // IoContext management
-    if (use_independent_context_) {
+    if (executor_) {
+      // Application-owned context: nothing to start here
+    } else if (use_independent_context_) {
       // Use independent IoContext (for test isolation)
       // Create independent context through IoContextManager
       auto independent_context = common::IoContextManager::instance().create_independent_context();
@@ -58,7 +61,8 @@ std::unique_ptr<wrapper::Serial> SerialBuilder::build() {
       // Default behavior (Serial manages IoContext independently)
     }
 
-    auto serial = std::make_unique<wrapper::Serial>(device_, baud_rate_);
+    auto serial = executor_ ? std::make_unique<wrapper::Serial>(device_, baud_rate_, *executor_)
+                            : std::make_unique<wrapper::Serial>(device_, baud_rate_);
 
     // Apply configuration with exception safety
     try {
@@ -136,6 +140,16 @@ SerialBuilder& SerialBuilder::use_independent_context(bool use_independent) {
   return *this;
 }
 
+SerialBuilder& SerialBuilder::executor(boost::asio::io_context& ioc) {
+  executor_ = &ioc;
+  return *this;
+}
+
+SerialBuilder& SerialBuilder::executor(common::IoContextPool& pool) {
+  executor_ = &pool.get_context();
+  return *this;
+}
+
 SerialBuilder& SerialBuilder::retry_interval(unsigned interval_ms) {
   try {
     common::InputValidator::validate_retry_interval(interval_ms);
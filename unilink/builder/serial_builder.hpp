@@ -26,6 +26,7 @@
 #include <string>
 
 #include "unilink/builder/ibuilder.hpp"
+#include "unilink/common/io_context_pool.hpp"
 #include "unilink/wrapper/serial/serial.hpp"
 
 namespace unilink {
@@ -156,6 +157,25 @@ class UNILINK_EXPORT SerialBuilder : public BuilderInterface<wrapper::Serial> {
    */
   SerialBuilder& use_independent_context(bool use_independent = true);
 
+  /**
+   * @brief Run the serial on an io_context owned by the application
+   *
+   * Callbacks are invoked on the thread(s) running the context, so they can
+   * share state with the application's own handlers without extra hops. No
+   * unilink thread is started. The context must be run by a single thread
+   * and outlive the serial. Takes precedence over use_independent_context().
+   * @param ioc The io_context to run on
+   * @return SerialBuilder& Reference to this builder for method chaining
+   */
+  SerialBuilder& executor(boost::asio::io_context& ioc);
+
+  /**
+   * @brief Run the serial on the next context of an IoContextPool
+   * @param pool The pool to take a context from; must outlive the serial
+   * @return SerialBuilder& Reference to this builder for method chaining
+   */
+  SerialBuilder& executor(common::IoContextPool& pool);
+
   /**
    * @brief Set retry interval for automatic reconnection
    * @param interval_ms Retry interval in milliseconds
@@ -168,6 +188,7 @@ class UNILINK_EXPORT SerialBuilder : public BuilderInterface<wrapper::Serial> {
   uint32_t baud_rate_;
   bool auto_manage_;
   bool use_independent_context_;
+  boost::asio::io_context* executor_;  // Null means the shared or independent context
   unsigned retry_interval_ms_;
 
   std::function<void(const std::string&)> on_data_;
@@ -26,7 +26,12 @@ namespace unilink {
 namespace builder {
 
 TcpClientBuilder::TcpClientBuilder(const std::string& host, uint16_t port)
-    : host_(host), port_(port), auto_manage_(false), use_independent_context_(false), retry_interval_ms_(3000) {
+    : host_(host),
+      port_(port),
+      auto_manage_(false),
+      use_independent_context_(false),
+      executor_(nullptr),
+      retry_interval_ms_(3000) {
   // Validate input parameters
   try {
     common::InputValidator::validate_host(host_);
@@ -45,7 +50,9 @@ std::unique_ptr<wrapper::TcpClient> TcpClientBuilder::build() {
     common::InputValidator::validate_retry_interval(retry_interval_ms_);
 
     // IoContext management
-    if (use_independent_context_) {
+    if (executor_) {
+      // Application-owned context: nothing to start here
+    } else if (use_independent_context_) {
       // Use independent IoContext (for test isolation)
       // Create independent context through IoContextManager
       auto independent_context = common::IoContextManager::instance().create_independent_context();
@@ -56,7 +63,8 @@ std::unique_ptr<wrapper::TcpClient> TcpClientBuilder::build() {
       AutoInitializer::ensure_io_context_running();
     }
 
-    auto client = std::make_unique<wrapper::TcpClient>(host_, port_);
+    auto client = executor_ ? std::make_unique<wrapper::TcpClient>(host_, port_, *executor_)
+                            : std::make_unique<wrapper::TcpClient>(host_, port_);
 
     // Apply configuration with exception safety
     try {
@@ -135,6 +143,16 @@ TcpClientBuilder& TcpClientBuilder::use_independent_context(bool use_independent
   return *this;
 }
 
+TcpClientBuilder& TcpClientBuilder::executor(boost::asio::io_context& ioc) {
+  executor_ = &ioc;
+  return *this;
+}
+
+TcpClientBuilder& TcpClientBuilder::executor(common::IoContextPool& pool) {
+  executor_ = &pool.get_context();
+  return *this;
+}
+
 TcpClientBuilder& TcpClientBuilder::retry_interval(unsigned interval_ms) {
   try {
     common::InputValidator::validate_retry_interval(interval_ms);
@@ -29,6 +29,7 @@ TcpServerBuilder::TcpServerBuilder(uint16_t port)
     : port_(port),
       auto_manage_(false),
       use_independent_context_(false),
+      executor_(nullptr),
       enable_port_retry_(false),
       max_port_retries_(3),
       port_retry_interval_ms_(common::constants::DEFAULT_RETRY_INTERVAL_MS / 2),
@@ -52,7 +53,9 @@ std::unique_ptr<wrapper::TcpServer> TcpServerBuilder::build() {
   }
 
   // IoContext management
-  if (use_independent_context_) {
+  if (executor_) {
+    // Application-owned context: nothing to start here
+  } else if (use_independent_context_) {
     // Use independent IoContext (for test isolation)
     // Create independent context through IoContextManager
     auto independent_context = common::IoContextManager::instance().create_independent_context();
@@ -62,7 +65,8 @@ std::unique_ptr<wrapper::TcpServer> TcpServerBuilder::build() {
     AutoInitializer::ensure_io_context_running();
   }
 
-  auto server = std::make_unique<wrapper::TcpServer>(port_);
+  auto server = executor_ ? std::make_unique<wrapper::TcpServer>(port_, *executor_)
+                          : std::make_unique<wrapper::TcpServer>(port_);
 
   // Apply client limit configuration
   UNILINK_LOG_DEBUG(
@@ -174,6 +178,16 @@ TcpServerBuilder& TcpServerBuilder::use_independent_context(bool use_independent
   return *this;
 }
 
+TcpServerBuilder& TcpServerBuilder::executor(boost::asio::io_context& ioc) {
+  executor_ = &ioc;
+  return *this;
+}
+
+TcpServerBuilder& TcpServerBuilder::executor(common::IoContextPool& pool) {
+  executor_ = &pool.get_context();
+  return *this;
+}
+
 // Multi-client support method implementation
 TcpServerBuilder& TcpServerBuilder::on_multi_connect(std::function<void(size_t, const std::string&)> handler) {
   on_multi_connect_ = std::move(handler);
@@ -25,6 +25,7 @@
 #include <cstdint>
 
 #include "unilink/builder/ibuilder.hpp"
+#include "unilink/common/io_context_pool.hpp"
 #include "unilink/wrapper/tcp_server/tcp_server.hpp"
 
 namespace unilink {
@@ -175,6 +176,25 @@ class UNILINK_EXPORT TcpServerBuilder : public BuilderInterface<wrapper::TcpServ
    */
   TcpServerBuilder& use_independent_context(bool use_independent = true);
 
+  /**
+   * @brief Run the server on an io_context owned by the application
+   *
+   * Callbacks are invoked on the thread(s) running the context, so they can
+   * share state with the application's own handlers without extra hops. No
+   * unilink thread is started. The context must be run by a single thread
+   * and outlive the server. Takes precedence over use_independent_context().
+   * @param ioc The io_context to run on
+   * @return TcpServerBuilder& Reference to this builder for method chaining
+   */
+  TcpServerBuilder& executor(boost::asio::io_context& ioc);
+
+  /**
+   * @brief Run the server on the next context of an IoContextPool
+   * @param pool The pool to take a context from; must outlive the server
+   * @return TcpServerBuilder& Reference to this builder for method chaining
+   */
+  TcpServerBuilder& executor(common::IoContextPool& pool);
+
   // Multi-client support methods
   /**
    * @brief Set multi-client connection handler callback
@@ -238,6 +258,7 @@ class UNILINK_EXPORT TcpServerBuilder : public BuilderInterface<wrapper::TcpServ
   uint16_t port_;
   bool auto_manage_;
   bool use_independent_context_;
+  boost::asio::io_context* executor_;  // Null means the shared or independent context
 
   // Port retry configuration
   bool enable_port_retry_;
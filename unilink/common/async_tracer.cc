@@ -0,0 +1,218 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "unilink/common/async_tracer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+#include "unilink/common/channel_metrics.hpp"
+
+namespace unilink {
+namespace common {
+
+namespace {
+
+struct Event {
+  uint64_t ticks;
+  uintptr_t channel;
+  const char* name;
+  uint64_t value;
+  uint8_t track;
+  char phase;
+};
+
+const char* track_name(uint8_t track) {
+  switch (static_cast<AsyncTracer::Track>(track)) {
+    case AsyncTracer::Track::Lifecycle:
+      return "lifecycle";
+    case AsyncTracer::Track::Read:
+      return "read";
+    case AsyncTracer::Track::Write:
+      return "write";
+  }
+  return "other";
+}
+
+void write_json_string(std::ostream& out, const std::string& text) {
+  out << '"';
+  for (char c : text) {
+    switch (c) {
+      case '"':
+        out << "\\\"";
+        break;
+      case '\\':
+        out << "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[8];
+          std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+          out << escaped;
+        } else {
+          out << c;
+        }
+    }
+  }
+  out << '"';
+}
+
+}  // namespace
+
+std::atomic<bool> AsyncTracer::enabled_{false};
+
+AsyncTracer& AsyncTracer::instance() {
+  static AsyncTracer tracer;
+  return tracer;
+}
+
+void AsyncTracer::enable(size_t capacity) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!slots_) {
+    size_t size = 1;
+    while (size < capacity) size <<= 1;
+    slots_.reset(new Slot[size]);
+    capacity_ = size;
+    mask_ = size - 1;
+    FastClock::calibrate();
+  }
+  enabled_.store(true, std::memory_order_release);
+}
+
+void AsyncTracer::disable() { enabled_.store(false, std::memory_order_release); }
+
+void AsyncTracer::record(const void* channel, Track track, char phase, const char* name, uint64_t value) {
+  // Pairs with the release store in enable(): call sites only made a relaxed check
+  std::atomic_thread_fence(std::memory_order_acquire);
+
+  uint64_t index = head_.fetch_add(1, std::memory_order_relaxed);
+  Slot& slot = slots_[index & mask_];
+  const uint64_t claimed = 2 * index + 1;
+
+  // Claim the slot only after the previous lap published it, so two writers never fill it at once
+  uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+  while (true) {
+    if (seq > claimed) return;  // Lapped: a newer event owns the slot
+    if (seq & 1) {
+      std::this_thread::yield();  // An older writer is mid-event; it never waits, so this ends
+      seq = slot.seq.load(std::memory_order_relaxed);
+      continue;
+    }
+    if (slot.seq.compare_exchange_weak(seq, claimed, std::memory_order_relaxed)) break;
+  }
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.ticks.store(FastClock::now(), std::memory_order_relaxed);
+  slot.channel.store(reinterpret_cast<uintptr_t>(channel), std::memory_order_relaxed);
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.value.store(value, std::memory_order_relaxed);
+  slot.track.store(static_cast<uint8_t>(track), std::memory_order_relaxed);
+  slot.phase.store(phase, std::memory_order_relaxed);
+  slot.seq.store(2 * index + 2, std::memory_order_release);
+}
+
+void AsyncTracer::name_channel(const void* channel, std::string label) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  labels_[reinterpret_cast<uintptr_t>(channel)] = std::move(label);
+}
+
+void AsyncTracer::clear() { start_.store(head_.load(std::memory_order_acquire), std::memory_order_release); }
+
+size_t AsyncTracer::dump(std::ostream& out) const {
+  std::vector<Event> events;
+  std::unordered_map<uintptr_t, std::string> labels;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    labels = labels_;
+    if (slots_) {
+      uint64_t head = head_.load(std::memory_order_acquire);
+      uint64_t first = std::max(start_.load(std::memory_order_acquire), head > capacity_ ? head - capacity_ : 0);
+      events.reserve(static_cast<size_t>(head - first));
+      for (uint64_t index = first; index < head; ++index) {
+        const Slot& slot = slots_[index & mask_];
+        uint64_t seq = slot.seq.load(std::memory_order_acquire);
+        if (seq != 2 * index + 2) continue;  // Still being written or already overwritten
+        Event event{slot.ticks.load(std::memory_order_relaxed), slot.channel.load(std::memory_order_relaxed),
+                    slot.name.load(std::memory_order_relaxed),  slot.value.load(std::memory_order_relaxed),
+                    slot.track.load(std::memory_order_relaxed), slot.phase.load(std::memory_order_relaxed)};
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) != seq) continue;
+        events.push_back(event);
+      }
+    }
+  }
+  std::stable_sort(events.begin(), events.end(), [](const Event& a, const Event& b) { return a.ticks < b.ticks; });
+
+  // One process per channel in order of first appearance
+  std::unordered_map<uintptr_t, size_t> pids;
+  std::vector<uintptr_t> channels;
+  for (const auto& event : events) {
+    if (pids.emplace(event.channel, channels.size() + 1).second) channels.push_back(event.channel);
+  }
+
+  out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  bool first_entry = true;
+  auto separator = [&out, &first_entry] {
+    if (!first_entry) out << ",";
+    out << "\n";
+    first_entry = false;
+  };
+
+  for (uintptr_t channel : channels) {
+    size_t pid = pids[channel];
+    char address[32];
+    std::snprintf(address, sizeof(address), "0x%llx", static_cast<unsigned long long>(channel));
+    auto label = labels.find(channel);
+    std::string name = (label != labels.end() ? label->second + " " : std::string("channel ")) + address;
+    separator();
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"args\":{\"name\":";
+    write_json_string(out, name);
+    out << "}}";
+    for (uint8_t track = 0; track <= static_cast<uint8_t>(Track::Write); ++track) {
+      separator();
+      out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << static_cast<int>(track)
+          << ",\"args\":{\"name\":\"" << track_name(track) << "\"}}";
+    }
+  }
+
+  uint64_t origin = events.empty() ? 0 : events.front().ticks;
+  char timestamp[32];
+  for (const auto& event : events) {
+    double micros = static_cast<double>(FastClock::to_ns(event.ticks - origin)) / 1000.0;
+    std::snprintf(timestamp, sizeof(timestamp), "%.3f", micros);
+    separator();
+    out << "{\"name\":\"" << event.name << "\",\"cat\":\"unilink\",\"ph\":\"" << event.phase
+        << "\",\"ts\":" << timestamp << ",\"pid\":" << pids[event.channel]
+        << ",\"tid\":" << static_cast<int>(event.track);
+    if (event.phase == 'C') out << ",\"args\":{\"" << event.name << "\":" << event.value << "}";
+    out << "}";
+  }
+  out << "\n]}\n";
+  return events.size();
+}
+
+bool AsyncTracer::dump(const std::string& path) const {
+  std::ofstream file(path, std::ios::trunc);
+  if (!file) return false;
+  dump(file);
+  return static_cast<bool>(file);
+}
+
+}  // namespace common
+}  // namespace unilink
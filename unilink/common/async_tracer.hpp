@@ -0,0 +1,117 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#if __has_include(<unilink_export.hpp>)
+#include <unilink_export.hpp>
+#else
+#define UNILINK_EXPORT
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace unilink {
+namespace common {
+
+/**
+ * @brief Opt-in timeline of async operations per channel
+ *
+ * Transports record begin/end events for resolve, connect, reads, writes
+ * and retry waits, plus their send-queue depth, into a fixed ring buffer.
+ * dump() writes them in the Chrome trace event format, which chrome://tracing
+ * and ui.perfetto.dev open directly: each channel is a process with one
+ * track per operation kind, so overlapping reads and writes stay readable.
+ *
+ * Recording is lock-free: a writer takes an index with one atomic increment,
+ * claims the slot once the previous lap has published it and publishes with a
+ * sequence number. The oldest events are overwritten once the buffer is full,
+ * a writer that was lapped drops its event, and dump() skips slots that are
+ * being written. begin(), end() and counter() are static; while disabled each
+ * call site costs one inline relaxed load and does not touch instance().
+ *
+ * Event names must be string literals; only the pointer is stored.
+ */
+class AsyncTracer {
+ public:
+  enum class Track : uint8_t { Lifecycle, Read, Write };
+
+  static AsyncTracer& instance();
+
+  // The buffer is allocated by the first enable() and kept for the process lifetime
+  void enable(size_t capacity = 1 << 16);
+  void disable();
+  static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+  static void begin(const void* channel, Track track, const char* name) {
+    if (enabled()) instance().record(channel, track, 'B', name, 0);
+  }
+  static void end(const void* channel, Track track, const char* name) {
+    if (enabled()) instance().record(channel, track, 'E', name, 0);
+  }
+  static void counter(const void* channel, const char* name, uint64_t value) {
+    if (enabled()) instance().record(channel, Track::Lifecycle, 'C', name, value);
+  }
+
+  // Label shown for a channel's process row
+  void name_channel(const void* channel, std::string label);
+
+  // Drop recorded events; labels are kept
+  void clear();
+
+  // Chrome trace JSON of the events currently in the buffer; returns the number of events
+  size_t dump(std::ostream& out) const;
+  bool dump(const std::string& path) const;
+
+  size_t capacity() const { return capacity_; }
+
+ private:
+  struct Slot {
+    std::atomic<uint64_t> seq{0};  // 2 * index + 2 once published, odd while written
+    std::atomic<uint64_t> ticks{0};
+    std::atomic<uintptr_t> channel{0};
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64_t> value{0};
+    std::atomic<uint8_t> track{0};
+    std::atomic<char> phase{0};
+  };
+
+  AsyncTracer() = default;
+  AsyncTracer(const AsyncTracer&) = delete;
+  AsyncTracer& operator=(const AsyncTracer&) = delete;
+
+  void record(const void* channel, Track track, char phase, const char* name, uint64_t value);
+
+  UNILINK_EXPORT static std::atomic<bool> enabled_;  // Static so call sites check it without instance()
+  std::unique_ptr<Slot[]> slots_;
+  size_t capacity_ = 0;
+  size_t mask_ = 0;
+  std::atomic<uint64_t> head_{0};
+  std::atomic<uint64_t> start_{0};  // First index kept after clear()
+
+  mutable std::mutex mutex_;  // Guards enable() and labels_
+  std::unordered_map<uintptr_t, std::string> labels_;
+};
+
+}  // namespace common
+}  // namespace unilink
@@ -0,0 +1,517 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "binary_log.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iterator>
+#include <map>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace unilink {
+namespace common {
+
+namespace binary_log {
+
+void ArgBuffer::add_string(std::string_view value) {
+  if (size_ + 1 + sizeof(uint32_t) > data_.size()) {
+    truncated_ = true;
+    return;
+  }
+  size_t room = data_.size() - size_ - 1 - sizeof(uint32_t);
+  auto length = static_cast<uint32_t>(std::min(value.size(), room));
+  if (length < value.size()) {
+    truncated_ = true;
+  }
+
+  data_[size_++] = static_cast<uint8_t>(ArgType::STRING);
+  std::memcpy(data_.data() + size_, &length, sizeof(length));
+  size_ += sizeof(length);
+  std::memcpy(data_.data() + size_, value.data(), length);
+  size_ += length;
+}
+
+namespace {
+
+template <typename V>
+bool read_value(const uint8_t*& cursor, const uint8_t* end, V& value) {
+  if (static_cast<size_t>(end - cursor) < sizeof(V)) {
+    return false;
+  }
+  std::memcpy(&value, cursor, sizeof(V));
+  cursor += sizeof(V);
+  return true;
+}
+
+// Render one argument; returns false on malformed input
+bool render_arg(const uint8_t*& cursor, const uint8_t* end, std::string& out) {
+  uint8_t tag = 0;
+  if (!read_value(cursor, end, tag)) {
+    return false;
+  }
+
+  switch (static_cast<ArgType>(tag)) {
+    case ArgType::INT64: {
+      int64_t value = 0;
+      if (!read_value(cursor, end, value)) return false;
+      out += std::to_string(value);
+      return true;
+    }
+    case ArgType::UINT64: {
+      uint64_t value = 0;
+      if (!read_value(cursor, end, value)) return false;
+      out += std::to_string(value);
+      return true;
+    }
+    case ArgType::DOUBLE: {
+      double value = 0;
+      if (!read_value(cursor, end, value)) return false;
+      out += std::to_string(value);
+      return true;
+    }
+    case ArgType::BOOL: {
+      uint8_t value = 0;
+      if (!read_value(cursor, end, value)) return false;
+      out += value ? "true" : "false";
+      return true;
+    }
+    case ArgType::STRING: {
+      uint32_t length = 0;
+      if (!read_value(cursor, end, length) || static_cast<size_t>(end - cursor) < length) return false;
+      out.append(reinterpret_cast<const char*>(cursor), length);
+      cursor += length;
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+std::string render(std::string_view format, const uint8_t* args, size_t size) {
+  std::string out;
+  out.reserve(format.size() + size);
+
+  const uint8_t* cursor = args;
+  const uint8_t* end = args + size;
+  size_t pos = 0;
+
+  while (pos < format.size()) {
+    size_t placeholder = format.find("{}", pos);
+    if (placeholder == std::string_view::npos) {
+      out.append(format.substr(pos));
+      break;
+    }
+    out.append(format.substr(pos, placeholder - pos));
+    if (cursor >= end || !render_arg(cursor, end, out)) {
+      out.append("{}");
+    }
+    pos = placeholder + 2;
+  }
+
+  return out;
+}
+
+}  // namespace binary_log
+
+using binary_log::ArgType;
+using binary_log::LogRecord;
+using binary_log::RecordHeader;
+using binary_log::RecordType;
+
+namespace {
+constexpr size_t MIN_SEGMENT_SIZE = 64 * 1024;
+constexpr size_t STRING_PREFIX_SIZE = 1 + sizeof(uint32_t);  // ArgType tag and length
+}  // namespace
+
+BinaryLogWriter::~BinaryLogWriter() { close(); }
+
+bool BinaryLogWriter::open(const std::string& filepath, const BinaryLogConfig& config) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  close_segment();
+
+  filepath_ = filepath;
+  config_ = config;
+  capacity_ = std::max(config_.segment_size_bytes, MIN_SEGMENT_SIZE);
+  load_segment_index();
+
+  // Keep an existing log instead of truncating it
+  std::error_code ec;
+  if (std::filesystem::exists(filepath_, ec) && std::filesystem::file_size(filepath_, ec) > 0) {
+    rotate();
+    return map_ != nullptr;
+  }
+  return open_segment();
+}
+
+void BinaryLogWriter::close() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  close_segment();
+}
+
+bool BinaryLogWriter::is_open() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return map_ != nullptr;
+}
+
+bool BinaryLogWriter::write(uint8_t level, ComponentId component, OperationId operation, FormatId format,
+                            const uint8_t* args, size_t args_size, bool truncated) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return write_locked(level, component, operation, format, truncated ? binary_log::RECORD_TRUNCATED : 0, args,
+                      args_size, {});
+}
+
+bool BinaryLogWriter::write_message(uint8_t level, ComponentId component, OperationId operation, FormatId format,
+                                    std::string_view message) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!map_) {
+    records_dropped_.fetch_add(1);
+    return false;
+  }
+
+  // Cut a message that would not fit even a fresh segment holding all of its name definitions
+  uint16_t flags = 0;
+  if (message.size() > binary_log::MAX_ARGS_SIZE) {
+    size_t overhead = sizeof(binary_log::FILE_MAGIC) + sizeof(RecordHeader) + sizeof(LogRecord) + STRING_PREFIX_SIZE +
+                      3 * sizeof(RecordHeader) + name_of(RecordType::COMPONENT_NAME, component).size() +
+                      name_of(RecordType::OPERATION_NAME, operation).size() +
+                      name_of(RecordType::FORMAT_STRING, format).size();
+    size_t room = capacity_ > overhead ? capacity_ - overhead : 0;
+    if (message.size() > room) {
+      message = message.substr(0, room);
+      flags = binary_log::RECORD_TRUNCATED;
+    }
+  }
+
+  uint8_t prefix[STRING_PREFIX_SIZE];
+  auto length = static_cast<uint32_t>(message.size());
+  prefix[0] = static_cast<uint8_t>(ArgType::STRING);
+  std::memcpy(prefix + 1, &length, sizeof(length));
+  return write_locked(level, component, operation, format, flags, prefix, sizeof(prefix), message);
+}
+
+bool BinaryLogWriter::write_locked(uint8_t level, ComponentId component, OperationId operation, FormatId format,
+                                   uint16_t flags, const uint8_t* args, size_t args_size, std::string_view tail) {
+  if (!map_) {
+    records_dropped_.fetch_add(1);
+    return false;
+  }
+
+  auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::system_clock::now().time_since_epoch())
+                       .count();
+  const size_t payload_size = sizeof(LogRecord) + args_size + tail.size();
+
+  // A rotation resets the names defined in the segment, so size the record again afterwards
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    size_t needed = sizeof(RecordHeader) + payload_size + definition_size(RecordType::COMPONENT_NAME, component) +
+                    definition_size(RecordType::OPERATION_NAME, operation) +
+                    definition_size(RecordType::FORMAT_STRING, format);
+
+    if (offset_ + needed > capacity_) {
+      if (attempt == 0 && offset_ > sizeof(binary_log::FILE_MAGIC)) {
+        rotate();
+        if (!map_) break;
+        continue;
+      }
+      break;
+    }
+
+    define(RecordType::COMPONENT_NAME, component);
+    define(RecordType::OPERATION_NAME, operation);
+    define(RecordType::FORMAT_STRING, format);
+
+    RecordHeader header{static_cast<uint8_t>(RecordType::LOG), level, 0, static_cast<uint32_t>(payload_size)};
+    LogRecord record{static_cast<uint64_t>(timestamp), component, operation, format, flags};
+    append(&header, sizeof(header));
+    append(&record, sizeof(record));
+    append(args, args_size);
+    append(tail.data(), tail.size());
+
+    records_written_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  records_dropped_.fetch_add(1);
+  return false;
+}
+
+void BinaryLogWriter::flush() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!map_) {
+    return;
+  }
+#if defined(_WIN32)
+  if (file_ && offset_ > flushed_) {
+    file_->write(reinterpret_cast<const char*>(map_ + flushed_), static_cast<std::streamsize>(offset_ - flushed_));
+    file_->flush();
+    flushed_ = offset_;
+  }
+#else
+  ::msync(map_, capacity_, MS_ASYNC);
+#endif
+}
+
+bool BinaryLogWriter::open_segment() {
+#if defined(_WIN32)
+  file_ = std::make_unique<std::ofstream>(filepath_, std::ios::binary | std::ios::trunc);
+  if (!file_->is_open()) {
+    file_.reset();
+    return false;
+  }
+  buffer_.assign(capacity_, 0);
+  map_ = buffer_.data();
+  flushed_ = 0;
+#else
+  fd_ = ::open(filepath_.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd_ < 0) {
+    return false;
+  }
+  if (::ftruncate(fd_, static_cast<off_t>(capacity_)) != 0) {
+    ::close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  void* map = ::mmap(nullptr, capacity_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (map == MAP_FAILED) {
+    ::close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  map_ = static_cast<uint8_t*>(map);
+#endif
+
+  offset_ = 0;
+  for (auto& defined : defined_) {
+    defined.clear();
+  }
+  append(binary_log::FILE_MAGIC, sizeof(binary_log::FILE_MAGIC));
+  return true;
+}
+
+void BinaryLogWriter::close_segment() {
+  if (!map_) {
+    return;
+  }
+#if defined(_WIN32)
+  if (file_) {
+    file_->write(reinterpret_cast<const char*>(map_ + flushed_), static_cast<std::streamsize>(offset_ - flushed_));
+    file_->close();
+    file_.reset();
+  }
+  buffer_.clear();
+  buffer_.shrink_to_fit();
+#else
+  ::munmap(map_, capacity_);
+  // Drop the unused tail so the file ends at the last record
+  if (::ftruncate(fd_, static_cast<off_t>(offset_)) != 0) {
+    // Trailing zeros decode as an END record, so the segment stays readable
+  }
+  ::close(fd_);
+  fd_ = -1;
+#endif
+  map_ = nullptr;
+  offset_ = 0;
+}
+
+void BinaryLogWriter::rotate() {
+  close_segment();
+
+  std::string rotated = segment_path(next_index_++);
+  std::error_code ec;
+  std::filesystem::rename(filepath_, rotated, ec);
+  if (!ec) {
+    segments_.push_back(rotated);
+  }
+
+  while (segments_.size() > config_.max_files) {
+    std::filesystem::remove(segments_.front(), ec);
+    segments_.pop_front();
+  }
+
+  open_segment();
+}
+
+std::string BinaryLogWriter::segment_path(size_t index) const {
+  std::filesystem::path path(filepath_);
+  std::filesystem::path name = path.stem();
+  name += "." + std::to_string(index);
+  name += path.extension();
+  return (path.parent_path() / name).string();
+}
+
+void BinaryLogWriter::load_segment_index() {
+  segments_.clear();
+  next_index_ = 1;
+
+  std::filesystem::path path(filepath_);
+  std::filesystem::path directory = path.parent_path().empty() ? std::filesystem::path(".") : path.parent_path();
+  const std::string prefix = path.stem().string() + ".";
+  const std::string extension = path.extension().string();
+
+  // One scan when the file is opened; later rotations keep the index up to date
+  std::map<size_t, std::string> found;
+  std::error_code ec;
+  for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+    std::string filename = entry.path().filename().string();
+    if (filename.size() <= prefix.size() + extension.size() || filename.compare(0, prefix.size(), prefix) != 0 ||
+        filename.compare(filename.size() - extension.size(), extension.size(), extension) != 0) {
+      continue;
+    }
+    std::string index = filename.substr(prefix.size(), filename.size() - prefix.size() - extension.size());
+    if (index.empty() || !std::all_of(index.begin(), index.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+      continue;
+    }
+    found.emplace(std::stoul(index), entry.path().string());
+  }
+
+  for (const auto& [index, file] : found) {
+    segments_.push_back(file);
+    next_index_ = index + 1;
+  }
+}
+
+size_t BinaryLogWriter::definition_size(RecordType type, uint16_t id) const {
+  const auto& defined = defined_[static_cast<size_t>(type)];
+  if (id < defined.size() && defined[id]) {
+    return 0;
+  }
+  return sizeof(RecordHeader) + name_of(type, id).size();
+}
+
+void BinaryLogWriter::define(RecordType type, uint16_t id) {
+  auto& defined = defined_[static_cast<size_t>(type)];
+  if (id < defined.size() && defined[id]) {
+    return;
+  }
+  if (id >= defined.size()) {
+    defined.resize(static_cast<size_t>(id) + 1, false);
+  }
+  defined[id] = true;
+
+  const std::string& name = name_of(type, id);
+  RecordHeader header{static_cast<uint8_t>(type), 0, id, static_cast<uint32_t>(name.size())};
+  append(&header, sizeof(header));
+  append(name.data(), name.size());
+}
+
+void BinaryLogWriter::append(const void* data, size_t size) {
+  if (size == 0) {
+    return;
+  }
+  std::memcpy(map_ + offset_, data, size);
+  offset_ += size;
+}
+
+const std::string& BinaryLogWriter::name_of(RecordType type, uint16_t id) {
+  auto& registry = ComponentRegistry::instance();
+  switch (type) {
+    case RecordType::COMPONENT_NAME:
+      return registry.component_name(id);
+    case RecordType::OPERATION_NAME:
+      return registry.operation_name(id);
+    default:
+      return registry.format_string(id);
+  }
+}
+
+bool BinaryLogReader::decode_file(const std::string& filepath, const RecordHandler& handler, std::string* error) {
+  auto fail = [error](const std::string& message) {
+    if (error) {
+      *error = message;
+    }
+    return false;
+  };
+
+  std::ifstream file(filepath, std::ios::binary);
+  if (!file.is_open()) {
+    return fail("cannot open " + filepath);
+  }
+  std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  if (data.size() < sizeof(binary_log::FILE_MAGIC) ||
+      std::memcmp(data.data(), binary_log::FILE_MAGIC, sizeof(binary_log::FILE_MAGIC)) != 0) {
+    return fail("not a unilink binary log: " + filepath);
+  }
+
+  std::array<std::vector<std::string>, 4> names;
+  auto lookup = [&names](RecordType type, uint16_t id) -> std::string {
+    const auto& table = names[static_cast<size_t>(type)];
+    return id < table.size() ? table[id] : "unknown";
+  };
+
+  size_t offset = sizeof(binary_log::FILE_MAGIC);
+  while (offset + sizeof(RecordHeader) <= data.size()) {
+    RecordHeader header;
+    std::memcpy(&header, data.data() + offset, sizeof(header));
+    offset += sizeof(header);
+
+    auto type = static_cast<RecordType>(header.type);
+    if (type == RecordType::END) {
+      break;
+    }
+    if (header.size > data.size() - offset) {
+      return fail("truncated record in " + filepath);
+    }
+    const uint8_t* payload = data.data() + offset;
+    offset += header.size;
+
+    switch (type) {
+      case RecordType::COMPONENT_NAME:
+      case RecordType::OPERATION_NAME:
+      case RecordType::FORMAT_STRING: {
+        auto& table = names[static_cast<size_t>(type)];
+        if (header.id >= table.size()) {
+          table.resize(static_cast<size_t>(header.id) + 1);
+        }
+        table[header.id].assign(reinterpret_cast<const char*>(payload), header.size);
+        break;
+      }
+      case RecordType::LOG: {
+        if (header.size < sizeof(LogRecord)) {
+          return fail("malformed log record in " + filepath);
+        }
+        LogRecord record;
+        std::memcpy(&record, payload, sizeof(record));
+
+        DecodedRecord decoded;
+        decoded.timestamp_ns = record.timestamp_ns;
+        decoded.level = header.level;
+        decoded.truncated = (record.flags & binary_log::RECORD_TRUNCATED) != 0;
+        decoded.component = lookup(RecordType::COMPONENT_NAME, record.component);
+        decoded.operation = lookup(RecordType::OPERATION_NAME, record.operation);
+        decoded.message = binary_log::render(lookup(RecordType::FORMAT_STRING, record.format),
+                                             payload + sizeof(LogRecord), header.size - sizeof(LogRecord));
+        handler(decoded);
+        break;
+      }
+      default:
+        return fail("unknown record type in " + filepath);
+    }
+  }
+
+  return true;
+}
+
+}  // namespace common
+}  // namespace unilink
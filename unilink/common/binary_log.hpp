@@ -0,0 +1,282 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "component_registry.hpp"
+
+namespace unilink {
+namespace common {
+
+/**
+ * @brief Binary log file configuration
+ */
+struct BinaryLogConfig {
+  size_t segment_size_bytes = 16 * 1024 * 1024;  // Size of one memory-mapped segment
+  size_t max_files = 10;                         // Rotated segments to keep
+
+  BinaryLogConfig() = default;
+
+  BinaryLogConfig(size_t segment_size, size_t max_count) : segment_size_bytes(segment_size), max_files(max_count) {}
+};
+
+namespace binary_log {
+
+constexpr char FILE_MAGIC[8] = {'U', 'N', 'I', 'L', 'O', 'G', 'B', '1'};
+constexpr size_t MAX_ARGS_SIZE = 1024;
+
+// LogRecord::flags bits
+constexpr uint16_t RECORD_TRUNCATED = 0x1;  // Arguments were cut short to fit
+
+/**
+ * @brief Record types in a binary log segment
+ *
+ * Name records define an interned ID the first time a segment references it,
+ * so every segment can be decoded on its own.
+ */
+enum class RecordType : uint8_t { END = 0, COMPONENT_NAME = 1, OPERATION_NAME = 2, FORMAT_STRING = 3, LOG = 4 };
+
+/**
+ * @brief Type tag in front of every encoded argument
+ */
+enum class ArgType : uint8_t { INT64 = 1, UINT64 = 2, DOUBLE = 3, BOOL = 4, STRING = 5 };
+
+/**
+ * @brief Header in front of every record (payload follows)
+ */
+struct RecordHeader {
+  uint8_t type;
+  uint8_t level;
+  uint16_t id;    // Interned ID for name records
+  uint32_t size;  // Payload size in bytes
+};
+
+/**
+ * @brief Fixed part of a LOG record payload (encoded arguments follow)
+ */
+struct LogRecord {
+  uint64_t timestamp_ns;  // system_clock time since epoch
+  uint16_t component;
+  uint16_t operation;
+  uint16_t format;
+  uint16_t flags;  // RECORD_* bits
+};
+
+/**
+ * @brief Fixed-size buffer of encoded format arguments
+ *
+ * Each argument is a one-byte ArgType followed by its raw value; strings carry
+ * a uint32 length. Strings are truncated and other arguments are dropped once
+ * the buffer is full; truncated() reports when that happened.
+ */
+class ArgBuffer {
+ public:
+  template <typename T>
+  void add(const T& value) {
+    if constexpr (std::is_same_v<T, bool>) {
+      put(ArgType::BOOL, static_cast<uint8_t>(value ? 1 : 0));
+    } else if constexpr (std::is_enum_v<T>) {
+      put(ArgType::INT64, static_cast<int64_t>(value));
+    } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+      put(ArgType::INT64, static_cast<int64_t>(value));
+    } else if constexpr (std::is_integral_v<T>) {
+      put(ArgType::UINT64, static_cast<uint64_t>(value));
+    } else if constexpr (std::is_floating_point_v<T>) {
+      put(ArgType::DOUBLE, static_cast<double>(value));
+    } else {
+      static_assert(std::is_convertible_v<const T&, std::string_view>, "unsupported binary log argument type");
+      add_string(std::string_view(value));
+    }
+  }
+
+  void add_string(std::string_view value);
+
+  const uint8_t* data() const { return data_.data(); }
+  size_t size() const { return size_; }
+  bool truncated() const { return truncated_; }
+
+ private:
+  template <typename V>
+  void put(ArgType type, V value) {
+    if (size_ + 1 + sizeof(V) > data_.size()) {
+      truncated_ = true;
+      return;
+    }
+    data_[size_++] = static_cast<uint8_t>(type);
+    std::memcpy(data_.data() + size_, &value, sizeof(V));
+    size_ += sizeof(V);
+  }
+
+  std::array<uint8_t, MAX_ARGS_SIZE> data_;
+  size_t size_ = 0;
+  bool truncated_ = false;
+};
+
+/**
+ * @brief Encode arguments in order
+ */
+template <typename... Args>
+void encode_args(ArgBuffer& buffer, const Args&... args) {
+  (buffer.add(args), ...);
+}
+
+/**
+ * @brief Render a format string, replacing each "{}" with the next encoded argument
+ */
+std::string render(std::string_view format, const uint8_t* args, size_t size);
+
+}  // namespace binary_log
+
+/**
+ * @brief Writer for memory-mapped, rotating binary log files
+ *
+ * Records are appended into a memory-mapped segment of fixed size. When a
+ * record does not fit, the segment is truncated to its used size, renamed to
+ * "{stem}.{index}{ext}" and a new segment is mapped in its place.
+ */
+class BinaryLogWriter {
+ public:
+  BinaryLogWriter() = default;
+  ~BinaryLogWriter();
+
+  // Non-copyable, non-movable
+  BinaryLogWriter(const BinaryLogWriter&) = delete;
+  BinaryLogWriter& operator=(const BinaryLogWriter&) = delete;
+  BinaryLogWriter(BinaryLogWriter&&) = delete;
+  BinaryLogWriter& operator=(BinaryLogWriter&&) = delete;
+
+  /**
+   * @brief Open a binary log file, rotating away any existing file at that path
+   * @return true if the first segment could be mapped
+   */
+  bool open(const std::string& filepath, const BinaryLogConfig& config = BinaryLogConfig{});
+
+  /**
+   * @brief Truncate and close the active segment
+   */
+  void close();
+
+  bool is_open() const;
+
+  /**
+   * @brief Append a log record
+   * @param truncated Mark the record as truncated (see ArgBuffer::truncated)
+   * @return false if the writer is closed or the record exceeds the segment size
+   */
+  bool write(uint8_t level, ComponentId component, OperationId operation, FormatId format, const uint8_t* args,
+             size_t args_size, bool truncated = false);
+
+  /**
+   * @brief Append a log record whose only argument is a plain message
+   *
+   * The message is copied straight into the segment, so its length is not
+   * bound by MAX_ARGS_SIZE. A message that cannot fit even an empty segment is
+   * cut to fit and the record is marked RECORD_TRUNCATED.
+   * @return false if the writer is closed
+   */
+  bool write_message(uint8_t level, ComponentId component, OperationId operation, FormatId format,
+                     std::string_view message);
+
+  /**
+   * @brief Schedule write-back of the mapped pages
+   */
+  void flush();
+
+  uint64_t records_written() const { return records_written_.load(); }
+  uint64_t records_dropped() const { return records_dropped_.load(); }
+
+ private:
+  bool open_segment();
+  void close_segment();
+  void rotate();
+  std::string segment_path(size_t index) const;
+  void load_segment_index();
+
+  bool write_locked(uint8_t level, ComponentId component, OperationId operation, FormatId format, uint16_t flags,
+                    const uint8_t* args, size_t args_size, std::string_view tail);
+  size_t definition_size(binary_log::RecordType type, uint16_t id) const;
+  void define(binary_log::RecordType type, uint16_t id);
+  void append(const void* data, size_t size);
+  static const std::string& name_of(binary_log::RecordType type, uint16_t id);
+
+  mutable std::mutex mutex_;
+  std::string filepath_;
+  BinaryLogConfig config_;
+  std::deque<std::string> segments_;  // Rotated segments, oldest first
+  size_t next_index_ = 1;
+
+  uint8_t* map_ = nullptr;
+  size_t capacity_ = 0;
+  size_t offset_ = 0;
+#if defined(_WIN32)
+  std::vector<uint8_t> buffer_;
+  std::unique_ptr<std::ofstream> file_;
+  size_t flushed_ = 0;
+#else
+  int fd_ = -1;
+#endif
+
+  // Names already defined in the active segment, indexed by RecordType
+  std::array<std::vector<bool>, 4> defined_;
+
+  std::atomic<uint64_t> records_written_{0};
+  std::atomic<uint64_t> records_dropped_{0};
+};
+
+/**
+ * @brief A decoded LOG record
+ */
+struct DecodedRecord {
+  uint64_t timestamp_ns = 0;
+  uint8_t level = 0;
+  std::string component;
+  std::string operation;
+  std::string message;
+  bool truncated = false;  // The writer cut the arguments short
+};
+
+/**
+ * @brief Offline decoder for binary log segments
+ */
+class BinaryLogReader {
+ public:
+  using RecordHandler = std::function<void(const DecodedRecord& record)>;
+
+  /**
+   * @brief Decode every LOG record of a segment in file order
+   * @param error Receives a description when decoding fails
+   * @return false if the file cannot be read or is not a binary log
+   */
+  static bool decode_file(const std::string& filepath, const RecordHandler& handler, std::string* error = nullptr);
+};
+
+}  // namespace common
+}  // namespace unilink
@@ -0,0 +1,216 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "unilink/common/channel_metrics.hpp"
+
+#include <chrono>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define UNILINK_HAS_TSC 1
+#endif
+
+namespace unilink {
+namespace common {
+
+namespace {
+
+unsigned highest_bit(uint64_t value) {
+#if defined(_MSC_VER)
+  unsigned long index;
+  _BitScanReverse64(&index, value);
+  return static_cast<unsigned>(index);
+#else
+  return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#endif
+}
+
+void update_max(PaddedCounter& max, uint64_t value) {
+  uint64_t current = max.value.load(std::memory_order_relaxed);
+  while (value > current && !max.value.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace
+
+#ifdef UNILINK_HAS_TSC
+uint64_t FastClock::now() { return __rdtsc(); }
+
+namespace {
+
+double measure_ns_per_tick() {
+  using std::chrono::steady_clock;
+  auto start = steady_clock::now();
+  uint64_t ticks_start = __rdtsc();
+  while (steady_clock::now() - start < std::chrono::milliseconds(2)) {
+  }
+  uint64_t ticks = __rdtsc() - ticks_start;
+  auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(steady_clock::now() - start).count();
+  return ticks ? static_cast<double>(ns) / static_cast<double>(ticks) : 1.0;
+}
+
+double ns_per_tick() {
+  static const double ratio = measure_ns_per_tick();
+  return ratio;
+}
+
+}  // namespace
+
+uint64_t FastClock::to_ns(uint64_t ticks) { return static_cast<uint64_t>(static_cast<double>(ticks) * ns_per_tick()); }
+void FastClock::calibrate() { ns_per_tick(); }
+#else
+uint64_t FastClock::now() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+uint64_t FastClock::to_ns(uint64_t ticks) { return ticks; }
+void FastClock::calibrate() {}
+#endif
+
+uint64_t HistogramSnapshot::percentile(double p) const {
+  if (count == 0 || buckets.empty()) return 0;
+  if (p <= 0.0) p = 0.0;
+  if (p >= 100.0) return max;
+
+  // Rank of the requested sample, 1-based
+  auto rank = static_cast<uint64_t>(p / 100.0 * static_cast<double>(count)) + 1;
+  uint64_t seen = 0;
+  for (size_t i = 0; i < buckets.size(); ++i) {
+    seen += buckets[i];
+    if (seen >= rank) {
+      uint64_t bound = LatencyHistogram::bucket_upper_bound(i);
+      return bound < max ? bound : max;
+    }
+  }
+  return max;
+}
+
+size_t LatencyHistogram::bucket_index(uint64_t value) {
+  if (value < kSubBuckets) return static_cast<size_t>(value);
+  unsigned exponent = highest_bit(value);
+  unsigned shift = exponent - kSubBucketBits;
+  // (value >> shift) is in [kSubBuckets, 2 * kSubBuckets); each exponent adds one row of sub-buckets
+  return static_cast<size_t>(shift) * kSubBuckets + static_cast<size_t>(value >> shift);
+}
+
+uint64_t LatencyHistogram::bucket_upper_bound(size_t index) {
+  if (index < kSubBuckets) return index;
+  size_t shift = index / kSubBuckets - 1;
+  uint64_t sub = kSubBuckets + index % kSubBuckets;
+  return ((sub + 1) << shift) - 1;  // Wraps to UINT64_MAX for the top bucket
+}
+
+void LatencyHistogram::record(uint64_t value) {
+  buckets_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+  sum_.add(value);
+  update_max(max_, value);
+}
+
+HistogramSnapshot LatencyHistogram::snapshot() const {
+  HistogramSnapshot snap;
+  snap.buckets.resize(kBucketCount);
+  uint64_t total = 0;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    snap.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+    total += snap.buckets[i];
+  }
+  snap.count = total;
+  snap.sum = sum_.load();
+  snap.max = max_.load();
+  return snap;
+}
+
+void LatencyHistogram::reset() {
+  for (auto& bucket : buckets_) bucket.store(0, std::memory_order_relaxed);
+  sum_.reset();
+  max_.reset();
+}
+
+#ifdef UNILINK_ENABLE_METRICS
+void ChannelMetrics::record_enqueue(size_t bytes) {
+  queue_bytes_.add(bytes);
+  update_max(queue_high_watermark_, queue_bytes_.load());
+}
+#endif
+
+ChannelMetricsSnapshot ChannelMetrics::snapshot() const {
+  ChannelMetricsSnapshot snap;
+  snap.bytes_in = bytes_in_.load();
+  snap.bytes_out = bytes_out_.load();
+  snap.messages_in = messages_in_.load();
+  snap.messages_out = messages_out_.load();
+  snap.queue_bytes = queue_bytes_.load();
+  snap.queue_high_watermark = queue_high_watermark_.load();
+  snap.backpressure_events = backpressure_events_.load();
+  snap.connects = connects_.load();
+  snap.disconnects = disconnects_.load();
+  snap.reconnect_attempts = reconnect_attempts_.load();
+  snap.accepted = accepted_.load();
+  snap.rejected = rejected_.load();
+  snap.write_latency_ns = write_latency_.snapshot();
+  snap.queue_latency_ns = queue_latency_.snapshot();
+  return snap;
+}
+
+void ChannelMetrics::reset() {
+  for (auto* counter : {&bytes_in_, &bytes_out_, &messages_in_, &messages_out_, &queue_high_watermark_,
+                        &backpressure_events_, &connects_, &disconnects_, &reconnect_attempts_, &accepted_,
+                        &rejected_}) {
+    counter->reset();
+  }
+  write_latency_.reset();  // queue_bytes_ is a live gauge and keeps its value
+  queue_latency_.reset();
+}
+
+void TxLatencyTracker::set_enabled(bool enabled, size_t queued) {
+  enabled = enabled && ChannelMetrics::enabled;  // Stamps would have nowhere to go
+  if (enabled == this->enabled()) return;
+  if (enabled) {
+    FastClock::calibrate();
+    stamps_.emplace();
+    untracked_ = queued;
+  } else {
+    stamps_.reset();
+    untracked_ = 0;
+  }
+}
+
+void TxLatencyTracker::clear() {
+  if (stamps_) stamps_->clear();
+  untracked_ = 0;
+}
+
+void TxLatencyTracker::complete(ChannelMetrics& metrics) {
+  if (untracked_ > 0) {
+    --untracked_;
+    return;
+  }
+  if (stamps_->empty()) return;
+  uint64_t now = FastClock::now();
+  uint64_t enqueued = stamps_->front();
+  stamps_->pop_front();
+  metrics.record_queue_latency(now > enqueued ? FastClock::to_ns(now - enqueued) : 0);
+}
+
+}  // namespace common
+}  // namespace unilink
@@ -0,0 +1,235 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <vector>
+
+#include "unilink/common/platform.hpp"
+
+namespace unilink {
+namespace common {
+
+/**
+ * @brief Relaxed atomic counter that owns a full cache line
+ *
+ * Counters updated on the io thread and read by monitoring threads never
+ * share a line, so a snapshot does not slow down the writer.
+ */
+struct alignas(64) PaddedCounter {
+  std::atomic<uint64_t> value{0};
+
+  void add(uint64_t n = 1) { value.fetch_add(n, std::memory_order_relaxed); }
+  void sub(uint64_t n) { value.fetch_sub(n, std::memory_order_relaxed); }
+  uint64_t load() const { return value.load(std::memory_order_relaxed); }
+  void reset() { value.store(0, std::memory_order_relaxed); }
+};
+
+/**
+ * @brief Point-in-time copy of a LatencyHistogram
+ */
+struct HistogramSnapshot {
+  uint64_t count = 0;
+  uint64_t sum = 0;
+  uint64_t max = 0;
+  std::vector<uint64_t> buckets;  // Indexed like LatencyHistogram buckets
+
+  double mean() const { return count ? static_cast<double>(sum) / static_cast<double>(count) : 0.0; }
+
+  /**
+   * @brief Value at the given percentile (0-100)
+   *
+   * Returns the upper bound of the bucket holding that rank, so the result
+   * overstates the true value by at most one bucket width (12.5%).
+   */
+  uint64_t percentile(double p) const;
+};
+
+/**
+ * @brief Lock-free log-linear histogram in the style of HdrHistogram
+ *
+ * Each power of two is split into 8 linear sub-buckets, bounding the
+ * relative error to 12.5% over the full 64-bit range with 496 buckets.
+ * record() is two relaxed adds plus a max update that only writes when
+ * the maximum grows; the count is derived from the buckets.
+ */
+class LatencyHistogram {
+ public:
+  static constexpr unsigned kSubBucketBits = 3;
+  static constexpr size_t kSubBuckets = size_t{1} << kSubBucketBits;
+  static constexpr size_t kBucketCount = kSubBuckets * (64 - kSubBucketBits + 1);
+
+  void record(uint64_t value);
+  HistogramSnapshot snapshot() const;
+  void reset();
+
+  static size_t bucket_index(uint64_t value);
+  static uint64_t bucket_upper_bound(size_t index);
+
+ private:
+  std::array<std::atomic<uint64_t>, kBucketCount> buckets_{};
+  PaddedCounter sum_;
+  PaddedCounter max_;
+};
+
+/**
+ * @brief Cheap monotonic timestamps for per-message tracking
+ *
+ * Reads the invariant TSC on x86-64 and falls back to steady_clock
+ * elsewhere. Ticks are converted to nanoseconds with a ratio calibrated
+ * once against steady_clock; call calibrate() off the hot path first.
+ */
+struct FastClock {
+  static uint64_t now();
+  static uint64_t to_ns(uint64_t ticks);
+  static void calibrate();
+};
+
+/**
+ * @brief Copy of a channel's metrics at one point in time
+ *
+ * For a TcpServer the data-plane figures are totals over all its sessions.
+ */
+struct ChannelMetricsSnapshot {
+  uint64_t bytes_in = 0;
+  uint64_t bytes_out = 0;
+  uint64_t messages_in = 0;   // Completed reads
+  uint64_t messages_out = 0;  // Completed writes, one per async_write_copy()
+  uint64_t queue_bytes = 0;   // Bytes queued but not yet written
+  uint64_t queue_high_watermark = 0;
+  uint64_t backpressure_events = 0;
+  uint64_t connects = 0;
+  uint64_t disconnects = 0;
+  uint64_t reconnect_attempts = 0;
+  uint64_t accepted = 0;  // TcpServer only
+  uint64_t rejected = 0;  // TcpServer only, refused by the client limit
+  HistogramSnapshot write_latency_ns;  // From the start of a write to its completion
+  HistogramSnapshot queue_latency_ns;  // From enqueue to write completion, when TX tracking is on
+};
+
+/**
+ * @brief Data-plane counters and write latency of one channel
+ *
+ * The record_* calls are made by the transport on its io thread; snapshot()
+ * may be called from any thread. Building with UNILINK_ENABLE_METRICS off
+ * turns every record_* call into a no-op.
+ */
+class ChannelMetrics {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+#ifdef UNILINK_ENABLE_METRICS
+  static constexpr bool enabled = true;
+
+  void record_read(size_t bytes) {
+    bytes_in_.add(bytes);
+    messages_in_.add();
+  }
+  void record_enqueue(size_t bytes);
+  void record_dequeue(size_t bytes) { queue_bytes_.sub(bytes); }
+  void record_write(size_t bytes, Clock::time_point started) {
+    bytes_out_.add(bytes);
+    messages_out_.add();
+    write_latency_.record(static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - started).count()));
+  }
+  void record_backpressure() { backpressure_events_.add(); }
+  void record_connect() { connects_.add(); }
+  void record_disconnect() { disconnects_.add(); }
+  void record_reconnect_attempt() { reconnect_attempts_.add(); }
+  void record_accept() { accepted_.add(); }
+  void record_reject() { rejected_.add(); }
+  void record_queue_latency(uint64_t ns) { queue_latency_.record(ns); }
+  static Clock::time_point now() { return Clock::now(); }
+#else
+  static constexpr bool enabled = false;
+
+  void record_read(size_t) {}
+  void record_enqueue(size_t) {}
+  void record_dequeue(size_t) {}
+  void record_write(size_t, Clock::time_point) {}
+  void record_backpressure() {}
+  void record_connect() {}
+  void record_disconnect() {}
+  void record_reconnect_attempt() {}
+  void record_accept() {}
+  void record_reject() {}
+  void record_queue_latency(uint64_t) {}
+  static Clock::time_point now() { return {}; }
+#endif
+
+  ChannelMetricsSnapshot snapshot() const;
+  void reset();
+
+ private:
+  PaddedCounter bytes_in_;
+  PaddedCounter bytes_out_;
+  PaddedCounter messages_in_;
+  PaddedCounter messages_out_;
+  PaddedCounter queue_bytes_;
+  PaddedCounter queue_high_watermark_;
+  PaddedCounter backpressure_events_;
+  PaddedCounter connects_;
+  PaddedCounter disconnects_;
+  PaddedCounter reconnect_attempts_;
+  PaddedCounter accepted_;
+  PaddedCounter rejected_;
+  LatencyHistogram write_latency_;
+  LatencyHistogram queue_latency_;
+};
+
+/**
+ * @brief Enqueue timestamps for the entries of a TX queue
+ *
+ * Stamps are kept in queue order next to the transport's own queue, so the
+ * buffer types do not change. While disabled, every call is a single
+ * branch and no storage is allocated. Entries already queued when tracking
+ * is switched on carry no stamp and are skipped. All calls must come from
+ * the transport's io thread. Without UNILINK_ENABLE_METRICS tracking stays off.
+ */
+class TxLatencyTracker {
+ public:
+  // queued: entries already in the transport's queue
+  void set_enabled(bool enabled, size_t queued);
+  bool enabled() const { return stamps_.has_value(); }
+
+  void on_enqueue() {
+    if (stamps_) stamps_->push_back(FastClock::now());
+  }
+  // Call when the front entry has been written
+  void on_complete(ChannelMetrics& metrics) {
+    if (stamps_) complete(metrics);
+  }
+  // Call when the transport drops its queue
+  void clear();
+
+ private:
+  void complete(ChannelMetrics& metrics);
+
+  std::optional<std::deque<uint64_t>> stamps_;
+  size_t untracked_ = 0;
+};
+
+}  // namespace common
+}  // namespace unilink
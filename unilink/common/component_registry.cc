@@ -0,0 +1,104 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "unilink/common/component_registry.hpp"
+
+namespace unilink {
+namespace common {
+
+namespace {
+const std::string& unknown_name() {
+  static const std::string name = "unknown";
+  return name;
+}
+}  // namespace
+
+ComponentRegistry& ComponentRegistry::instance() {
+  static ComponentRegistry instance;
+  return instance;
+}
+
+ComponentRegistry::ComponentRegistry() {
+  // Order must match the constants in namespace component
+  register_component("tcp_server");
+  register_component("tcp_server_session");
+  register_component("tcp_client");
+  register_component("serial");
+  register_component("tcp_server_builder");
+  register_component("config_manager");
+  register_component("error_handler");
+  register_component("io_context_manager");
+  register_component("memory_tracker");
+}
+
+ComponentId ComponentRegistry::register_component(std::string_view name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // The last slot is reserved for OVERFLOW_COMPONENT
+  ComponentId id = intern(components_, name, MAX_COMPONENTS - 1, OVERFLOW_COMPONENT);
+  component_count_.store(components_.names.size(), std::memory_order_release);
+  return id;
+}
+
+ComponentId ComponentRegistry::find_component(std::string_view name) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = components_.ids.find(name);
+  return it != components_.ids.end() ? it->second : INVALID_COMPONENT;
+}
+
+const std::string& ComponentRegistry::component_name(ComponentId id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return id < components_.names.size() ? components_.names[id] : unknown_name();
+}
+
+OperationId ComponentRegistry::register_operation(std::string_view name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return intern(operations_, name, MAX_OPERATIONS, OVERFLOW_OPERATION);
+}
+
+const std::string& ComponentRegistry::operation_name(OperationId id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return id < operations_.names.size() ? operations_.names[id] : unknown_name();
+}
+
+FormatId ComponentRegistry::register_format(std::string_view format) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return intern(formats_, format, MAX_FORMATS, OVERFLOW_FORMAT);
+}
+
+const std::string& ComponentRegistry::format_string(FormatId id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return id < formats_.names.size() ? formats_.names[id] : unknown_name();
+}
+
+uint16_t ComponentRegistry::intern(NameTable& table, std::string_view name, size_t capacity, uint16_t overflow_id) {
+  auto it = table.ids.find(name);
+  if (it != table.ids.end()) {
+    return it->second;
+  }
+
+  if (table.names.size() >= capacity) {
+    return overflow_id;
+  }
+
+  auto id = static_cast<uint16_t>(table.names.size());
+  table.names.emplace_back(name);
+  // Key views into the deque-owned string, which never moves
+  table.ids.emplace(std::string_view(table.names.back()), id);
+  return id;
+}
+
+}  // namespace common
+}  // namespace unilink
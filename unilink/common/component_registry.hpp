@@ -0,0 +1,188 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+namespace unilink {
+namespace common {
+
+using ComponentId = uint16_t;
+using OperationId = uint16_t;
+using FormatId = uint16_t;
+
+/**
+ * @brief Built-in component tags
+ *
+ * These IDs are registered first by ComponentRegistry, so they are stable
+ * compile-time constants that can be used without any string lookup.
+ */
+namespace component {
+constexpr ComponentId TCP_SERVER = 0;
+constexpr ComponentId TCP_SERVER_SESSION = 1;
+constexpr ComponentId TCP_CLIENT = 2;
+constexpr ComponentId SERIAL = 3;
+constexpr ComponentId TCP_SERVER_BUILDER = 4;
+constexpr ComponentId CONFIG_MANAGER = 5;
+constexpr ComponentId ERROR_HANDLER = 6;
+constexpr ComponentId IO_CONTEXT_MANAGER = 7;
+constexpr ComponentId MEMORY_TRACKER = 8;
+}  // namespace component
+
+/**
+ * @brief Registry of interned component, operation and format names
+ *
+ * Shared by Logger and ErrorHandler so that hot paths can carry small
+ * integer IDs instead of std::string names. IDs are never reused and
+ * names are never removed, so references returned by the name accessors
+ * stay valid for the lifetime of the process.
+ */
+class ComponentRegistry {
+ public:
+  static constexpr size_t MAX_COMPONENTS = 256;
+  static constexpr size_t MAX_OPERATIONS = 65535;
+  static constexpr size_t MAX_FORMATS = 65535;
+
+  // Returned when a name is unknown, or shared by all names once the table is full
+  static constexpr ComponentId OVERFLOW_COMPONENT = static_cast<ComponentId>(MAX_COMPONENTS - 1);
+  static constexpr OperationId OVERFLOW_OPERATION = static_cast<OperationId>(MAX_OPERATIONS);
+  static constexpr FormatId OVERFLOW_FORMAT = static_cast<FormatId>(MAX_FORMATS);
+  static constexpr ComponentId INVALID_COMPONENT = 0xFFFF;
+
+  /**
+   * @brief Get singleton instance
+   */
+  static ComponentRegistry& instance();
+
+  /**
+   * @brief Intern a component name
+   * @param name Component name (e.g., "tcp_server")
+   * @return Stable ID for the name; OVERFLOW_COMPONENT when the table is full
+   */
+  ComponentId register_component(std::string_view name);
+
+  /**
+   * @brief Look up a component without registering it
+   * @return ID of the component, INVALID_COMPONENT if it was never registered
+   */
+  ComponentId find_component(std::string_view name) const;
+
+  /**
+   * @brief Get the name of a registered component
+   */
+  const std::string& component_name(ComponentId id) const;
+
+  /**
+   * @brief Intern an operation name
+   * @param name Operation name (e.g., "accept")
+   * @return Stable ID for the name; OVERFLOW_OPERATION when the table is full
+   */
+  OperationId register_operation(std::string_view name);
+
+  /**
+   * @brief Get the name of a registered operation
+   */
+  const std::string& operation_name(OperationId id) const;
+
+  /**
+   * @brief Intern a log format string (e.g., "sent {} bytes to {}")
+   * @return Stable ID for the format; OVERFLOW_FORMAT when the table is full
+   */
+  FormatId register_format(std::string_view format);
+
+  /**
+   * @brief Get a registered format string
+   */
+  const std::string& format_string(FormatId id) const;
+
+  /**
+   * @brief Number of registered components (lock-free; only grows)
+   */
+  size_t component_count() const noexcept { return component_count_.load(std::memory_order_acquire); }
+
+ private:
+  ComponentRegistry();
+  ~ComponentRegistry() = default;
+
+  // Non-copyable, non-movable
+  ComponentRegistry(const ComponentRegistry&) = delete;
+  ComponentRegistry& operator=(const ComponentRegistry&) = delete;
+  ComponentRegistry(ComponentRegistry&&) = delete;
+  ComponentRegistry& operator=(ComponentRegistry&&) = delete;
+
+  struct NameTable {
+    std::deque<std::string> names;  // deque keeps references stable on growth
+    std::unordered_map<std::string_view, uint16_t> ids;
+  };
+
+  static uint16_t intern(NameTable& table, std::string_view name, size_t capacity, uint16_t overflow_id);
+
+  mutable std::mutex mutex_;
+  std::atomic<size_t> component_count_{0};
+  NameTable components_;
+  NameTable operations_;
+  NameTable formats_;
+};
+
+/**
+ * @brief Interned component/operation pair for a logging call site
+ *
+ * The logging macros create one static LogTag per call site when both names
+ * are string literals, so interning happens once and every later call only
+ * carries the IDs. The names are not copied and must outlive the tag.
+ */
+struct LogTag {
+  ComponentId component;
+  OperationId operation;
+  std::string_view component_name;
+  std::string_view operation_name;
+
+  LogTag(std::string_view comp, std::string_view op)
+      : component(ComponentRegistry::instance().register_component(comp)),
+        operation(ComponentRegistry::instance().register_operation(op)),
+        component_name(comp),
+        operation_name(op) {}
+};
+
+/**
+ * @brief True when decltype of a tag expression is a string literal
+ *
+ * A literal is an lvalue of const char[N]. Named arrays (such as a runtime
+ * char buffer) are not references under decltype and are rejected, so they
+ * never end up frozen in a per-call-site LogTag.
+ */
+template <typename T>
+constexpr bool is_log_tag_literal_v =
+    std::is_lvalue_reference_v<T> && std::is_array_v<std::remove_reference_t<T>> &&
+    std::is_same_v<std::remove_extent_t<std::remove_reference_t<T>>, const char>;
+
+/**
+ * @brief True when both tag expressions are string literals
+ */
+template <typename Component, typename Operation>
+constexpr bool is_static_log_tag_v = is_log_tag_literal_v<Component> && is_log_tag_literal_v<Operation>;
+
+}  // namespace common
+}  // namespace unilink
@@ -59,6 +59,11 @@ constexpr unsigned MIN_CLEANUP_INTERVAL_MS = 10;             // 10ms minimum cle
 constexpr unsigned MAX_CLEANUP_INTERVAL_MS = 1000;           // 1s maximum cleanup interval
 constexpr unsigned DEFAULT_HEALTH_CHECK_INTERVAL_MS = 1000;  // 1s health check interval
 
+// Configuration reload constants
+constexpr unsigned DEFAULT_CONFIG_RELOAD_DEBOUNCE_MS = 200;  // Quiet period after the last write before reloading
+constexpr unsigned CONFIG_WATCH_POLL_INTERVAL_MS = 100;      // Watcher wake-up granularity (stop flag, mtime fallback)
+constexpr unsigned CONFIG_RELOAD_MAX_DELAY_WINDOWS = 10;     // Reload anyway after this many windows of constant writes
+
 // Connection and session constants
 constexpr size_t DEFAULT_MAX_CONNECTIONS = 1000;      // Default maximum connections
 constexpr size_t MAX_MAX_CONNECTIONS = 10000;         // Maximum allowed connections
@@ -71,6 +76,12 @@ constexpr size_t DEFAULT_MAX_RECENT_ERRORS = 1000;           // Default max rece
 constexpr size_t MAX_MAX_RECENT_ERRORS = 10000;              // Maximum recent errors to track
 constexpr size_t DEFAULT_ERROR_CLEANUP_INTERVAL_MS = 60000;  // 1m error cleanup interval
 
+// Log rate limiting for call sites that repeat during an incident (retries, accept errors)
+constexpr double RETRY_LOG_RATE_PER_SECOND = 1.0;  // Retry messages per second after the burst
+constexpr uint32_t RETRY_LOG_BURST = 5;            // Retry messages allowed back to back
+constexpr double ERROR_LOG_RATE_PER_SECOND = 1.0;  // Error messages per second after the burst
+constexpr uint32_t ERROR_LOG_BURST = 10;           // Error messages allowed back to back
+
 // Validation constants
 constexpr size_t MAX_HOSTNAME_LENGTH = 253;     // Maximum hostname length (RFC 1123)
 constexpr size_t MAX_DEVICE_PATH_LENGTH = 256;  // Maximum device path length
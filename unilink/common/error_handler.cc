@@ -17,8 +17,10 @@
 #include "error_handler.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <optional>
 #include <sstream>
 
 #include "logger.hpp"
@@ -26,11 +28,41 @@
 namespace unilink {
 namespace common {
 
+namespace {
+
+int64_t to_ticks(std::chrono::system_clock::time_point time) { return time.time_since_epoch().count(); }
+
+std::chrono::system_clock::time_point from_ticks(int64_t ticks) {
+  return std::chrono::system_clock::time_point(std::chrono::system_clock::duration(ticks));
+}
+
+}  // namespace
+
 ErrorHandler& ErrorHandler::instance() {
   static ErrorHandler instance;
   return instance;
 }
 
+ErrorHandler::~ErrorHandler() {
+  stop_aggregation_worker();
+  // Drains still posted to an executor see the handler is gone; wait for any that are already running
+  {
+    std::unique_lock<std::mutex> guard(dispatch_lifetime_->mutex);
+    dispatch_lifetime_->alive = false;
+    dispatch_lifetime_->idle.wait(guard, [this] { return dispatch_lifetime_->running == 0; });
+  }
+  {
+    std::lock_guard<std::mutex> lock(dispatch_mutex_);
+    async_dispatch_.store(false);
+    dispatch_stopping_ = true;
+    dispatch_queue_.clear();
+  }
+  dispatch_cv_.notify_all();
+  if (dispatch_thread_.joinable() && dispatch_thread_.get_id() != std::this_thread::get_id()) {
+    dispatch_thread_.join();
+  }
+}
+
 void ErrorHandler::report_error(const ErrorInfo& error) {
   if (!enabled_.load()) {
     return;
@@ -40,23 +72,27 @@ void ErrorHandler::report_error(const ErrorInfo& error) {
     return;
   }
 
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    update_stats(error);
-    add_to_recent_errors(error);
-    add_to_component_errors(error);
-    notify_callbacks(error);
+  ErrorInfo interned = error;
+  if (interned.component_id == ComponentRegistry::INVALID_COMPONENT) {
+    interned.component_id = ComponentRegistry::instance().register_component(interned.component);
   }
+
+  if (aggregation_window_.load(std::memory_order_relaxed) > 0 && aggregate(interned)) {
+    return;
+  }
+  record(interned);
 }
 
 void ErrorHandler::register_callback(ErrorCallback callback) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  callbacks_.push_back(std::move(callback));
+  std::lock_guard<std::mutex> lock(callbacks_mutex_);
+  auto callbacks = std::make_shared<CallbackList>(*callbacks_);
+  callbacks->push_back(std::move(callback));
+  callbacks_ = std::move(callbacks);
 }
 
 void ErrorHandler::clear_callbacks() {
-  std::lock_guard<std::mutex> lock(mutex_);
-  callbacks_.clear();
+  std::lock_guard<std::mutex> lock(callbacks_mutex_);
+  callbacks_ = std::make_shared<const CallbackList>();
 }
 
 void ErrorHandler::set_min_error_level(ErrorLevel level) { min_level_.store(level); }
@@ -68,71 +104,484 @@ void ErrorHandler::set_enabled(bool enabled) { enabled_.store(enabled); }
 bool ErrorHandler::is_enabled() const { return enabled_.load(); }
 
 ErrorStats ErrorHandler::get_error_stats() const {
-  std::lock_guard<std::mutex> lock(stats_mutex_);
-  return stats_;
+  ErrorStats stats;
+  stats.total_errors = total_errors_.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < LEVEL_COUNT; ++i) {
+    stats.errors_by_level[i] = errors_by_level_[i].load(std::memory_order_relaxed);
+  }
+  for (size_t i = 0; i < CATEGORY_COUNT; ++i) {
+    stats.errors_by_category[i] = errors_by_category_[i].load(std::memory_order_relaxed);
+  }
+  stats.retryable_errors = retryable_errors_.load(std::memory_order_relaxed);
+  stats.coalesced_errors = coalesced_errors_.load(std::memory_order_relaxed);
+
+  int64_t first = first_error_.load(std::memory_order_relaxed);
+  if (first != 0) {
+    stats.first_error = from_ticks(first);
+    stats.last_error = from_ticks(last_error_.load(std::memory_order_relaxed));
+  }
+  return stats;
 }
 
 void ErrorHandler::reset_stats() {
-  std::lock_guard<std::mutex> lock(stats_mutex_);
-  stats_.reset();
+  total_errors_.store(0);
+  for (auto& count : errors_by_level_) {
+    count.store(0);
+  }
+  for (auto& count : errors_by_category_) {
+    count.store(0);
+  }
+  retryable_errors_.store(0);
+  first_error_.store(0);
+  last_error_.store(0);
+  coalesced_errors_.store(0);
+  dispatch_enqueued_.store(0);
+  dispatch_dispatched_.store(0);
+  dispatch_dropped_.store(0);
+  dispatch_max_depth_.store(0);
 }
 
 std::vector<ErrorInfo> ErrorHandler::get_errors_by_component(const std::string& component) const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  auto it = errors_by_component_.find(component);
-  if (it != errors_by_component_.end()) {
-    return it->second;
+  const auto* history = find_component_history(component);
+  if (!history) {
+    return {};
   }
-  return {};
+  std::lock_guard<std::mutex> lock(history->mutex);
+  return history->errors.latest(MAX_COMPONENT_ERRORS);
 }
 
 std::vector<ErrorInfo> ErrorHandler::get_recent_errors(size_t count) const {
-  std::lock_guard<std::mutex> lock(mutex_);
-
-  size_t start_index = 0;
-  if (recent_errors_.size() > count) {
-    start_index = recent_errors_.size() - count;
-  }
-
-  return std::vector<ErrorInfo>(recent_errors_.begin() + start_index, recent_errors_.end());
+  std::lock_guard<std::mutex> lock(recent_mutex_);
+  return recent_errors_.latest(count);
 }
 
 bool ErrorHandler::has_errors(const std::string& component) const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  auto it = errors_by_component_.find(component);
-  return it != errors_by_component_.end() && !it->second.empty();
+  const auto* history = find_component_history(component);
+  if (!history) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(history->mutex);
+  return !history->errors.empty();
 }
 
 size_t ErrorHandler::get_error_count(const std::string& component, ErrorLevel level) const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  auto it = errors_by_component_.find(component);
-  if (it == errors_by_component_.end()) {
+  const auto* history = find_component_history(component);
+  if (!history) {
     return 0;
   }
 
-  return std::count_if(it->second.begin(), it->second.end(),
-                       [level](const ErrorInfo& error) { return error.level == level; });
+  std::lock_guard<std::mutex> lock(history->mutex);
+  size_t count = 0;
+  history->errors.for_each([level, &count](const ErrorInfo& error) {
+    if (error.level == level) {
+      ++count;
+    }
+  });
+  return count;
+}
+
+void ErrorHandler::set_aggregation_window(std::chrono::milliseconds window) {
+  auto ticks = std::chrono::duration_cast<std::chrono::system_clock::duration>(window).count();
+  aggregation_window_.store(std::max<int64_t>(ticks, 0));
+  if (ticks <= 0) {
+    flush_aggregated_errors(true);
+    stop_aggregation_worker();
+    return;
+  }
+  std::lock_guard<std::mutex> lock(aggregation_mutex_);
+  if (!aggregation_thread_.joinable()) {
+    aggregation_stopping_ = false;
+    aggregation_thread_ = std::thread(&ErrorHandler::aggregation_worker, this);
+  }
+}
+
+std::chrono::milliseconds ErrorHandler::get_aggregation_window() const {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::system_clock::duration(aggregation_window_.load()));
+}
+
+bool ErrorHandler::try_coalesce(ErrorLevel level, ErrorCategory category, const std::string& component,
+                                const std::string& operation, const boost::system::error_code& ec) {
+  if (aggregation_window_.load(std::memory_order_relaxed) == 0 || !enabled_.load()) {
+    return false;
+  }
+
+  uint64_t key = aggregation_key(category, component, operation, ec);
+  int64_t now = to_ticks(std::chrono::system_clock::now());
+
+  std::lock_guard<std::mutex> lock(aggregation_mutex_);
+  auto it = aggregates_.find(key);
+  if (it == aggregates_.end() || now >= it->second.window_end ||
+      !same_error(it->second.first, level, category, component, operation, ec)) {
+    return false;
+  }
+  ++it->second.count;
+  it->second.last_ticks = now;
+  return true;
+}
+
+void ErrorHandler::flush_aggregated_errors(bool force) {
+  std::vector<ErrorAggregate> closed;
+  {
+    int64_t now = to_ticks(std::chrono::system_clock::now());
+    std::lock_guard<std::mutex> lock(aggregation_mutex_);
+    if (force) {
+      aggregation_deadlines_.clear();
+    }
+    for (auto it = aggregates_.begin(); it != aggregates_.end();) {
+      if (force || now >= it->second.window_end) {
+        closed.push_back(std::move(it->second));
+        it = aggregates_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  for (const auto& aggregate : closed) {
+    emit_aggregate(aggregate);
+  }
+}
+
+void ErrorHandler::enable_async_dispatch(const ErrorDispatchConfig& config) {
+  disable_async_dispatch();
+
+  std::lock_guard<std::mutex> lock(dispatch_mutex_);
+  dispatch_config_ = config;
+  dispatch_config_.max_queue_size = std::max<size_t>(dispatch_config_.max_queue_size, 1);
+  dispatch_stopping_ = false;
+  ++dispatch_generation_;
+  if (!dispatch_config_.executor) {
+    dispatch_thread_ = std::thread(&ErrorHandler::dispatch_worker, this, dispatch_generation_);
+  }
+  async_dispatch_.store(true, std::memory_order_release);
+}
+
+void ErrorHandler::disable_async_dispatch() {
+  std::deque<ErrorInfo> pending;
+  std::thread worker;
+  {
+    std::unique_lock<std::mutex> lock(dispatch_mutex_);
+    if (!async_dispatch_.load()) {
+      return;
+    }
+    // New errors are dispatched synchronously from here on
+    async_dispatch_.store(false);
+    dispatch_stopping_ = true;
+    dispatch_scheduled_ = false;  // A drain still posted to the executor finds the queue empty
+    worker = std::move(dispatch_thread_);
+
+    if (dispatch_delivering_thread_ == std::this_thread::get_id()) {
+      // Called from an error callback: the batch in flight is this one, so deliver the rest here
+      pending.swap(dispatch_queue_);
+    } else if (!worker.joinable()) {
+      // Executor mode: take the queue back instead of waiting on an executor that may never run again,
+      // after the batch that is already being delivered so the order is kept
+      dispatch_idle_cv_.wait(lock, [this] { return dispatch_in_flight_ == 0; });
+      pending.swap(dispatch_queue_);
+    }
+  }
+  dispatch_cv_.notify_all();
+
+  if (worker.joinable()) {
+    if (worker.get_id() == std::this_thread::get_id()) {
+      worker.detach();  // Exits once the current callback returns
+    } else {
+      worker.join();  // Delivers what is left in the queue first
+    }
+  }
+
+  for (const auto& error : pending) {
+    invoke_callbacks(error);
+  }
+  dispatch_dispatched_.fetch_add(pending.size(), std::memory_order_relaxed);
+}
+
+bool ErrorHandler::is_async_dispatch_enabled() const { return async_dispatch_.load(); }
+
+void ErrorHandler::wait_for_dispatch() {
+  std::unique_lock<std::mutex> lock(dispatch_mutex_);
+  dispatch_idle_cv_.wait(lock, [this] {
+    return dispatch_queue_.empty() && dispatch_in_flight_ == 0 && !dispatch_scheduled_;
+  });
+}
+
+ErrorDispatchStats ErrorHandler::get_dispatch_stats() const {
+  ErrorDispatchStats stats;
+  stats.enqueued = dispatch_enqueued_.load(std::memory_order_relaxed);
+  stats.dispatched = dispatch_dispatched_.load(std::memory_order_relaxed);
+  stats.dropped = dispatch_dropped_.load(std::memory_order_relaxed);
+  stats.max_queue_size_reached = dispatch_max_depth_.load(std::memory_order_relaxed);
+  std::lock_guard<std::mutex> lock(dispatch_mutex_);
+  stats.queue_size = dispatch_queue_.size();
+  return stats;
+}
+
+bool ErrorHandler::enqueue_for_dispatch(const ErrorInfo& error) {
+  ErrorDispatchConfig::Executor executor;
+  uint64_t generation = 0;
+  {
+    std::lock_guard<std::mutex> lock(dispatch_mutex_);
+    if (!async_dispatch_.load(std::memory_order_relaxed)) {
+      return false;  // Disabled concurrently; caller dispatches synchronously
+    }
+
+    if (dispatch_queue_.size() >= dispatch_config_.max_queue_size) {
+      dispatch_dropped_.fetch_add(1, std::memory_order_relaxed);
+      if (dispatch_config_.drop_policy == ErrorDropPolicy::DROP_NEWEST) {
+        return true;
+      }
+      dispatch_queue_.pop_front();
+    }
+    dispatch_queue_.push_back(error);
+    dispatch_enqueued_.fetch_add(1, std::memory_order_relaxed);
+    if (dispatch_queue_.size() > dispatch_max_depth_.load(std::memory_order_relaxed)) {
+      dispatch_max_depth_.store(dispatch_queue_.size(), std::memory_order_relaxed);
+    }
+
+    if (dispatch_config_.executor && !dispatch_scheduled_) {
+      dispatch_scheduled_ = true;
+      executor = dispatch_config_.executor;
+      generation = dispatch_generation_;
+    }
+  }
+
+  if (executor) {
+    executor([this, lifetime = dispatch_lifetime_, generation] {
+      {
+        std::lock_guard<std::mutex> guard(lifetime->mutex);
+        if (!lifetime->alive) {
+          return;
+        }
+        ++lifetime->running;
+      }
+      drain_dispatch_queue(generation);
+      std::lock_guard<std::mutex> guard(lifetime->mutex);
+      if (--lifetime->running == 0) {
+        lifetime->idle.notify_all();
+      }
+    });
+  } else {
+    dispatch_cv_.notify_one();
+  }
+  return true;
 }
 
-void ErrorHandler::update_stats(const ErrorInfo& error) {
-  std::lock_guard<std::mutex> lock(stats_mutex_);
+void ErrorHandler::dispatch_worker(uint64_t generation) {
+  std::deque<ErrorInfo> batch;
+  std::unique_lock<std::mutex> lock(dispatch_mutex_);
+  while (true) {
+    dispatch_cv_.wait(lock, [this, generation] {
+      return dispatch_stopping_ || !dispatch_queue_.empty() || dispatch_generation_ != generation;
+    });
+    if (dispatch_generation_ != generation || dispatch_queue_.empty()) {
+      break;  // Replaced by a newer dispatcher, or stopping and drained
+    }
 
-  stats_.total_errors++;
-  stats_.errors_by_level[static_cast<int>(error.level)]++;
-  stats_.errors_by_category[static_cast<int>(error.category)]++;
+    batch.swap(dispatch_queue_);
+    dispatch_in_flight_ += batch.size();
+    dispatch_delivering_thread_ = std::this_thread::get_id();
+    lock.unlock();
+    for (const auto& error : batch) {
+      invoke_callbacks(error);
+    }
+    dispatch_dispatched_.fetch_add(batch.size(), std::memory_order_relaxed);
+    lock.lock();
+    dispatch_in_flight_ -= batch.size();
+    dispatch_delivering_thread_ = std::thread::id();
+    batch.clear();
+    dispatch_idle_cv_.notify_all();
+  }
+  dispatch_idle_cv_.notify_all();
+}
+
+void ErrorHandler::drain_dispatch_queue(uint64_t generation) {
+  std::deque<ErrorInfo> batch;
+  std::unique_lock<std::mutex> lock(dispatch_mutex_);
+  while (dispatch_generation_ == generation && !dispatch_queue_.empty()) {
+    batch.swap(dispatch_queue_);
+    dispatch_in_flight_ += batch.size();
+    dispatch_delivering_thread_ = std::this_thread::get_id();
+    lock.unlock();
+    for (const auto& error : batch) {
+      invoke_callbacks(error);
+    }
+    dispatch_dispatched_.fetch_add(batch.size(), std::memory_order_relaxed);
+    lock.lock();
+    dispatch_in_flight_ -= batch.size();
+    dispatch_delivering_thread_ = std::thread::id();
+    batch.clear();
+    dispatch_idle_cv_.notify_all();
+  }
+  if (dispatch_generation_ == generation) {
+    dispatch_scheduled_ = false;  // A drain posted before the dispatcher was reconfigured leaves the new one alone
+  }
+  dispatch_idle_cv_.notify_all();
+}
+
+uint64_t ErrorHandler::aggregation_key(ErrorCategory category, const std::string& component,
+                                       const std::string& operation, const boost::system::error_code& ec) {
+  // boost::hash_combine style mixing; collisions are caught by same_error()
+  uint64_t key = std::hash<std::string>{}(component);
+  auto mix = [&key](uint64_t value) { key ^= value + 0x9e3779b97f4a7c15ULL + (key << 6) + (key >> 2); };
+  mix(std::hash<std::string>{}(operation));
+  mix(static_cast<uint64_t>(category));
+  mix(static_cast<uint64_t>(static_cast<uint32_t>(ec.value())));
+  mix(reinterpret_cast<uintptr_t>(&ec.category()));
+  return key;
+}
+
+bool ErrorHandler::same_error(const ErrorInfo& error, ErrorLevel level, ErrorCategory category,
+                              const std::string& component, const std::string& operation,
+                              const boost::system::error_code& ec) {
+  return error.level == level && error.category == category && error.boost_error == ec &&
+         error.component == component && error.operation == operation;
+}
+
+bool ErrorHandler::aggregate(const ErrorInfo& error) {
+  uint64_t key = aggregation_key(error.category, error.component, error.operation, error.boost_error);
+  int64_t now = to_ticks(error.timestamp);
+  int64_t window = aggregation_window_.load(std::memory_order_relaxed);
+
+  bool absorbed = false;
+  std::optional<ErrorAggregate> closed;
+  {
+    std::lock_guard<std::mutex> lock(aggregation_mutex_);
+    // Other keys are closed by aggregation_worker(); only this one is checked here
+    auto it = aggregates_.find(key);
+    if (it != aggregates_.end() && now >= it->second.window_end) {
+      closed = std::move(it->second);
+      aggregates_.erase(it);
+      it = aggregates_.end();
+    }
+
+    if (it == aggregates_.end()) {
+      aggregates_.emplace(key, ErrorAggregate{error, 1, now, now + window});
+      aggregation_deadlines_.emplace_back(now + window, key);
+      if (aggregation_deadlines_.size() == 1) {
+        aggregation_cv_.notify_one();
+      }
+    } else if (same_error(it->second.first, error.level, error.category, error.component, error.operation,
+                          error.boost_error)) {
+      ++it->second.count;
+      it->second.last_ticks = now;
+      absorbed = true;
+    }
+    // A hash collision with a different error is simply reported without aggregation
+  }
+
+  if (closed) {
+    emit_aggregate(*closed);
+  }
+  return absorbed;
+}
+
+void ErrorHandler::aggregation_worker() {
+  std::unique_lock<std::mutex> lock(aggregation_mutex_);
+  while (!aggregation_stopping_) {
+    if (aggregation_deadlines_.empty()) {
+      aggregation_cv_.wait(lock);
+      continue;
+    }
+    int64_t deadline = aggregation_deadlines_.front().first;
+    int64_t now = to_ticks(std::chrono::system_clock::now());
+    if (now < deadline) {
+      aggregation_cv_.wait_until(lock, from_ticks(deadline));
+      continue;
+    }
+
+    std::vector<ErrorAggregate> closed;
+    while (!aggregation_deadlines_.empty() && aggregation_deadlines_.front().first <= now) {
+      auto [window_end, key] = aggregation_deadlines_.front();
+      aggregation_deadlines_.pop_front();
+      // Skip entries whose window was already closed by a report or a flush
+      auto it = aggregates_.find(key);
+      if (it != aggregates_.end() && it->second.window_end == window_end) {
+        closed.push_back(std::move(it->second));
+        aggregates_.erase(it);
+      }
+    }
+
+    lock.unlock();
+    for (const auto& aggregate : closed) {
+      emit_aggregate(aggregate);
+    }
+    lock.lock();
+  }
+}
+
+void ErrorHandler::stop_aggregation_worker() {
+  std::thread worker;
+  {
+    std::lock_guard<std::mutex> lock(aggregation_mutex_);
+    aggregation_stopping_ = true;
+    worker = std::move(aggregation_thread_);
+  }
+  aggregation_cv_.notify_all();
+  if (worker.get_id() == std::this_thread::get_id()) {
+    worker.detach();  // Disabled from a callback running on the worker; it exits after the callback returns
+  } else if (worker.joinable()) {
+    worker.join();
+  }
+}
+
+void ErrorHandler::emit_aggregate(const ErrorAggregate& aggregate) {
+  if (aggregate.count <= 1) {
+    return;  // Only the first occurrence, which was already delivered
+  }
+
+  ErrorInfo summary = aggregate.first;
+  summary.occurrences = aggregate.count;
+  summary.last_occurrence = from_ticks(aggregate.last_ticks);
+
+  // The first occurrence is already counted; the record adds the repeats
+  update_stats(summary, aggregate.count - 1);
+  coalesced_errors_.fetch_add(aggregate.count - 1, std::memory_order_relaxed);
+  add_to_recent_errors(summary);
+  add_to_component_errors(summary);
+  notify_callbacks(summary);
+}
+
+void ErrorHandler::record(const ErrorInfo& error) {
+  update_stats(error, 1);
+  add_to_recent_errors(error);
+  add_to_component_errors(error);
+  notify_callbacks(error);
+}
+
+void ErrorHandler::update_stats(const ErrorInfo& error, size_t count) {
+  total_errors_.fetch_add(count, std::memory_order_relaxed);
+  errors_by_level_[static_cast<size_t>(error.level) % LEVEL_COUNT].fetch_add(count, std::memory_order_relaxed);
+  errors_by_category_[static_cast<size_t>(error.category) % CATEGORY_COUNT].fetch_add(count,
+                                                                                     std::memory_order_relaxed);
 
   if (error.retryable) {
-    stats_.retryable_errors++;
+    retryable_errors_.fetch_add(count, std::memory_order_relaxed);
   }
 
-  if (stats_.first_error == std::chrono::system_clock::time_point{}) {
-    stats_.first_error = error.timestamp;
+  int64_t unset = 0;
+  first_error_.compare_exchange_strong(unset, to_ticks(error.timestamp), std::memory_order_relaxed);
+  int64_t timestamp = to_ticks(error.last_occurrence);
+  int64_t last = last_error_.load(std::memory_order_relaxed);
+  while (last < timestamp && !last_error_.compare_exchange_weak(last, timestamp, std::memory_order_relaxed)) {
   }
-  stats_.last_error = error.timestamp;
 }
 
 void ErrorHandler::notify_callbacks(const ErrorInfo& error) {
-  for (const auto& callback : callbacks_) {
+  if (async_dispatch_.load(std::memory_order_acquire) && enqueue_for_dispatch(error)) {
+    return;
+  }
+  invoke_callbacks(error);
+}
+
+void ErrorHandler::invoke_callbacks(const ErrorInfo& error) {
+  std::shared_ptr<const CallbackList> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    callbacks = callbacks_;
+  }
+
+  for (const auto& callback : *callbacks) {
     try {
       callback(error);
     } catch (const std::exception& e) {
@@ -145,24 +594,29 @@ void ErrorHandler::notify_callbacks(const ErrorInfo& error) {
 }
 
 void ErrorHandler::add_to_recent_errors(const ErrorInfo& error) {
-  recent_errors_.push_back(error);
-
-  // Keep only the most recent errors
-  if (recent_errors_.size() > MAX_RECENT_ERRORS) {
-    recent_errors_.erase(recent_errors_.begin(), recent_errors_.begin() + (recent_errors_.size() - MAX_RECENT_ERRORS));
+  ErrorInfo entry = error;
+  {
+    std::lock_guard<std::mutex> lock(recent_mutex_);
+    recent_errors_.push(entry);
   }
+  // entry now holds the evicted error (if any) and is released here, outside the lock
 }
 
 void ErrorHandler::add_to_component_errors(const ErrorInfo& error) {
-  errors_by_component_[error.component].push_back(error);
+  auto& history = errors_by_component_[error.component_id % errors_by_component_.size()];
+  ErrorInfo entry = error;
+  {
+    std::lock_guard<std::mutex> lock(history.mutex);
+    history.errors.push(entry);
+  }
+}
 
-  // Limit component error history to prevent memory growth
-  constexpr size_t MAX_COMPONENT_ERRORS = 100;
-  auto& component_errors = errors_by_component_[error.component];
-  if (component_errors.size() > MAX_COMPONENT_ERRORS) {
-    component_errors.erase(component_errors.begin(),
-                           component_errors.begin() + (component_errors.size() - MAX_COMPONENT_ERRORS));
+const ErrorHandler::ComponentHistory* ErrorHandler::find_component_history(const std::string& component) const {
+  ComponentId id = ComponentRegistry::instance().find_component(component);
+  if (id == ComponentRegistry::INVALID_COMPONENT) {
+    return nullptr;
   }
+  return &errors_by_component_[id % errors_by_component_.size()];
 }
 
 // Convenience functions implementation
@@ -170,15 +624,23 @@ namespace error_reporting {
 
 void report_connection_error(const std::string& component, const std::string& operation,
                              const boost::system::error_code& ec, bool retryable) {
+  auto& handler = ErrorHandler::instance();
+  if (handler.try_coalesce(ErrorLevel::ERROR, ErrorCategory::CONNECTION, component, operation, ec)) {
+    return;
+  }
   ErrorInfo error(ErrorLevel::ERROR, ErrorCategory::CONNECTION, component, operation, ec.message(), ec, retryable);
-  ErrorHandler::instance().report_error(error);
+  handler.report_error(error);
 }
 
 void report_communication_error(const std::string& component, const std::string& operation, const std::string& message,
                                 bool retryable) {
+  auto& handler = ErrorHandler::instance();
+  if (handler.try_coalesce(ErrorLevel::ERROR, ErrorCategory::COMMUNICATION, component, operation)) {
+    return;
+  }
   ErrorInfo error(ErrorLevel::ERROR, ErrorCategory::COMMUNICATION, component, operation, message);
   error.retryable = retryable;
-  ErrorHandler::instance().report_error(error);
+  handler.report_error(error);
 }
 
 void report_configuration_error(const std::string& component, const std::string& operation,
@@ -194,8 +656,12 @@ void report_memory_error(const std::string& component, const std::string& operat
 
 void report_system_error(const std::string& component, const std::string& operation, const std::string& message,
                          const boost::system::error_code& ec) {
+  auto& handler = ErrorHandler::instance();
+  if (handler.try_coalesce(ErrorLevel::ERROR, ErrorCategory::SYSTEM, component, operation, ec)) {
+    return;
+  }
   ErrorInfo error(ErrorLevel::ERROR, ErrorCategory::SYSTEM, component, operation, message, ec);
-  ErrorHandler::instance().report_error(error);
+  handler.report_error(error);
 }
 
 void report_warning(const std::string& component, const std::string& operation, const std::string& message) {
@@ -16,11 +16,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "error_types.hpp"
@@ -28,11 +35,114 @@
 namespace unilink {
 namespace common {
 
+/**
+ * @brief Fixed-capacity ring of errors; the oldest entry is overwritten when full
+ *
+ * Storage grows up to Capacity on demand and is reused afterwards, so pushing
+ * is O(1) and never shifts existing entries.
+ */
+template <size_t Capacity>
+class ErrorRing {
+ public:
+  /**
+   * @brief Append an error
+   *
+   * The error is swapped into its slot; when the ring is full @p error
+   * receives the evicted entry, so the caller can release it outside any lock.
+   */
+  void push(ErrorInfo& error) {
+    if (entries_.size() < Capacity) {
+      entries_.push_back(std::move(error));
+      return;
+    }
+    std::swap(entries_[head_], error);
+    head_ = (head_ + 1) % Capacity;
+  }
+
+  size_t size() const { return entries_.size(); }
+  bool empty() const { return entries_.empty(); }
+
+  /**
+   * @brief Visit entries from oldest to newest
+   */
+  template <typename Visitor>
+  void for_each(Visitor&& visitor) const {
+    for (size_t i = 0; i < entries_.size(); ++i) {
+      visitor(entries_[(head_ + i) % entries_.size()]);
+    }
+  }
+
+  /**
+   * @brief Copy the newest @p count entries, oldest first
+   */
+  std::vector<ErrorInfo> latest(size_t count) const {
+    std::vector<ErrorInfo> result;
+    size_t n = std::min(count, entries_.size());
+    result.reserve(n);
+    for (size_t i = entries_.size() - n; i < entries_.size(); ++i) {
+      result.push_back(entries_[(head_ + i) % entries_.size()]);
+    }
+    return result;
+  }
+
+ private:
+  std::vector<ErrorInfo> entries_;
+  size_t head_ = 0;  // Oldest entry once the ring is full
+};
+
+/**
+ * @brief What to do when the async dispatch queue is full
+ */
+enum class ErrorDropPolicy {
+  DROP_NEWEST = 0,  // Discard the error being reported
+  DROP_OLDEST = 1   // Discard the oldest queued error to make room
+};
+
+/**
+ * @brief Asynchronous error callback dispatch configuration
+ */
+struct ErrorDispatchConfig {
+  using Executor = std::function<void(std::function<void()>)>;
+
+  size_t max_queue_size = 1024;                                // Maximum queued errors
+  ErrorDropPolicy drop_policy = ErrorDropPolicy::DROP_OLDEST;  // Overflow handling
+  Executor executor;                                           // Runs dispatch work; empty = dedicated thread
+
+  ErrorDispatchConfig() = default;
+
+  ErrorDispatchConfig(size_t max_q, ErrorDropPolicy policy) : max_queue_size(max_q), drop_policy(policy) {}
+};
+
+/**
+ * @brief Asynchronous error dispatch statistics
+ */
+struct ErrorDispatchStats {
+  uint64_t enqueued{0};                // Errors accepted into the queue
+  uint64_t dispatched{0};              // Errors delivered to the callbacks
+  uint64_t dropped{0};                 // Errors discarded on overflow
+  uint64_t queue_size{0};              // Current queue depth
+  uint64_t max_queue_size_reached{0};  // Highest queue depth seen
+};
+
 /**
  * @brief Centralized error handling system
  *
  * Provides thread-safe error reporting, statistics collection,
  * and callback-based error handling for the entire unilink library.
+ *
+ * Statistics are atomic counters and error history is kept in fixed-size
+ * rings with one lock per ring, so concurrent reporters only contend briefly
+ * on the shared recent-errors ring. Callbacks run without any lock held.
+ *
+ * With an aggregation window set, identical errors are coalesced: the first
+ * occurrence is delivered immediately, repeats inside the window are only
+ * counted, and one aggregated record is delivered when the window closes.
+ * Closed windows are delivered by a background thread, so the last burst is
+ * reported even if no further error arrives.
+ *
+ * Callbacks run on the reporting thread unless async dispatch is enabled, in
+ * which case errors are queued and delivered on a dedicated thread or on a
+ * user-supplied executor.
  */
 class ErrorHandler {
  public:
@@ -117,9 +227,78 @@ class ErrorHandler {
    */
   size_t get_error_count(const std::string& component, ErrorLevel level) const;
 
+  /**
+   * @brief Set the window used to coalesce identical errors
+   * @param window Aggregation window (zero disables aggregation, the default)
+   *
+   * Errors are identical when component, operation, category and error code
+   * match. Disabling aggregation delivers every pending aggregated record.
+   */
+  void set_aggregation_window(std::chrono::milliseconds window);
+
+  /**
+   * @brief Get the current aggregation window
+   */
+  std::chrono::milliseconds get_aggregation_window() const;
+
+  /**
+   * @brief Count an error against its open aggregation window
+   * @return True if the error was absorbed, false if it must be passed to report_error()
+   *
+   * Lets reporters skip building an ErrorInfo for a repeated failure.
+   */
+  bool try_coalesce(ErrorLevel level, ErrorCategory category, const std::string& component,
+                    const std::string& operation, const boost::system::error_code& ec = boost::system::error_code{});
+
+  /**
+   * @brief Deliver aggregated records for closed windows
+   * @param force Close and deliver windows that are still open as well
+   *
+   * Closed windows are delivered automatically shortly after they expire;
+   * call this with force before shutdown to deliver windows that are still open.
+   */
+  void flush_aggregated_errors(bool force = false);
+
+  /**
+   * @brief Deliver callbacks asynchronously instead of on the reporting thread
+   * @param config Queue bound, drop policy and optional executor
+   *
+   * With no executor a dedicated thread is started. An Asio executor can be
+   * used with `[ex](auto work) { boost::asio::post(ex, std::move(work)); }`.
+   * Re-enabling with a new config first drains the current queue.
+   */
+  void enable_async_dispatch(const ErrorDispatchConfig& config = ErrorDispatchConfig{});
+
+  /**
+   * @brief Drain the queue and return to synchronous dispatch
+   *
+   * Errors an executor has not picked up yet are taken back and delivered on
+   * the calling thread, so this does not depend on the executor still running.
+   * A batch already being delivered on another thread is allowed to finish
+   * first. May be called from an error callback.
+   */
+  void disable_async_dispatch();
+
+  /**
+   * @brief Check if async dispatch is enabled
+   */
+  bool is_async_dispatch_enabled() const;
+
+  /**
+   * @brief Block until every queued error has been delivered
+   *
+   * Must not be called from an error callback.
+   */
+  void wait_for_dispatch();
+
+  /**
+   * @brief Get async dispatch statistics
+   */
+  ErrorDispatchStats get_dispatch_stats() const;
+
  private:
   ErrorHandler() = default;
-  ~ErrorHandler() = default;
+  ~ErrorHandler();
 
   // Non-copyable, non-movable
   ErrorHandler(const ErrorHandler&) = delete;
@@ -127,23 +306,99 @@ class ErrorHandler {
   ErrorHandler(ErrorHandler&&) = delete;
   ErrorHandler& operator=(ErrorHandler&&) = delete;
 
-  mutable std::mutex mutex_;
-  std::vector<ErrorCallback> callbacks_;
+  static constexpr size_t MAX_RECENT_ERRORS = 1000;
+  static constexpr size_t MAX_COMPONENT_ERRORS = 100;
+  static constexpr size_t LEVEL_COUNT = 4;
+  static constexpr size_t CATEGORY_COUNT = 6;
+
+  using CallbackList = std::vector<ErrorCallback>;
+
+  struct ComponentHistory {
+    mutable std::mutex mutex;
+    ErrorRing<MAX_COMPONENT_ERRORS> errors;
+  };
+
+  struct ErrorAggregate {
+    ErrorInfo first;     // Delivered when the window opened
+    uint32_t count;      // Occurrences in the window, including the first
+    int64_t last_ticks;  // Last occurrence (system_clock ticks)
+    int64_t window_end;  // Window close (system_clock ticks)
+  };
+
+  // Copy-on-write: reporters take a snapshot and call it without holding callbacks_mutex_
+  mutable std::mutex callbacks_mutex_;
+  std::shared_ptr<const CallbackList> callbacks_ = std::make_shared<const CallbackList>();
   std::atomic<ErrorLevel> min_level_{ErrorLevel::INFO};
   std::atomic<bool> enabled_{true};
 
-  // Statistics
-  mutable std::mutex stats_mutex_;
-  ErrorStats stats_;
-  std::vector<ErrorInfo> recent_errors_;
-  std::unordered_map<std::string, std::vector<ErrorInfo>> errors_by_component_;
-
-  static constexpr size_t MAX_RECENT_ERRORS = 1000;
-
-  void update_stats(const ErrorInfo& error);
+  // Statistics (first/last error as system_clock ticks, 0 = none)
+  std::atomic<size_t> total_errors_{0};
+  std::array<std::atomic<size_t>, LEVEL_COUNT> errors_by_level_{};
+  std::array<std::atomic<size_t>, CATEGORY_COUNT> errors_by_category_{};
+  std::atomic<size_t> retryable_errors_{0};
+  std::atomic<int64_t> first_error_{0};
+  std::atomic<int64_t> last_error_{0};
+  std::atomic<size_t> coalesced_errors_{0};
+
+  // History
+  mutable std::mutex recent_mutex_;
+  ErrorRing<MAX_RECENT_ERRORS> recent_errors_;
+  std::array<ComponentHistory, ComponentRegistry::MAX_COMPONENTS> errors_by_component_;
+
+  // Aggregation, keyed by aggregation_key() (window in system_clock ticks, 0 = off)
+  std::atomic<int64_t> aggregation_window_{0};
+  mutable std::mutex aggregation_mutex_;
+  std::unordered_map<uint64_t, ErrorAggregate> aggregates_;
+  std::deque<std::pair<int64_t, uint64_t>> aggregation_deadlines_;  // (window_end, key) in opening order
+  std::condition_variable aggregation_cv_;
+  std::thread aggregation_thread_;  // Delivers windows that close without a later report
+  bool aggregation_stopping_ = false;
+
+  // Async dispatch (queue state guarded by dispatch_mutex_)
+  std::atomic<bool> async_dispatch_{false};
+  mutable std::mutex dispatch_mutex_;
+  std::condition_variable dispatch_cv_;
+  std::condition_variable dispatch_idle_cv_;
+  ErrorDispatchConfig dispatch_config_;
+  std::deque<ErrorInfo> dispatch_queue_;
+  size_t dispatch_in_flight_ = 0;
+  bool dispatch_scheduled_ = false;  // Executor mode: a drain task is posted
+  bool dispatch_stopping_ = false;
+  uint64_t dispatch_generation_ = 0;            // Bumped by enable_async_dispatch(); stale drains and workers exit
+  std::thread::id dispatch_delivering_thread_;  // Thread running callbacks for a queued batch
+  std::thread dispatch_thread_;
+  std::atomic<uint64_t> dispatch_enqueued_{0};
+  std::atomic<uint64_t> dispatch_dispatched_{0};
+  std::atomic<uint64_t> dispatch_dropped_{0};
+  std::atomic<uint64_t> dispatch_max_depth_{0};
+
+  // Shared with drains posted to an executor, which may run after the handler is destroyed
+  struct DispatchLifetime {
+    std::mutex mutex;
+    std::condition_variable idle;
+    bool alive = true;
+    size_t running = 0;  // Drains currently inside the handler
+  };
+  std::shared_ptr<DispatchLifetime> dispatch_lifetime_ = std::make_shared<DispatchLifetime>();
+
+  static uint64_t aggregation_key(ErrorCategory category, const std::string& component, const std::string& operation,
+                                  const boost::system::error_code& ec);
+  static bool same_error(const ErrorInfo& error, ErrorLevel level, ErrorCategory category, const std::string& component,
+                         const std::string& operation, const boost::system::error_code& ec);
+  bool aggregate(const ErrorInfo& error);
+  void emit_aggregate(const ErrorAggregate& aggregate);
+  void aggregation_worker();
+  void stop_aggregation_worker();
+  bool enqueue_for_dispatch(const ErrorInfo& error);
+  void dispatch_worker(uint64_t generation);
+  void drain_dispatch_queue(uint64_t generation);
+  void invoke_callbacks(const ErrorInfo& error);
+  void record(const ErrorInfo& error);
+  void update_stats(const ErrorInfo& error, size_t count);
   void notify_callbacks(const ErrorInfo& error);
   void add_to_recent_errors(const ErrorInfo& error);
   void add_to_component_errors(const ErrorInfo& error);
+  const ComponentHistory* find_component_history(const std::string& component) const;
 };
 
 /**
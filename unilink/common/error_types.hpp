@@ -25,6 +25,8 @@
 #include <sstream>
 #include <string>
 
+#include "component_registry.hpp"
+
 namespace unilink {
 namespace common {
 
@@ -71,6 +73,9 @@ struct ErrorInfo {
   bool retryable;                                   // Retry possibility
   uint32_t retry_count;                             // Current retry count
   std::string context;                              // Additional context information
+  ComponentId component_id = ComponentRegistry::INVALID_COMPONENT;  // Interned component (resolved on report)
+  uint32_t occurrences = 1;                               // Identical errors this record stands for (aggregation)
+  std::chrono::system_clock::time_point last_occurrence;  // Time of the last aggregated occurrence
 
   /**
    * @brief Constructor for basic error info
@@ -83,7 +88,8 @@ struct ErrorInfo {
         message(msg),
         timestamp(std::chrono::system_clock::now()),
         retryable(false),
-        retry_count(0) {}
+        retry_count(0),
+        last_occurrence(timestamp) {}
 
   /**
    * @brief Constructor with Boost error code
@@ -98,7 +104,8 @@ struct ErrorInfo {
         boost_error(ec),
         timestamp(std::chrono::system_clock::now()),
         retryable(retry),
-        retry_count(0) {}
+        retry_count(0),
+        last_occurrence(timestamp) {}
 
   /**
    * @brief Get formatted timestamp string
@@ -173,6 +180,10 @@ struct ErrorInfo {
       oss << " [RETRYABLE, count: " << retry_count << "]";
     }
 
+    if (occurrences > 1) {
+      oss << " [x" << occurrences << "]";
+    }
+
     return oss.str();
   }
 };
@@ -187,6 +198,7 @@ struct ErrorStats {
   size_t retryable_errors = 0;
   size_t successful_retries = 0;
   size_t failed_retries = 0;
+  size_t coalesced_errors = 0;  // Duplicates folded into aggregated records
 
   std::chrono::system_clock::time_point first_error;
   std::chrono::system_clock::time_point last_error;
@@ -201,6 +213,7 @@ struct ErrorStats {
     retryable_errors = 0;
     successful_retries = 0;
     failed_retries = 0;
+    coalesced_errors = 0;
     first_error = std::chrono::system_clock::time_point{};
     last_error = std::chrono::system_clock::time_point{};
   }
@@ -69,6 +69,7 @@ void IoContextManager::start() {
   });
 
   running_ = true;
+  if (loop_monitor_) loop_monitor_->start(*ioc_);
 }
 
 void IoContextManager::stop() {
@@ -78,6 +79,9 @@ void IoContextManager::stop() {
       return;
     }
 
+    // Pending probes are discarded with the context below
+    if (loop_monitor_) loop_monitor_->stop();
+
     // Release work guard to allow io_context to terminate naturally
     work_guard_.reset();
 
@@ -127,6 +131,26 @@ std::unique_ptr<boost::asio::io_context> IoContextManager::create_independent_co
   return std::make_unique<IoContext>();
 }
 
+std::shared_ptr<LoopMonitor> IoContextManager::enable_loop_monitor(const LoopMonitorConfig& config) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!loop_monitor_) {
+    loop_monitor_ = std::make_shared<LoopMonitor>(config);
+    if (running_ && ioc_) loop_monitor_->start(*ioc_);
+  }
+  return loop_monitor_;
+}
+
+void IoContextManager::disable_loop_monitor() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (loop_monitor_) loop_monitor_->stop();
+  loop_monitor_.reset();
+}
+
+std::shared_ptr<LoopMonitor> IoContextManager::loop_monitor() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return loop_monitor_;
+}
+
 IoContextManager::~IoContextManager() {
   try {
     stop();
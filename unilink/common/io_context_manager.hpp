@@ -22,6 +22,7 @@
 #include <mutex>
 #include <thread>
 
+#include "unilink/common/loop_monitor.hpp"
 #include "unilink/common/platform.hpp"
 
 namespace unilink {
@@ -53,6 +54,11 @@ class IoContextManager {
   // 🆕 Create independent io_context (for test isolation)
   std::unique_ptr<IoContext> create_independent_context();
 
+  // Probe the shared context for event-loop lag; the monitor follows stop()/start()
+  std::shared_ptr<LoopMonitor> enable_loop_monitor(const LoopMonitorConfig& config = LoopMonitorConfig{});
+  void disable_loop_monitor();
+  std::shared_ptr<LoopMonitor> loop_monitor() const;
+
   // Automatic cleanup in destructor
   ~IoContextManager();
 
@@ -64,6 +70,7 @@ class IoContextManager {
   std::unique_ptr<IoContext> ioc_;
   std::unique_ptr<WorkGuard> work_guard_;
   std::thread io_thread_;
+  std::shared_ptr<LoopMonitor> loop_monitor_;
   std::atomic<bool> running_{false};
   mutable std::mutex mutex_;
 };
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "unilink/common/io_context_pool.hpp"
+
+#include "unilink/common/logger.hpp"
+
+namespace unilink {
+namespace common {
+
+IoContextPool::IoContextPool(size_t size) {
+  if (size == 0) {
+    size = 1;
+  }
+  contexts_.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    contexts_.push_back(std::make_unique<IoContext>(1));  // One thread per context: no internal locking
+  }
+}
+
+IoContextPool::~IoContextPool() {
+  try {
+    stop();
+  } catch (...) {
+    // Ignore exceptions in destructor
+  }
+}
+
+void IoContextPool::start() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (running_) {
+    return;
+  }
+
+  work_guards_.clear();
+  threads_.clear();
+  for (auto& context : contexts_) {
+    context->restart();
+    work_guards_.push_back(std::make_unique<WorkGuard>(context->get_executor()));
+    threads_.emplace_back([ctx = context.get()] {
+      try {
+        ctx->run();
+      } catch (const std::exception& e) {
+        UNILINK_LOG_ERROR("io_context_pool", "run", "Thread error: " + std::string(e.what()));
+      }
+    });
+  }
+  running_ = true;
+}
+
+void IoContextPool::stop() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!running_) {
+    return;
+  }
+
+  work_guards_.clear();
+  for (auto& context : contexts_) {
+    context->stop();
+  }
+  for (auto& thread : threads_) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+  threads_.clear();
+  running_ = false;
+}
+
+bool IoContextPool::is_running() const { return running_.load(); }
+
+boost::asio::io_context& IoContextPool::get_context() {
+  return *contexts_[next_.fetch_add(1, std::memory_order_relaxed) % contexts_.size()];
+}
+
+boost::asio::io_context& IoContextPool::get_context(size_t index) { return *contexts_[index % contexts_.size()]; }
+
+}  // namespace common
+}  // namespace unilink
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <boost/asio.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "unilink/common/platform.hpp"
+
+namespace unilink {
+namespace common {
+
+/**
+ * Fixed set of io_contexts, each run by one thread
+ *
+ * Channels created on the pool are spread round-robin over its contexts, so a
+ * large fleet shares a bounded number of threads instead of one per channel,
+ * and every handler of a given channel still runs on a single thread.
+ * Contexts exist from construction, so channels can be created before start().
+ */
+class IoContextPool {
+ public:
+  using IoContext = boost::asio::io_context;
+  using WorkGuard = boost::asio::executor_work_guard<IoContext::executor_type>;
+
+  explicit IoContextPool(size_t size = std::thread::hardware_concurrency());
+  ~IoContextPool();
+
+  IoContextPool(const IoContextPool&) = delete;
+  IoContextPool& operator=(const IoContextPool&) = delete;
+
+  // Start/stop the worker threads; a stopped pool can be started again
+  void start();
+  void stop();
+  bool is_running() const;
+
+  // Next context in round-robin order
+  IoContext& get_context();
+  IoContext& get_context(size_t index);
+  size_t size() const { return contexts_.size(); }
+
+ private:
+  std::vector<std::unique_ptr<IoContext>> contexts_;
+  std::vector<std::unique_ptr<WorkGuard>> work_guards_;
+  std::vector<std::thread> threads_;
+  std::atomic<size_t> next_{0};
+  std::atomic<bool> running_{false};
+  mutable std::mutex mutex_;
+};
+
+}  // namespace common
+}  // namespace unilink
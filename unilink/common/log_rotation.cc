@@ -17,23 +17,45 @@
 #include "log_rotation.hpp"
 
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
-#include <regex>
 #include <sstream>
+#include <string_view>
+
+#if defined(UNILINK_HAS_ZLIB)
+#include <zlib.h>
+#endif
 
 namespace unilink {
 namespace common {
 
+namespace {
+constexpr const char* LOG_EXTENSION = ".log";
+constexpr const char* COMPRESSED_EXTENSION = ".gz";
+constexpr size_t COMPRESSION_CHUNK_SIZE = 64 * 1024;
+}  // namespace
+
 LogRotation::LogRotation(const LogRotationConfig& config) : config_(config) {}
 
+LogRotation::~LogRotation() {
+  {
+    std::lock_guard<std::mutex> lock(jobs_mutex_);
+    stopping_ = true;
+  }
+  jobs_cv_.notify_all();
+  if (worker_ && worker_->joinable()) {
+    worker_->join();
+  }
+}
+
 bool LogRotation::should_rotate(const std::string& filepath) const {
   std::lock_guard<std::mutex> lock(mutex_);
 
-  if (!std::filesystem::exists(filepath)) {
-    return false;
+  std::error_code ec;
+  auto file_size = std::filesystem::file_size(filepath, ec);
+  if (ec) {
+    return false;  // File doesn't exist or can't be accessed
   }
-
-  size_t file_size = get_file_size(filepath);
   return file_size >= config_.max_file_size_bytes;
 }
 
@@ -44,66 +66,123 @@ std::string LogRotation::rotate(const std::string& filepath) {
     return filepath;  // File doesn't exist, no rotation needed
   }
 
-  // Get the next available file path
-  std::string new_filepath = get_next_file_path(filepath);
+  if (indexed_path_ != filepath) {
+    load_index(filepath);
+  }
 
-  try {
-    // Rename current file to new filepath
-    std::filesystem::rename(filepath, new_filepath);
+  // Rename is atomic; everything slower runs on the background thread
+  std::string new_filepath =
+      get_directory(filepath) + "/" + generate_filename(get_base_filename(filepath), next_index_);
+  std::error_code ec;
+  std::filesystem::rename(filepath, new_filepath, ec);
+  if (ec) {
+    return filepath;  // If rename fails, keep writing to the original path
+  }
 
-    // Clean up old files
-    cleanup_old_files(filepath);
+  ++next_index_;
+  segments_.push_back(new_filepath);
 
-    return filepath;  // Return original path for new log file
-  } catch (const std::filesystem::filesystem_error&) {
-    // If rename fails, return original path
-    return filepath;
+  if (config_.enable_compression && compression_available()) {
+    post([this, new_filepath] {
+      if (compress_file(new_filepath)) {
+        std::lock_guard<std::mutex> index_lock(mutex_);
+        std::replace(segments_.begin(), segments_.end(), new_filepath, new_filepath + COMPRESSED_EXTENSION);
+      }
+    });
   }
+  post([this] { enforce_retention(); });
+
+  return filepath;  // Return original path for new log file
 }
 
 void LogRotation::cleanup_old_files(const std::string& base_filepath) {
-  try {
-    std::vector<std::string> log_files = get_log_files(base_filepath);
-
-    // Sort by modification time (newest first)
-    sort_files_by_time(log_files);
-
-    // Remove files beyond the limit
-    if (log_files.size() > config_.max_files) {
-      for (size_t i = config_.max_files; i < log_files.size(); ++i) {
-        try {
-          std::filesystem::remove(log_files[i]);
-        } catch (const std::filesystem::filesystem_error&) {
-          // Ignore removal errors
-        }
-      }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (indexed_path_ != base_filepath) {
+      load_index(base_filepath);
     }
-  } catch (const std::exception&) {
-    // Ignore cleanup errors
   }
+  enforce_retention();
+}
+
+void LogRotation::wait_for_pending() {
+  std::unique_lock<std::mutex> lock(jobs_mutex_);
+  idle_cv_.wait(lock, [this] { return jobs_.empty() && !busy_; });
+}
+
+bool LogRotation::compression_available() {
+#if defined(UNILINK_HAS_ZLIB)
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool LogRotation::compress_file(const std::string& filepath) {
+#if defined(UNILINK_HAS_ZLIB)
+  std::ifstream input(filepath, std::ios::binary);
+  if (!input.is_open()) {
+    return false;
+  }
+
+  // Write to a temporary name so a half-written archive is never mistaken for a rotated file
+  const std::string compressed_path = filepath + COMPRESSED_EXTENSION;
+  const std::string temp_path = compressed_path + ".tmp";
+  gzFile output = gzopen(temp_path.c_str(), "wb6");
+  if (!output) {
+    return false;
+  }
+
+  std::vector<char> buffer(COMPRESSION_CHUNK_SIZE);
+  bool ok = true;
+  while (ok && input) {
+    input.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    auto count = static_cast<int>(input.gcount());
+    if (count > 0 && gzwrite(output, buffer.data(), static_cast<unsigned>(count)) != count) {
+      ok = false;
+    }
+  }
+  if (gzclose(output) != Z_OK) {
+    ok = false;
+  }
+  input.close();
+
+  std::error_code ec;
+  if (ok) {
+    std::filesystem::rename(temp_path, compressed_path, ec);
+    ok = !ec;
+  }
+  if (!ok) {
+    std::filesystem::remove(temp_path, ec);
+    return false;
+  }
+
+  std::filesystem::remove(filepath, ec);
+  return true;
+#else
+  (void)filepath;
+  return false;
+#endif
 }
 
 std::string LogRotation::get_next_file_path(const std::string& base_filepath) const {
   std::string base_name = get_base_filename(base_filepath);
   std::string directory = get_directory(base_filepath);
 
-  // Find the highest index
-  int max_index = -1;
-  std::vector<std::string> log_files = get_log_files(base_filepath);
-
-  for (const auto& file : log_files) {
-    std::string filename = std::filesystem::path(file).filename().string();
-    int index = get_file_index(filename);
-    if (index > max_index) {
-      max_index = index;
+  int next_index = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (indexed_path_ == base_filepath) {
+      next_index = next_index_;
+    } else {
+      for (const auto& file : get_log_files(base_filepath)) {
+        int index = parse_index(std::filesystem::path(file).filename().string(), base_name);
+        next_index = std::max(next_index, index + 1);
+      }
     }
   }
 
-  // Generate next filename
-  int next_index = max_index + 1;
-  std::string next_filename = generate_filename(base_name, next_index);
-
-  return directory + "/" + next_filename;
+  return directory + "/" + generate_filename(base_name, next_index);
 }
 
 void LogRotation::update_config(const LogRotationConfig& config) {
@@ -112,18 +191,14 @@ void LogRotation::update_config(const LogRotationConfig& config) {
 }
 
 size_t LogRotation::get_file_size(const std::string& filepath) {
-  try {
-    if (std::filesystem::exists(filepath)) {
-      return std::filesystem::file_size(filepath);
-    }
-  } catch (const std::filesystem::filesystem_error&) {
-    // Return 0 if file doesn't exist or can't be accessed
-  }
-  return 0;
+  std::error_code ec;
+  auto size = std::filesystem::file_size(filepath, ec);
+  // Return 0 if file doesn't exist or can't be accessed
+  return ec ? 0 : static_cast<size_t>(size);
 }
 
 std::vector<std::string> LogRotation::get_log_files(const std::string& base_filepath) {
-  std::vector<std::string> log_files;
+  std::vector<std::pair<int, std::string>> indexed_files;
 
   try {
     std::string base_name = std::filesystem::path(base_filepath).stem().string();
@@ -133,14 +208,11 @@ std::vector<std::string> LogRotation::get_log_files(const std::string& base_file
       directory = ".";
     }
 
-    // Create regex pattern to match log files
-    std::regex pattern(base_name + "\\.\\d+\\.log");
-
     for (const auto& entry : std::filesystem::directory_iterator(directory)) {
       if (entry.is_regular_file()) {
-        std::string filename = entry.path().filename().string();
-        if (std::regex_match(filename, pattern)) {
-          log_files.push_back(entry.path().string());
+        int index = parse_index(entry.path().filename().string(), base_name);
+        if (index >= 0) {
+          indexed_files.emplace_back(index, entry.path().string());
         }
       }
     }
@@ -148,9 +220,84 @@ std::vector<std::string> LogRotation::get_log_files(const std::string& base_file
     // Return empty vector if directory access fails
   }
 
+  std::sort(indexed_files.begin(), indexed_files.end());
+
+  std::vector<std::string> log_files;
+  log_files.reserve(indexed_files.size());
+  for (auto& file : indexed_files) {
+    log_files.push_back(std::move(file.second));
+  }
   return log_files;
 }
 
+void LogRotation::load_index(const std::string& filepath) {
+  // One directory scan per log path; rotate() keeps the index current afterwards
+  indexed_path_ = filepath;
+  segments_.clear();
+  next_index_ = 0;
+
+  std::string base_name = get_base_filename(filepath);
+  for (auto& file : get_log_files(filepath)) {
+    int index = parse_index(std::filesystem::path(file).filename().string(), base_name);
+    next_index_ = std::max(next_index_, index + 1);
+    segments_.push_back(std::move(file));
+  }
+}
+
+void LogRotation::enforce_retention() {
+  std::vector<std::string> expired;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (segments_.size() > config_.max_files) {
+      expired.push_back(std::move(segments_.front()));
+      segments_.pop_front();
+    }
+  }
+
+  for (const auto& file : expired) {
+    std::error_code ec;
+    std::filesystem::remove(file, ec);  // Ignore removal errors
+  }
+}
+
+void LogRotation::post(std::function<void()> job) {
+  {
+    std::lock_guard<std::mutex> lock(jobs_mutex_);
+    jobs_.push_back(std::move(job));
+    if (!worker_) {
+      worker_ = std::make_unique<std::thread>(&LogRotation::worker_loop, this);
+    }
+  }
+  jobs_cv_.notify_one();
+}
+
+void LogRotation::worker_loop() {
+  std::unique_lock<std::mutex> lock(jobs_mutex_);
+  while (true) {
+    jobs_cv_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+    if (jobs_.empty()) {
+      break;  // Stopping and drained
+    }
+
+    auto job = std::move(jobs_.front());
+    jobs_.pop_front();
+    busy_ = true;
+    lock.unlock();
+
+    try {
+      job();
+    } catch (const std::exception&) {
+      // Ignore compression and cleanup errors
+    }
+
+    lock.lock();
+    busy_ = false;
+    if (jobs_.empty()) {
+      idle_cv_.notify_all();
+    }
+  }
+}
+
 std::string LogRotation::get_base_filename(const std::string& filepath) const {
   std::filesystem::path path(filepath);
   return path.stem().string();
@@ -162,34 +309,36 @@ std::string LogRotation::get_directory(const std::string& filepath) const {
   return dir.empty() ? "." : dir;
 }
 
-int LogRotation::get_file_index(const std::string& filename) const {
-  // Extract index from filename like "app.1.log"
-  std::regex pattern(R"((\d+)\.log$)");
-  std::smatch match;
-
-  if (std::regex_search(filename, match, pattern)) {
-    return std::stoi(match[1].str());
-  }
-
-  return -1;
-}
-
 std::string LogRotation::generate_filename(const std::string& base_name, int index) const {
   std::ostringstream oss;
-  oss << base_name << "." << index << ".log";
+  oss << base_name << "." << index << LOG_EXTENSION;
   return oss.str();
 }
 
-void LogRotation::sort_files_by_time(std::vector<std::string>& files) const {
-  std::sort(files.begin(), files.end(), [](const std::string& a, const std::string& b) {
-    try {
-      auto time_a = std::filesystem::last_write_time(a);
-      auto time_b = std::filesystem::last_write_time(b);
-      return time_a > time_b;  // Newest first
-    } catch (const std::filesystem::filesystem_error&) {
-      return false;
-    }
-  });
+int LogRotation::parse_index(const std::string& filename, const std::string& base_name) {
+  // Match "{base_name}.{digits}.log" or "{base_name}.{digits}.log.gz"
+  std::string_view name(filename);
+  if (name.size() <= base_name.size() + 1 || name.compare(0, base_name.size(), base_name) != 0 ||
+      name[base_name.size()] != '.') {
+    return -1;
+  }
+  name.remove_prefix(base_name.size() + 1);
+
+  std::string_view compressed(COMPRESSED_EXTENSION);
+  if (name.size() > compressed.size() && name.substr(name.size() - compressed.size()) == compressed) {
+    name.remove_suffix(compressed.size());
+  }
+  std::string_view extension(LOG_EXTENSION);
+  if (name.size() <= extension.size() || name.substr(name.size() - extension.size()) != extension) {
+    return -1;
+  }
+  name.remove_suffix(extension.size());
+
+  if (name.empty() || name.size() > 9 ||
+      !std::all_of(name.begin(), name.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+    return -1;
+  }
+  return std::stoi(std::string(name));
 }
 
 }  // namespace common
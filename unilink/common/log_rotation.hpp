@@ -18,9 +18,14 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace unilink {
@@ -32,7 +37,7 @@ namespace common {
 struct LogRotationConfig {
   size_t max_file_size_bytes = 10 * 1024 * 1024;    // 10MB default
   size_t max_files = 10;                            // Keep 10 files max
-  bool enable_compression = false;                  // Future feature
+  bool enable_compression = false;                  // gzip rotated files in the background (needs zlib)
   std::string file_pattern = "{name}.{index}.log";  // File naming pattern
 
   LogRotationConfig() = default;
@@ -45,6 +50,10 @@ struct LogRotationConfig {
  *
  * Handles log file rotation based on size and automatic cleanup
  * of old log files based on count limits.
+ *
+ * rotate() only renames the active file; compression of the rotated file and
+ * removal of files beyond max_files run on a background thread. Rotated files
+ * are tracked in an index built by one directory scan per log path.
  */
 class LogRotation {
  public:
@@ -54,6 +63,17 @@ class LogRotation {
    */
   explicit LogRotation(const LogRotationConfig& config = LogRotationConfig{});
 
+  /**
+   * @brief Destructor (finishes pending background work)
+   */
+  ~LogRotation();
+
+  // Non-copyable, non-movable (owns the background thread)
+  LogRotation(const LogRotation&) = delete;
+  LogRotation& operator=(const LogRotation&) = delete;
+  LogRotation(LogRotation&&) = delete;
+  LogRotation& operator=(LogRotation&&) = delete;
+
   /**
    * @brief Check if current log file needs rotation
    * @param filepath Current log file path
@@ -74,6 +94,22 @@ class LogRotation {
    */
   void cleanup_old_files(const std::string& base_filepath);
 
+  /**
+   * @brief Block until background compression and cleanup have finished
+   */
+  void wait_for_pending();
+
+  /**
+   * @brief Check whether this build can compress rotated files
+   */
+  static bool compression_available();
+
+  /**
+   * @brief Compress a file to "{filepath}.gz" and remove the original
+   * @return true on success; the original is kept on failure
+   */
+  static bool compress_file(const std::string& filepath);
+
   /**
    * @brief Get next available log file path
    * @param base_filepath Base log file path
@@ -102,7 +138,7 @@ class LogRotation {
   /**
    * @brief Get all log files matching pattern
    * @param base_filepath Base log file path
-   * @return Vector of matching log file paths, sorted by modification time
+   * @return Rotated log files ("{name}.{index}.log" and ".log.gz"), oldest index first
    */
   static std::vector<std::string> get_log_files(const std::string& base_filepath);
 
@@ -110,6 +146,25 @@ class LogRotation {
   LogRotationConfig config_;
   mutable std::mutex mutex_;
 
+  // Cached index of rotated files for indexed_path_, oldest first
+  std::string indexed_path_;
+  std::deque<std::string> segments_;
+  int next_index_ = 0;
+
+  // Background compression and retention
+  std::unique_ptr<std::thread> worker_;
+  std::deque<std::function<void()>> jobs_;
+  std::mutex jobs_mutex_;
+  std::condition_variable jobs_cv_;
+  std::condition_variable idle_cv_;
+  bool busy_ = false;
+  bool stopping_ = false;
+
+  void load_index(const std::string& filepath);
+  void enforce_retention();
+  void post(std::function<void()> job);
+  void worker_loop();
+
   /**
    * @brief Extract base filename without extension
    * @param filepath Full file path
@@ -124,13 +179,6 @@ class LogRotation {
    */
   std::string get_directory(const std::string& filepath) const;
 
-  /**
-   * @brief Get file index from filename
-   * @param filename Filename to parse
-   * @return File index, -1 if not found
-   */
-  int get_file_index(const std::string& filename) const;
-
   /**
    * @brief Generate filename with index
    * @param base_name Base filename
@@ -140,10 +188,10 @@ class LogRotation {
   std::string generate_filename(const std::string& base_name, int index) const;
 
   /**
-   * @brief Sort files by modification time (newest first)
-   * @param files Vector of file paths to sort
+   * @brief Parse the index of a rotated file
+   * @return Index of "{base_name}.{index}.log[.gz]", -1 if the name does not match
    */
-  void sort_files_by_time(std::vector<std::string>& files) const;
+  static int parse_index(const std::string& filename, const std::string& base_name);
 };
 
 }  // namespace common
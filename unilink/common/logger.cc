@@ -16,6 +16,7 @@
 
 #include "logger.hpp"
 
+#include <algorithm>
 #include <condition_variable>
 #include <ctime>
 #include <filesystem>
@@ -24,13 +25,143 @@
 #include <queue>
 #include <sstream>
 #include <thread>
+#include <unordered_map>
+#include <utility>
 
 namespace unilink {
 namespace common {
 
-Logger::Logger() = default;
+namespace {
+
+constexpr int64_t DEFAULT_SUMMARY_INTERVAL_NS = 10'000'000'000;
+
+constexpr size_t MAX_CACHED_COMPONENTS = 1024;
+
+// Resolve a component name without registering it. Hits are cached per thread
+// for good because IDs are never reused; misses are cached until the registry grows.
+ComponentId find_component_cached(const std::string& component) {
+  thread_local std::unordered_map<std::string, std::pair<ComponentId, size_t>> cache;
+  auto& registry = ComponentRegistry::instance();
+  auto it = cache.find(component);
+  if (it != cache.end() && (it->second.first != ComponentRegistry::INVALID_COMPONENT ||
+                            it->second.second == registry.component_count())) {
+    return it->second.first;
+  }
+
+  size_t count = registry.component_count();
+  ComponentId id = registry.find_component(component);
+  if (cache.size() >= MAX_CACHED_COMPONENTS) {
+    cache.clear();
+  }
+  cache[component] = {id, count};
+  return id;
+}
+
+// Intern a name through the registry once per thread; registered IDs never change
+template <typename Intern>
+uint16_t intern_cached(std::unordered_map<std::string, uint16_t>& cache, const std::string& name, Intern intern) {
+  auto it = cache.find(name);
+  if (it != cache.end()) {
+    return it->second;
+  }
+  uint16_t id = intern(name);
+  if (cache.size() >= MAX_CACHED_COMPONENTS) {
+    cache.clear();
+  }
+  cache.emplace(name, id);
+  return id;
+}
+
+int64_t steady_now_ns() noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+struct SuppressionSiteRegistry {
+  std::mutex mutex;
+  std::vector<LogSuppressionSite*> sites;
+};
+
+SuppressionSiteRegistry& suppression_sites() {
+  static SuppressionSiteRegistry registry;
+  return registry;
+}
+
+std::string format_rate(double messages_per_second) {
+  std::ostringstream oss;
+  oss << messages_per_second;
+  return oss.str();
+}
+
+}  // namespace
+
+LogSuppressionSite::LogSuppressionSite(LogLevel level, std::string_view component, std::string_view operation,
+                                       std::string policy)
+    : tag_(component, operation), level_(level), policy_(std::move(policy)) {
+  auto& registry = suppression_sites();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.sites.push_back(this);
+}
+
+LogSuppressionSite::~LogSuppressionSite() {
+  auto& registry = suppression_sites();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.sites.erase(std::remove(registry.sites.begin(), registry.sites.end(), this), registry.sites.end());
+}
+
+void LogSuppressionSite::for_each(const std::function<void(LogSuppressionSite& site)>& visitor) {
+  auto& registry = suppression_sites();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto* site : registry.sites) {
+    visitor(*site);
+  }
+}
+
+void LogSuppressionSite::suppress() noexcept {
+  suppressed_.fetch_add(1, std::memory_order_relaxed);
+  Logger::instance().on_suppressed();
+}
+
+LogRateLimiter::LogRateLimiter(LogLevel level, std::string_view component, std::string_view operation,
+                               double messages_per_second, uint32_t burst)
+    : LogSuppressionSite(level, component, operation,
+                         "rate limit " + format_rate(messages_per_second) + "/s, burst " + std::to_string(burst)),
+      interval_ns_(static_cast<int64_t>(1e9 / std::max(messages_per_second, 1e-6))),
+      tolerance_ns_(interval_ns_ * static_cast<int64_t>(std::max<uint32_t>(burst, 1) - 1)) {}
+
+bool LogRateLimiter::allow() noexcept {
+  const int64_t now = steady_now_ns();
+  int64_t next = next_ns_.load(std::memory_order_relaxed);
+  while (true) {
+    int64_t start = std::max(next, now);
+    if (start - now > tolerance_ns_) {
+      suppress();
+      return false;
+    }
+    if (next_ns_.compare_exchange_weak(next, start + interval_ns_, std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+}
+
+LogSampler::LogSampler(LogLevel level, std::string_view component, std::string_view operation, uint32_t every_n)
+    : LogSuppressionSite(level, component, operation, "sampled 1 in " + std::to_string(std::max<uint32_t>(every_n, 1))),
+      every_n_(std::max<uint32_t>(every_n, 1)) {}
+
+Logger::Logger()
+    : text_format_(ComponentRegistry::instance().register_format("{}")),
+      summary_interval_ns_(DEFAULT_SUMMARY_INTERVAL_NS),
+      next_summary_ns_(steady_now_ns() + DEFAULT_SUMMARY_INTERVAL_NS) {
+  // Construct the site registry first so it outlives the singleton
+  suppression_sites();
+  for (auto& level : component_levels_) {
+    level.store(LEVEL_INHERIT, std::memory_order_relaxed);
+  }
+}
 
 Logger::~Logger() {
+  binary_enabled_.store(false);
+  binary_writer_.close();
   teardown_async_logging();
   flush();
 }
@@ -44,6 +175,59 @@ void Logger::set_level(LogLevel level) { current_level_.store(level); }
 
 LogLevel Logger::get_level() const { return current_level_.load(); }
 
+bool Logger::set_component_level(const std::string& component, LogLevel level) {
+  if (set_component_level(ComponentRegistry::instance().register_component(component), level)) {
+    return true;
+  }
+  log(LogLevel::WARNING, "logger", "set_component_level",
+      "Component table is full; ignoring level override for '" + component + "'");
+  return false;
+}
+
+bool Logger::set_component_level(ComponentId component, LogLevel level) {
+  if (component >= ComponentRegistry::OVERFLOW_COMPONENT) {
+    return false;  // The overflow slot is shared by every name past the table's capacity
+  }
+  uint8_t previous = component_levels_[component].exchange(static_cast<uint8_t>(level));
+  if (previous == LEVEL_INHERIT) {
+    component_override_count_.fetch_add(1);
+  }
+  return true;
+}
+
+void Logger::clear_component_level(const std::string& component) {
+  ComponentId id = ComponentRegistry::instance().find_component(component);
+  if (id != ComponentRegistry::INVALID_COMPONENT) {
+    clear_component_level(id);
+  }
+}
+
+void Logger::clear_component_level(ComponentId component) {
+  if (component >= component_levels_.size()) {
+    return;
+  }
+  uint8_t previous = component_levels_[component].exchange(LEVEL_INHERIT);
+  if (previous != LEVEL_INHERIT) {
+    component_override_count_.fetch_sub(1);
+  }
+}
+
+void Logger::clear_component_levels() {
+  for (size_t i = 0; i < component_levels_.size(); ++i) {
+    clear_component_level(static_cast<ComponentId>(i));
+  }
+}
+
+LogLevel Logger::get_component_level(ComponentId component) const {
+  if (component < component_levels_.size()) {
+    uint8_t threshold = component_levels_[component].load();
+    if (threshold != LEVEL_INHERIT) {
+      return static_cast<LogLevel>(threshold);
+    }
+  }
+  return current_level_.load();
+}
+
 void Logger::set_console_output(bool enable) {
   std::lock_guard<std::mutex> lock(mutex_);
   if (enable) {
@@ -75,12 +259,30 @@ void Logger::set_file_output_with_rotation(const std::string& filename, const Lo
     current_log_file_.clear();
     outputs_.fetch_and(~static_cast<int>(LogOutput::FILE));
   } else {
-    log_rotation_ = std::make_unique<LogRotation>(config);
+    log_rotation_ = std::make_shared<LogRotation>(config);
     current_log_file_ = filename;
     open_log_file(filename);
   }
 }
 
+void Logger::set_binary_output(const std::string& filename, const BinaryLogConfig& config) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  binary_enabled_.store(false);
+  if (filename.empty()) {
+    binary_writer_.close();
+    return;
+  }
+
+  if (binary_writer_.open(filename, config)) {
+    binary_enabled_.store(true);
+  } else {
+    std::cerr << "Failed to open binary log file: " << filename << std::endl;
+  }
+}
+
+bool Logger::is_binary_output_enabled() const { return binary_enabled_.load(); }
+
 void Logger::set_callback(LogCallback callback) {
   std::lock_guard<std::mutex> lock(mutex_);
   callback_ = std::move(callback);
@@ -102,10 +304,83 @@ void Logger::set_format(const std::string& format) {
   format_string_ = format;
 }
 
+void Logger::set_suppression_summary_interval(std::chrono::milliseconds interval) {
+  int64_t interval_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count();
+  summary_interval_ns_.store(interval_ns);
+  next_summary_ns_.store(steady_now_ns() + interval_ns);
+}
+
+void Logger::report_suppressed() {
+  // Collect first: logging the summaries must not happen under the site registry lock
+  struct Summary {
+    const LogSuppressionSite* site;
+    uint64_t count;
+  };
+  std::vector<Summary> summaries;
+  summarized_total_.store(suppressed_total_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  LogSuppressionSite::for_each([&summaries](LogSuppressionSite& site) {
+    uint64_t count = site.take_suppressed();
+    if (count > 0) {
+      summaries.push_back({&site, count});
+    }
+  });
+
+  for (const auto& summary : summaries) {
+    log(summary.site->level(), summary.site->tag(),
+        "Suppressed " + std::to_string(summary.count) + " messages (" + summary.site->policy() + ")");
+  }
+}
+
+uint64_t Logger::get_suppressed_count() const { return suppressed_total_.load(); }
+
+void Logger::on_suppressed() noexcept {
+  suppressed_total_.fetch_add(1, std::memory_order_relaxed);
+  try {
+    poll_suppression_summary();
+  } catch (...) {
+    // A failed summary must not escape into the caller's error path
+  }
+}
+
+void Logger::poll_suppression_summary() {
+  int64_t now = steady_now_ns();
+  int64_t due = next_summary_ns_.load(std::memory_order_relaxed);
+  if (now < due) {
+    return;
+  }
+  // Only the thread that moves the deadline writes the summary
+  if (next_summary_ns_.compare_exchange_strong(due, now + summary_interval_ns_.load(std::memory_order_relaxed),
+                                               std::memory_order_relaxed)) {
+    report_suppressed();
+  }
+}
+
+void Logger::poll_pending_suppression_summary() noexcept {
+  // Messages that still get through close out a quiet site's summary; skip the clock when nothing is owed
+  if (suppressed_total_.load(std::memory_order_relaxed) == summarized_total_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  try {
+    poll_suppression_summary();
+  } catch (...) {
+    // A failed summary must not take the message being logged with it
+  }
+}
+
 void Logger::flush() {
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (file_output_ && file_output_->is_open()) {
-    file_output_->flush();
+  report_suppressed();
+  binary_writer_.flush();
+  std::shared_ptr<LogRotation> rotation;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_output_ && file_output_->is_open()) {
+      file_output_->flush();
+    }
+    rotation = log_rotation_;
+  }
+  // Wait for background compression without blocking other loggers
+  if (rotation) {
+    rotation->wait_for_pending();
   }
   std::cout.flush();
   std::cerr.flush();
@@ -113,13 +388,51 @@ void Logger::flush() {
 
 void Logger::log(LogLevel level, const std::string& component, const std::string& operation,
                  const std::string& message) {
-  if (!enabled_.load() || level < current_level_.load()) {
+  if (component_override_count_.load(std::memory_order_relaxed) == 0) {
+    if (!enabled_.load() || level < current_level_.load()) {
+      return;
+    }
+  } else if (!should_log(level, find_component_cached(component))) {
+    return;
+  }
+
+  if (binary_enabled_.load(std::memory_order_relaxed)) {
+    thread_local std::unordered_map<std::string, uint16_t> components;
+    thread_local std::unordered_map<std::string, uint16_t> operations;
+    auto& registry = ComponentRegistry::instance();
+    auto component_id = intern_cached(components, component, [&](const std::string& name) {
+      return registry.register_component(name);
+    });
+    auto operation_id = intern_cached(operations, operation, [&](const std::string& name) {
+      return registry.register_operation(name);
+    });
+    write_binary(level, component_id, operation_id, message);
+    return;
+  }
+
+  dispatch(level, component, operation, message);
+}
+
+void Logger::log(LogLevel level, const LogTag& tag, const std::string& message) {
+  if (!should_log(level, tag.component)) {
+    return;
+  }
+
+  if (binary_enabled_.load(std::memory_order_relaxed)) {
+    write_binary(level, tag.component, tag.operation, message);
     return;
   }
 
+  dispatch(level, tag.component_name, tag.operation_name, message);
+}
+
+void Logger::dispatch(LogLevel level, std::string_view component, std::string_view operation,
+                      const std::string& message) {
+  poll_pending_suppression_summary();
+
   // Use async logging if enabled
   if (async_enabled_.load()) {
-    LogEntry entry(level, component, operation, message);
+    LogEntry entry(level, std::string(component), std::string(operation), message);
 
     // Always update total logs count
     update_stats_on_enqueue();
@@ -132,7 +445,7 @@ void Logger::log(LogLevel level, const std::string& component, const std::string
 
     {
       std::lock_guard<std::mutex> lock(queue_mutex_);
-      log_queue_.push(entry);
+      log_queue_.push(std::move(entry));
     }
 
     queue_cv_.notify_one();
@@ -157,6 +470,11 @@ void Logger::log(LogLevel level, const std::string& component, const std::string
   }
 }
 
+void Logger::write_binary(LogLevel level, ComponentId component, OperationId operation, const std::string& message) {
+  poll_pending_suppression_summary();
+  binary_writer_.write_message(static_cast<uint8_t>(level), component, operation, text_format_, message);
+}
+
 void Logger::debug(const std::string& component, const std::string& operation, const std::string& message) {
   log(LogLevel::DEBUG, component, operation, message);
 }
@@ -177,7 +495,7 @@ void Logger::critical(const std::string& component, const std::string& operation
   log(LogLevel::CRITICAL, component, operation, message);
 }
 
-std::string Logger::format_message(LogLevel level, const std::string& component, const std::string& operation,
+std::string Logger::format_message(LogLevel level, std::string_view component, std::string_view operation,
                                    const std::string& message) {
   std::string result = format_string_;
 
@@ -424,6 +742,8 @@ void Logger::worker_loop() {
     auto now = std::chrono::steady_clock::now();
     if (now - last_flush >= async_config_.flush_interval) {
       last_flush = now;
+      // Summaries are also due when the suppressing call sites have gone quiet
+      poll_suppression_summary();
     }
   }
 }
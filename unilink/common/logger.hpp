@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
@@ -27,9 +28,12 @@
 #include <queue>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <vector>
 
+#include "binary_log.hpp"
+#include "component_registry.hpp"
 #include "log_rotation.hpp"
 
 #ifdef DEBUG
@@ -132,6 +136,87 @@ struct AsyncLogStats {
   }
 };
 
+/**
+ * @brief Per-call-site record of suppressed log messages
+ *
+ * The rate-limited and sampled logging macros create one static site per call
+ * site. Sites register themselves so that Logger can report how many messages
+ * each one dropped in a periodic summary line.
+ */
+class LogSuppressionSite {
+ public:
+  LogSuppressionSite(LogLevel level, std::string_view component, std::string_view operation, std::string policy);
+  ~LogSuppressionSite();
+
+  // Non-copyable, non-movable (registered by address)
+  LogSuppressionSite(const LogSuppressionSite&) = delete;
+  LogSuppressionSite& operator=(const LogSuppressionSite&) = delete;
+  LogSuppressionSite(LogSuppressionSite&&) = delete;
+  LogSuppressionSite& operator=(LogSuppressionSite&&) = delete;
+
+  const LogTag& tag() const noexcept { return tag_; }
+  LogLevel level() const noexcept { return level_; }
+  const std::string& policy() const noexcept { return policy_; }
+
+  /**
+   * @brief Take the number of messages suppressed since the last call
+   */
+  uint64_t take_suppressed() noexcept { return suppressed_.exchange(0, std::memory_order_relaxed); }
+
+  /**
+   * @brief Visit every live site
+   */
+  static void for_each(const std::function<void(LogSuppressionSite& site)>& visitor);
+
+ protected:
+  void suppress() noexcept;
+
+ private:
+  LogTag tag_;
+  LogLevel level_;
+  std::string policy_;
+  std::atomic<uint64_t> suppressed_{0};
+};
+
+/**
+ * @brief Token-bucket limiter for one logging call site
+ *
+ * Implemented as GCRA on a single atomic deadline, so allow() is lock-free:
+ * up to @p burst messages pass at once, then one per 1/@p messages_per_second.
+ */
+class LogRateLimiter : public LogSuppressionSite {
+ public:
+  LogRateLimiter(LogLevel level, std::string_view component, std::string_view operation, double messages_per_second,
+                 uint32_t burst);
+
+  bool allow() noexcept;
+
+ private:
+  int64_t interval_ns_;
+  int64_t tolerance_ns_;
+  std::atomic<int64_t> next_ns_{0};  // Theoretical arrival time of the next message
+};
+
+/**
+ * @brief 1-in-N sampler for one logging call site
+ */
+class LogSampler : public LogSuppressionSite {
+ public:
+  LogSampler(LogLevel level, std::string_view component, std::string_view operation, uint32_t every_n);
+
+  bool allow() noexcept {
+    if (counter_.fetch_add(1, std::memory_order_relaxed) % every_n_ == 0) {
+      return true;
+    }
+    suppress();
+    return false;
+  }
+
+ private:
+  uint64_t every_n_;
+  std::atomic<uint64_t> counter_{0};
+};
+
 /**
  * @brief Centralized logging system with async support
  *
@@ -158,6 +243,51 @@ class Logger {
    */
   LogLevel get_level() const;
 
+  /**
+   * @brief Override the minimum log level for one component
+   * @param component Component name or ID (e.g., "tcp_client")
+   * @param level Messages from this component below this level will be ignored
+   * @return false if the component table is full; names past its capacity share
+   *         OVERFLOW_COMPONENT, which cannot carry an override
+   */
+  bool set_component_level(const std::string& component, LogLevel level);
+  bool set_component_level(ComponentId component, LogLevel level);
+
+  /**
+   * @brief Remove a component override so it follows the global level again
+   */
+  void clear_component_level(const std::string& component);
+  void clear_component_level(ComponentId component);
+
+  /**
+   * @brief Remove all component overrides
+   */
+  void clear_component_levels();
+
+  /**
+   * @brief Get the effective log level for a component
+   */
+  LogLevel get_component_level(ComponentId component) const;
+
+  /**
+   * @brief Check whether a message would be logged (O(1), lock-free)
+   * @param level Message level
+   * @param component Interned component ID
+   */
+  bool should_log(LogLevel level, ComponentId component) const noexcept {
+    if (!enabled_.load(std::memory_order_relaxed)) {
+      return false;
+    }
+    // Unknown components, and the shared overflow slot, follow the global level
+    uint8_t threshold = component < component_levels_.size()
+                            ? component_levels_[component].load(std::memory_order_relaxed)
+                            : LEVEL_INHERIT;
+    if (threshold == LEVEL_INHERIT) {
+      return level >= current_level_.load(std::memory_order_relaxed);
+    }
+    return static_cast<uint8_t>(level) >= threshold;
+  }
+
   /**
    * @brief Enable/disable console output
    * @param enable True to enable console output
@@ -178,6 +308,22 @@ class Logger {
   void set_file_output_with_rotation(const std::string& filename,
                                      const LogRotationConfig& config = LogRotationConfig{});
 
+  /**
+   * @brief Set binary log output
+   * @param filename Binary log path (empty string to disable binary output)
+   * @param config Segment size and retention
+   *
+   * While enabled, records are written as compact binary records (interned IDs
+   * and raw arguments) instead of formatted text. Use the unilink_log_decode
+   * tool to render them.
+   */
+  void set_binary_output(const std::string& filename, const BinaryLogConfig& config = BinaryLogConfig{});
+
+  /**
+   * @brief Check if binary log output is enabled
+   */
+  bool is_binary_output_enabled() const;
+
   /**
    * @brief Enable/disable async logging
    * @param enable True to enable async logging
@@ -229,8 +375,46 @@ class Logger {
    */
   void flush();
 
+  /**
+   * @brief Set how often suppressed-message summaries are written
+   * @param interval Minimum time between summaries (default 10 s)
+   */
+  void set_suppression_summary_interval(std::chrono::milliseconds interval);
+
+  /**
+   * @brief Write one summary line per call site that suppressed messages since the last summary
+   */
+  void report_suppressed();
+
+  /**
+   * @brief Total messages dropped by rate-limited and sampled call sites
+   */
+  uint64_t get_suppressed_count() const;
+
   // Main logging functions
   void log(LogLevel level, const std::string& component, const std::string& operation, const std::string& message);
+  void log(LogLevel level, const LogTag& tag, const std::string& message);
+
+  /**
+   * @brief Log a format string with raw arguments (see UNILINK_LOG_FMT)
+   *
+   * In binary mode the arguments are copied as-is; otherwise "{}" placeholders
+   * are rendered to text and the message takes the normal path.
+   */
+  template <typename... Args>
+  void log_format(LogLevel level, const LogTag& tag, FormatId format, std::string_view format_string,
+                  const Args&... args) {
+    binary_log::ArgBuffer buffer;
+    binary_log::encode_args(buffer, args...);
+    if (binary_enabled_.load(std::memory_order_relaxed)) {
+      poll_pending_suppression_summary();
+      binary_writer_.write(static_cast<uint8_t>(level), tag.component, tag.operation, format, buffer.data(),
+                           buffer.size(), buffer.truncated());
+      return;
+    }
+    dispatch(level, tag.component_name, tag.operation_name,
+             binary_log::render(format_string, buffer.data(), buffer.size()));
+  }
 
   void debug(const std::string& component, const std::string& operation, const std::string& message);
   void info(const std::string& component, const std::string& operation, const std::string& message);
@@ -248,17 +432,34 @@ class Logger {
   Logger(Logger&&) = delete;
   Logger& operator=(Logger&&) = delete;
 
+  static constexpr uint8_t LEVEL_INHERIT = 0xFF;
+
   mutable std::mutex mutex_;
   std::atomic<LogLevel> current_level_{LogLevel::INFO};
   std::atomic<bool> enabled_{true};
+
+  // Per-component thresholds indexed by ComponentId (LEVEL_INHERIT = use current_level_)
+  std::array<std::atomic<uint8_t>, ComponentRegistry::MAX_COMPONENTS> component_levels_;
+  std::atomic<size_t> component_override_count_{0};
   std::atomic<int> outputs_{static_cast<int>(LogOutput::CONSOLE)};
 
   std::string format_string_{"{timestamp} [{level}] [{component}] [{operation}] {message}"};
   std::unique_ptr<std::ofstream> file_output_;
   LogCallback callback_;
 
+  // Binary output support
+  BinaryLogWriter binary_writer_;
+  std::atomic<bool> binary_enabled_{false};
+  FormatId text_format_;  // "{}" format used for preformatted messages
+
+  // Suppressed-message summaries (steady_clock nanoseconds)
+  std::atomic<uint64_t> suppressed_total_{0};
+  std::atomic<uint64_t> summarized_total_{0};  // suppressed_total_ when the last summary was taken
+  std::atomic<int64_t> summary_interval_ns_;
+  std::atomic<int64_t> next_summary_ns_;
+
   // Log rotation support
-  std::unique_ptr<LogRotation> log_rotation_;
+  std::shared_ptr<LogRotation> log_rotation_;  // Shared so flush() can wait outside mutex_
   std::string current_log_file_;
 
   // Async logging support
@@ -277,7 +478,14 @@ class Logger {
   std::condition_variable queue_cv_;
   mutable std::mutex stats_mutex_;
 
-  std::string format_message(LogLevel level, const std::string& component, const std::string& operation,
+  friend class LogSuppressionSite;
+  void on_suppressed() noexcept;
+  void poll_suppression_summary();
+  void poll_pending_suppression_summary() noexcept;
+
+  void dispatch(LogLevel level, std::string_view component, std::string_view operation, const std::string& message);
+  void write_binary(LogLevel level, ComponentId component, OperationId operation, const std::string& message);
+  std::string format_message(LogLevel level, std::string_view component, std::string_view operation,
                              const std::string& message);
   std::string level_to_string(LogLevel level);
   std::string get_timestamp();
@@ -307,39 +515,104 @@ class Logger {
 
 /**
  * @brief Convenience macros for logging
+ *
+ * When component and operation are string literals they are interned once per
+ * call site and the message expression is only evaluated if the level is
+ * enabled for that component. Names built at runtime take the string path.
  */
+#define UNILINK_LOG_AT(log_level, log_component, log_operation, log_message)                                 \
+  do {                                                                                                     \
+    auto& _unilink_logger = unilink::common::Logger::instance();                                           \
+    if constexpr (unilink::common::is_static_log_tag_v<decltype(log_component), decltype(log_operation)>) { \
+      static const unilink::common::LogTag _unilink_log_tag(log_component, log_operation);                 \
+      if (_unilink_logger.should_log(log_level, _unilink_log_tag.component)) {                             \
+        _unilink_logger.log(log_level, _unilink_log_tag, log_message);                                     \
+      }                                                                                                    \
+    } else {                                                                                               \
+      _unilink_logger.log(log_level, log_component, log_operation, log_message);                           \
+    }                                                                                                      \
+  } while (0)
+
 #define UNILINK_LOG_DEBUG(component, operation, message) \
-  unilink::common::Logger::instance().debug(component, operation, message)
+  UNILINK_LOG_AT(unilink::common::LogLevel::DEBUG, component, operation, message)
 
 #define UNILINK_LOG_INFO(component, operation, message) \
-  unilink::common::Logger::instance().info(component, operation, message)
+  UNILINK_LOG_AT(unilink::common::LogLevel::INFO, component, operation, message)
 
 #define UNILINK_LOG_WARNING(component, operation, message) \
-  unilink::common::Logger::instance().warning(component, operation, message)
+  UNILINK_LOG_AT(unilink::common::LogLevel::WARNING, component, operation, message)
 
 #define UNILINK_LOG_ERROR(component, operation, message) \
-  unilink::common::Logger::instance().error(component, operation, message)
+  UNILINK_LOG_AT(unilink::common::LogLevel::ERROR, component, operation, message)
 
 #define UNILINK_LOG_CRITICAL(component, operation, message) \
-  unilink::common::Logger::instance().critical(component, operation, message)
+  UNILINK_LOG_AT(unilink::common::LogLevel::CRITICAL, component, operation, message)
+
+/**
+ * @brief Format-string logging: arguments are captured raw and rendered later
+ *
+ * Placeholders are "{}". Arguments may be integers, floating point values,
+ * bools, enums or strings. Component, operation and format must be string
+ * literals, and at least one argument is required (use the plain macros for
+ * fixed messages).
+ */
+#define UNILINK_LOG_FMT(log_level, log_component, log_operation, log_fmt, ...)                              \
+  do {                                                                                                     \
+    static_assert(unilink::common::is_static_log_tag_v<decltype(log_component), decltype(log_operation)>,  \
+                  "component and operation must be string literals");                                      \
+    static const unilink::common::LogTag _unilink_log_tag(log_component, log_operation);                   \
+    static const unilink::common::FormatId _unilink_log_format =                                           \
+        unilink::common::ComponentRegistry::instance().register_format(log_fmt);                           \
+    auto& _unilink_logger = unilink::common::Logger::instance();                                           \
+    if (_unilink_logger.should_log(log_level, _unilink_log_tag.component)) {                               \
+      _unilink_logger.log_format(log_level, _unilink_log_tag, _unilink_log_format, log_fmt, __VA_ARGS__);    \
+    }                                                                                                      \
+  } while (0)
 
 /**
- * @brief Conditional logging macros (only evaluate message if level is enabled)
+ * @brief Rate-limited logging: at most @p burst messages at once, then @p per_second
+ *
+ * For call sites that can fire in a tight loop during an incident (retries,
+ * accept errors). Component and operation must be string literals. Dropped
+ * messages are counted and reported by Logger's periodic summary line.
  */
-#define UNILINK_LOG_DEBUG_IF(component, operation, message)                                    \
-  do {                                                                                         \
-    if (unilink::common::Logger::instance().get_level() <= unilink::common::LogLevel::DEBUG) { \
-      UNILINK_LOG_DEBUG(component, operation, message);                                        \
-    }                                                                                          \
+#define UNILINK_LOG_RATE_LIMITED(log_level, log_component, log_operation, per_second, burst, log_message) \
+  do {                                                                                                     \
+    static_assert(unilink::common::is_static_log_tag_v<decltype(log_component), decltype(log_operation)>,  \
+                  "component and operation must be string literals");                                      \
+    static unilink::common::LogRateLimiter _unilink_log_limiter(log_level, log_component, log_operation,   \
+                                                                per_second, burst);                        \
+    auto& _unilink_logger = unilink::common::Logger::instance();                                           \
+    if (_unilink_logger.should_log(log_level, _unilink_log_limiter.tag().component) &&                     \
+        _unilink_log_limiter.allow()) {                                                                    \
+      _unilink_logger.log(log_level, _unilink_log_limiter.tag(), log_message);                             \
+    }                                                                                                      \
   } while (0)
 
-#define UNILINK_LOG_INFO_IF(component, operation, message)                                    \
-  do {                                                                                        \
-    if (unilink::common::Logger::instance().get_level() <= unilink::common::LogLevel::INFO) { \
-      UNILINK_LOG_INFO(component, operation, message);                                        \
-    }                                                                                         \
+/**
+ * @brief Sampled logging: only every @p every_n -th message of the call site is written
+ */
+#define UNILINK_LOG_SAMPLED(log_level, log_component, log_operation, every_n, log_message)                 \
+  do {                                                                                                     \
+    static_assert(unilink::common::is_static_log_tag_v<decltype(log_component), decltype(log_operation)>,  \
+                  "component and operation must be string literals");                                      \
+    static unilink::common::LogSampler _unilink_log_sampler(log_level, log_component, log_operation,       \
+                                                            every_n);                                      \
+    auto& _unilink_logger = unilink::common::Logger::instance();                                           \
+    if (_unilink_logger.should_log(log_level, _unilink_log_sampler.tag().component) &&                     \
+        _unilink_log_sampler.allow()) {                                                                    \
+      _unilink_logger.log(log_level, _unilink_log_sampler.tag(), log_message);                             \
+    }                                                                                                      \
   } while (0)
 
+/**
+ * @brief Conditional logging macros (kept for compatibility; the plain macros
+ * already skip message evaluation when the level is disabled)
+ */
+#define UNILINK_LOG_DEBUG_IF(component, operation, message) UNILINK_LOG_DEBUG(component, operation, message)
+
+#define UNILINK_LOG_INFO_IF(component, operation, message) UNILINK_LOG_INFO(component, operation, message)
+
 /**
  * @brief Performance logging macros for expensive operations
  */
@@ -352,7 +625,7 @@ class Logger {
     auto _perf_duration_##operation =                                                                           \
         std::chrono::duration_cast<std::chrono::microseconds>(_perf_end_##operation - _perf_start_##operation)  \
             .count();                                                                                           \
-    UNILINK_LOG_DEBUG(component, operation, "Duration: " + std::to_string(_perf_duration_##operation) + " μs"); \
+    UNILINK_LOG_DEBUG(component, #operation, "Duration: " + std::to_string(_perf_duration_##operation) + " μs"); \
   } while (0)
 
 }  // namespace common
@@ -0,0 +1,178 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "unilink/common/loop_monitor.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#if !defined(_WIN32)
+#include <time.h>
+#endif
+
+namespace unilink {
+namespace common {
+
+namespace net = boost::asio;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// CPU time consumed so far by the calling thread, 0 where unavailable
+uint64_t thread_cpu_ns() {
+#if defined(_WIN32)
+  FILETIME creation, exit, kernel, user;
+  if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) return 0;
+  auto ticks = [](const FILETIME& ft) { return (static_cast<uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime; };
+  return (ticks(kernel) + ticks(user)) * 100;  // 100 ns units
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+  timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) return 0;
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+#else
+  return 0;
+#endif
+}
+
+}  // namespace
+
+struct LoopMonitor::State {
+  struct ThreadEntry {
+    uint64_t cpu_ns = 0;
+    Clock::time_point sampled;
+    double utilization = 0.0;
+  };
+
+  explicit State(const LoopMonitorConfig& cfg) : config(cfg) {}
+
+  const LoopMonitorConfig config;
+  std::atomic<bool> running{false};
+  std::atomic<uint64_t> generation{0};  // Probes from an earlier start() stop themselves
+  PaddedCounter probes;
+  PaddedCounter lagging;
+  LatencyHistogram lag;
+  OnLag on_lag;
+
+  mutable std::mutex mutex;  // Guards threads and timer
+  std::unordered_map<std::thread::id, ThreadEntry> threads;
+  std::weak_ptr<net::steady_timer> timer;  // Owned by the pending probe handlers
+
+  void record(std::chrono::nanoseconds delay, Clock::time_point ran) {
+    probes.add(1);
+    lag.record(static_cast<uint64_t>(delay.count()));
+
+    uint64_t cpu = thread_cpu_ns();
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto& entry = threads[std::this_thread::get_id()];
+      if (entry.sampled != Clock::time_point{}) {
+        auto wall = std::chrono::duration_cast<std::chrono::nanoseconds>(ran - entry.sampled).count();
+        if (wall > 0) entry.utilization = static_cast<double>(cpu - entry.cpu_ns) / static_cast<double>(wall);
+      }
+      entry.cpu_ns = cpu;
+      entry.sampled = ran;
+    }
+
+    if (delay > config.lag_threshold) {
+      lagging.add(1);
+      if (on_lag) on_lag(delay);
+    }
+  }
+
+  bool current(uint64_t gen) const { return running.load() && generation.load() == gen; }
+
+  // Lag runs from the timer's expiry, so a handler that blocks the timer counts as well as queued work
+  static void probe(const std::shared_ptr<State>& state, const std::shared_ptr<net::steady_timer>& timer,
+                    uint64_t gen) {
+    auto due = timer->expiry();
+    net::post(timer->get_executor(), [state, timer, gen, due] {
+      if (!state->current(gen)) return;
+      auto ran = Clock::now();
+      state->record(std::chrono::duration_cast<std::chrono::nanoseconds>(ran - due), ran);
+      schedule(state, timer, gen);
+    });
+  }
+
+  static void schedule(const std::shared_ptr<State>& state, const std::shared_ptr<net::steady_timer>& timer,
+                       uint64_t gen) {
+    timer->expires_after(state->config.interval);
+    timer->async_wait([state, timer, gen](const boost::system::error_code& ec) {
+      if (ec || !state->current(gen)) return;
+      probe(state, timer, gen);
+    });
+  }
+};
+
+LoopMonitor::LoopMonitor(const LoopMonitorConfig& config) : state_(std::make_shared<State>(config)) {}
+
+LoopMonitor::~LoopMonitor() { stop(); }
+
+void LoopMonitor::start(net::io_context& ioc) {
+  if (state_->running.exchange(true)) return;
+  uint64_t gen = state_->generation.fetch_add(1) + 1;
+  auto timer = std::make_shared<net::steady_timer>(ioc);
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->timer = timer;
+  }
+  // Posting from the timer handler keeps a context that is not running yet out of the first sample
+  State::schedule(state_, timer, gen);
+}
+
+void LoopMonitor::stop() {
+  if (!state_->running.exchange(false)) return;
+  std::shared_ptr<net::steady_timer> timer;
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    timer = state_->timer.lock();
+  }
+  // A live timer means its handler, and with it the context, still exists
+  if (timer) {
+    net::post(timer->get_executor(), [weak = std::weak_ptr<net::steady_timer>(timer)] {
+      if (auto t = weak.lock()) t->cancel();
+    });
+  }
+}
+
+bool LoopMonitor::is_running() const { return state_->running.load(); }
+
+void LoopMonitor::on_lag(OnLag cb) { state_->on_lag = std::move(cb); }
+
+LoopMonitorSnapshot LoopMonitor::snapshot() const {
+  LoopMonitorSnapshot snap;
+  snap.probes = state_->probes.load();
+  snap.lagging = state_->lagging.load();
+  snap.lag_ns = state_->lag.snapshot();
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  snap.threads.reserve(state_->threads.size());
+  for (const auto& [id, entry] : state_->threads) {
+    snap.threads.push_back(ThreadCpuSample{id, entry.cpu_ns, entry.utilization});
+  }
+  return snap;
+}
+
+void LoopMonitor::reset() {
+  state_->probes.reset();
+  state_->lagging.reset();
+  state_->lag.reset();
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  state_->threads.clear();
+}
+
+}  // namespace common
+}  // namespace unilink
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <boost/asio.hpp>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "unilink/common/channel_metrics.hpp"
+
+namespace unilink {
+namespace common {
+
+/**
+ * @brief Loop monitor configuration
+ */
+struct LoopMonitorConfig {
+  std::chrono::milliseconds interval{100};       // Time between probes
+  std::chrono::milliseconds lag_threshold{50};  // on_lag fires for probes delayed longer than this
+};
+
+/**
+ * @brief CPU time of one thread that ran probes
+ */
+struct ThreadCpuSample {
+  std::thread::id thread;
+  uint64_t cpu_ns = 0;       // Total CPU time of the thread
+  double utilization = 0.0;  // CPU time / wall time between its last two probes
+};
+
+/**
+ * @brief Copy of a loop monitor's state at one point in time
+ */
+struct LoopMonitorSnapshot {
+  uint64_t probes = 0;
+  uint64_t lagging = 0;        // Probes that exceeded the lag threshold
+  HistogramSnapshot lag_ns;    // From a probe's due time to running it
+  std::vector<ThreadCpuSample> threads;
+};
+
+/**
+ * @brief Event-loop lag and I/O thread CPU monitor for an io_context
+ *
+ * Every interval a timer posts a probe handler to the context and measures
+ * how long after the timer's expiry it ran. The delay covers handlers that
+ * held up the timer and the ones queued ahead of the probe, so it rises
+ * before clients see timeouts. The thread that runs a probe also samples
+ * its own CPU time.
+ *
+ * High lag with utilization near 1.0 means the loop is CPU bound and more
+ * threads help; high lag with low utilization points at blocking handlers.
+ *
+ * The monitor is not tied to one context: start() binds it to a context
+ * and stop() releases it, so it can follow a channel across restarts while
+ * keeping its statistics. Probes hold their own state, so the monitor may be
+ * destroyed at any time and the context may be stopped or destroyed while it
+ * runs.
+ */
+class LoopMonitor {
+ public:
+  using OnLag = std::function<void(std::chrono::nanoseconds lag)>;
+
+  explicit LoopMonitor(const LoopMonitorConfig& config = LoopMonitorConfig{});
+  ~LoopMonitor();
+
+  LoopMonitor(const LoopMonitor&) = delete;
+  LoopMonitor& operator=(const LoopMonitor&) = delete;
+
+  // Begin probing ioc, first probe after one interval; no-op while running
+  void start(boost::asio::io_context& ioc);
+  void stop();
+  bool is_running() const;
+
+  // Called on the I/O thread for each probe above the lag threshold; set before start()
+  void on_lag(OnLag cb);
+
+  LoopMonitorSnapshot snapshot() const;
+  void reset();
+
+ private:
+  struct State;
+
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace common
+}  // namespace unilink
@@ -16,82 +16,315 @@
 
 #include "unilink/common/memory_tracker.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <sstream>
+#include <thread>
+#include <tuple>
 
 #include "unilink/common/logger.hpp"
 
 namespace unilink {
 namespace common {
 
+namespace {
+
+struct SiteEntry {
+  const char* file = "unknown";
+  int line = 0;
+  const char* function = "unknown";
+  std::atomic<size_t> total_bytes{0};
+  std::atomic<size_t> total_allocations{0};
+};
+
+struct SiteTable {
+  std::array<SiteEntry, MemoryTracker::MAX_SITES> entries;
+  std::atomic<uint32_t> count{1};  // Entry 0 is UNKNOWN_SITE
+  std::mutex mutex;
+  std::map<std::tuple<const char*, int, const char*>, AllocationSiteId> index;
+};
+
+SiteTable& site_table() {
+  static SiteTable table;
+  return table;
+}
+
+SiteEntry& site_entry(AllocationSiteId site) {
+  auto& table = site_table();
+  return table.entries[site < table.count.load(std::memory_order_acquire) ? site : MemoryTracker::UNKNOWN_SITE];
+}
+
+// Only this thread writes its counters, so a relaxed load/store pair replaces a locked add
+void bump(std::atomic<size_t>& counter, size_t value) {
+  counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+// Exponentially distributed distance with the given mean, so samples form a Poisson process over bytes
+int64_t next_sample_distance(uint64_t& rng, size_t interval) {
+  if (rng == 0) {
+    rng = std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1;
+  }
+  // xorshift64*
+  rng ^= rng >> 12;
+  rng ^= rng << 25;
+  rng ^= rng >> 27;
+  uint64_t bits = (rng * 0x2545F4914F6CDD1DULL) >> 11;
+  double u = (static_cast<double>(bits) + 1.0) / 9007199254740992.0;  // (0, 1]
+  double distance = -std::log(u) * static_cast<double>(interval);
+  return std::max<int64_t>(1, static_cast<int64_t>(distance));
+}
+
+void update_peak(std::atomic<size_t>& peak, size_t value) {
+  size_t current = peak.load(std::memory_order_relaxed);
+  while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+void subtract_clamped(std::atomic<size_t>& counter, size_t value) {
+  size_t current = counter.load(std::memory_order_relaxed);
+  while (!counter.compare_exchange_weak(current, current > value ? current - value : 0, std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace
+
 MemoryTracker& MemoryTracker::instance() {
   static MemoryTracker instance;
   return instance;
 }
 
-void MemoryTracker::track_allocation(void* ptr, size_t size, const char* file, int line, const char* function) {
-  if (!tracking_enabled_.load()) {
-    return;
+AllocationSiteId MemoryTracker::register_site(const char* file, int line, const char* function) {
+  auto& table = site_table();
+  std::lock_guard<std::mutex> lock(table.mutex);
+
+  auto key = std::make_tuple(file, line, function);
+  auto it = table.index.find(key);
+  if (it != table.index.end()) {
+    return it->second;
   }
 
-  std::lock_guard<std::mutex> lock(allocations_mutex_);
+  uint32_t id = table.count.load(std::memory_order_relaxed);
+  if (id >= MAX_SITES) {
+    return UNKNOWN_SITE;
+  }
+  table.entries[id].file = file ? file : "unknown";
+  table.entries[id].line = line;
+  table.entries[id].function = function ? function : "unknown";
+  table.count.store(id + 1, std::memory_order_release);
+  table.index.emplace(key, id);
+  return id;
+}
 
-  AllocationInfo info;
-  info.ptr = ptr;
-  info.size = size;
-  info.file = file ? file : "unknown";
-  info.line = line;
-  info.function = function ? function : "unknown";
-  info.timestamp = std::chrono::steady_clock::now();
+void MemoryTracker::track_allocation(void* ptr, size_t size, AllocationSiteId site) {
+  if (!tracking_enabled_.load(std::memory_order_relaxed)) {
+    return;
+  }
 
-  allocations_[ptr] = info;
+  auto& state = thread_state();
+  bump(state.allocations, 1);
+  bump(state.bytes, size);
 
-  // Update statistics
-  stats_.total_allocations++;
-  stats_.current_allocations++;
-  stats_.total_bytes_allocated += size;
-  stats_.current_bytes_allocated += size;
+  if (should_sample(state, size)) {
+    record_sample(ptr, size, site);
+  }
+}
 
-  // Update peak values
-  if (stats_.current_allocations > stats_.peak_allocations) {
-    stats_.peak_allocations = stats_.current_allocations;
+void MemoryTracker::track_allocation(void* ptr, size_t size, const char* file, int line, const char* function) {
+  if (!tracking_enabled_.load(std::memory_order_relaxed)) {
+    return;
   }
-  if (stats_.current_bytes_allocated > stats_.peak_bytes_allocated) {
-    stats_.peak_bytes_allocated = stats_.current_bytes_allocated;
+
+  auto& state = thread_state();
+  bump(state.allocations, 1);
+  bump(state.bytes, size);
+
+  // The site is only interned when the allocation is actually sampled
+  if (should_sample(state, size)) {
+    record_sample(ptr, size, register_site(file, line, function));
   }
 }
 
 void MemoryTracker::track_deallocation(void* ptr) {
-  if (!tracking_enabled_.load()) {
+  if (!tracking_enabled_.load(std::memory_order_relaxed)) {
     return;
   }
 
-  std::lock_guard<std::mutex> lock(allocations_mutex_);
+  bump(thread_state().deallocations, 1);
 
-  auto it = allocations_.find(ptr);
-  if (it != allocations_.end()) {
-    size_t size = it->second.size;
-    allocations_.erase(it);
+  auto& shard = shard_for(ptr);
+  if (shard.sample_count.load(std::memory_order_relaxed) == 0) {
+    return;
+  }
 
-    // Update statistics
-    stats_.total_deallocations++;
-    stats_.current_allocations--;
-    stats_.total_bytes_deallocated += size;
-    stats_.current_bytes_allocated -= size;
+  Sample sample{};
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.samples.find(ptr);
+    if (it == shard.samples.end()) {
+      return;
+    }
+    sample = it->second;
+    shard.samples.erase(it);
+    shard.sample_count.fetch_sub(1, std::memory_order_relaxed);
   }
+
+  subtract_clamped(live_bytes_, sample.estimated_bytes);
+  subtract_clamped(live_allocations_, sample.estimated_count);
+}
+
+void MemoryTracker::set_sample_interval(size_t bytes) {
+  sample_interval_.store(std::max<size_t>(bytes, 1));
+  interval_epoch_.fetch_add(1);
 }
 
-MemoryTracker::MemoryStats MemoryTracker::get_stats() const { return stats_; }
+size_t MemoryTracker::get_sample_interval() const { return sample_interval_.load(); }
 
-std::vector<MemoryTracker::AllocationInfo> MemoryTracker::get_current_allocations() const {
-  std::lock_guard<std::mutex> lock(allocations_mutex_);
+bool MemoryTracker::should_sample(ThreadState& state, size_t size) {
+  size_t interval = sample_interval_.load(std::memory_order_relaxed);
+  if (interval <= 1) {
+    return true;
+  }
+
+  uint32_t epoch = interval_epoch_.load(std::memory_order_relaxed);
+  if (state.epoch != epoch) {
+    state.epoch = epoch;
+    state.bytes_until_sample = next_sample_distance(state.rng, interval);
+  }
+
+  state.bytes_until_sample -= static_cast<int64_t>(size);
+  if (state.bytes_until_sample > 0) {
+    return false;
+  }
+  state.bytes_until_sample = next_sample_distance(state.rng, interval);
+  return true;
+}
+
+void MemoryTracker::record_sample(void* ptr, size_t size, AllocationSiteId site) {
+  size_t interval = sample_interval_.load(std::memory_order_relaxed);
+
+  // An allocation of size s is sampled with probability 1 - exp(-s / interval); weight by the inverse
+  double probability = interval <= 1 ? 1.0 : -std::expm1(-static_cast<double>(size) / static_cast<double>(interval));
+  probability = std::max(probability, 1e-12);
+  Sample sample{site, size, static_cast<size_t>(static_cast<double>(size) / probability + 0.5),
+                std::max<size_t>(1, static_cast<size_t>(1.0 / probability + 0.5)), std::chrono::steady_clock::now()};
+
+  auto& shard = shard_for(ptr);
+  Sample replaced{};
+  bool had_previous = false;
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto result = shard.samples.emplace(ptr, sample);
+    if (!result.second) {
+      replaced = result.first->second;  // Freed without tracking; drop the stale sample
+      result.first->second = sample;
+      had_previous = true;
+    } else {
+      shard.sample_count.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
 
+  if (had_previous) {
+    subtract_clamped(live_bytes_, replaced.estimated_bytes);
+    subtract_clamped(live_allocations_, replaced.estimated_count);
+  }
+  update_peak(peak_bytes_, live_bytes_.fetch_add(sample.estimated_bytes, std::memory_order_relaxed) +
+                               sample.estimated_bytes);
+  update_peak(peak_allocations_, live_allocations_.fetch_add(sample.estimated_count, std::memory_order_relaxed) +
+                                     sample.estimated_count);
+  sampled_total_.fetch_add(1, std::memory_order_relaxed);
+
+  auto& entry = site_entry(site);
+  entry.total_bytes.fetch_add(sample.estimated_bytes, std::memory_order_relaxed);
+  entry.total_allocations.fetch_add(sample.estimated_count, std::memory_order_relaxed);
+}
+
+MemoryTracker::Shard& MemoryTracker::shard_for(const void* ptr) {
+  auto bits = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ptr) >> 4);
+  return shards_[(bits * 0x9E3779B97F4A7C15ULL) >> 60];
+}
+
+MemoryTracker::ThreadState& MemoryTracker::thread_state() {
+  // Trivial thread_local for the fast path; the handle with a destructor is only touched once per thread
+  thread_local ThreadState* cached = nullptr;
+  if (cached) {
+    return *cached;
+  }
+
+  struct Handle {
+    ThreadState* state = nullptr;
+    ~Handle() {
+      if (state) state->in_use.store(false);
+    }
+  };
+  thread_local Handle handle;
+
+  std::lock_guard<std::mutex> lock(counters_mutex_);
+  for (auto& state : thread_states_) {
+    if (!state->in_use.load()) {
+      state->in_use.store(true);
+      handle.state = state.get();
+      break;
+    }
+  }
+  if (!handle.state) {
+    thread_states_.push_back(std::make_unique<ThreadState>());
+    handle.state = thread_states_.back().get();
+  }
+  cached = handle.state;
+  return *cached;
+}
+
+MemoryTracker::Totals MemoryTracker::sum_counters() const {
+  Totals totals;
+  for (const auto& state : thread_states_) {
+    totals.allocations += state->allocations.load(std::memory_order_relaxed);
+    totals.bytes += state->bytes.load(std::memory_order_relaxed);
+    totals.deallocations += state->deallocations.load(std::memory_order_relaxed);
+  }
+  return totals;
+}
+
+MemoryTracker::MemoryStats MemoryTracker::get_stats() const {
+  MemoryStats stats;
+  {
+    std::lock_guard<std::mutex> lock(counters_mutex_);
+    Totals totals = sum_counters();
+    stats.total_allocations = totals.allocations - cleared_totals_.allocations;
+    stats.total_bytes_allocated = totals.bytes - cleared_totals_.bytes;
+    stats.total_deallocations = totals.deallocations - cleared_totals_.deallocations;
+  }
+  stats.current_allocations = live_allocations_.load(std::memory_order_relaxed);
+  stats.current_bytes_allocated = live_bytes_.load(std::memory_order_relaxed);
+  stats.peak_allocations = peak_allocations_.load(std::memory_order_relaxed);
+  stats.peak_bytes_allocated = peak_bytes_.load(std::memory_order_relaxed);
+  stats.total_bytes_deallocated = stats.total_bytes_allocated -
+                                  std::min(stats.current_bytes_allocated, stats.total_bytes_allocated);
+  stats.sampled_allocations = sampled_total_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+std::vector<MemoryTracker::AllocationInfo> MemoryTracker::get_current_allocations() const {
   std::vector<AllocationInfo> result;
-  result.reserve(allocations_.size());
 
-  for (const auto& pair : allocations_) {
-    result.push_back(pair.second);
+  for (const auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    for (const auto& pair : shard.samples) {
+      const auto& entry = site_entry(pair.second.site);
+      AllocationInfo info;
+      info.ptr = pair.first;
+      info.size = pair.second.size;
+      info.file = entry.file;
+      info.line = entry.line;
+      info.timestamp = pair.second.timestamp;
+      info.function = entry.function;
+      info.site = pair.second.site;
+      info.estimated_bytes = pair.second.estimated_bytes;
+      result.push_back(std::move(info));
+    }
   }
 
   return result;
@@ -101,6 +334,74 @@ std::vector<MemoryTracker::AllocationInfo> MemoryTracker::get_leaked_allocations
   return get_current_allocations();  // Current allocations are potential leaks
 }
 
+MemoryTracker::HeapSnapshot MemoryTracker::take_heap_snapshot() const {
+  HeapSnapshot snapshot;
+  snapshot.timestamp = std::chrono::system_clock::now();
+  snapshot.sample_interval = get_sample_interval();
+
+  auto& table = site_table();
+  uint32_t site_count = table.count.load(std::memory_order_acquire);
+  std::vector<SiteUsage> usage(site_count);
+  for (uint32_t id = 0; id < site_count; ++id) {
+    usage[id].site = id;
+    usage[id].total_bytes = table.entries[id].total_bytes.load(std::memory_order_relaxed);
+    usage[id].total_allocations = table.entries[id].total_allocations.load(std::memory_order_relaxed);
+  }
+
+  for (const auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    for (const auto& pair : shard.samples) {
+      auto& site = usage[pair.second.site < site_count ? pair.second.site : UNKNOWN_SITE];
+      site.live_bytes += pair.second.estimated_bytes;
+      site.live_allocations += pair.second.estimated_count;
+    }
+  }
+
+  for (auto& site : usage) {
+    if (site.total_allocations == 0 && site.live_allocations == 0) {
+      continue;
+    }
+    const auto& entry = table.entries[site.site];
+    site.file = entry.file;
+    site.line = entry.line;
+    site.function = entry.function;
+    snapshot.live_bytes += site.live_bytes;
+    snapshot.live_allocations += site.live_allocations;
+    snapshot.sites.push_back(std::move(site));
+  }
+
+  std::sort(snapshot.sites.begin(), snapshot.sites.end(),
+            [](const SiteUsage& a, const SiteUsage& b) { return a.live_bytes > b.live_bytes; });
+  return snapshot;
+}
+
+std::vector<MemoryTracker::SiteUsage> MemoryTracker::get_top_allocation_sites(size_t count, bool by_live_bytes) const {
+  auto sites = take_heap_snapshot().sites;
+  if (!by_live_bytes) {
+    std::sort(sites.begin(), sites.end(),
+              [](const SiteUsage& a, const SiteUsage& b) { return a.total_bytes > b.total_bytes; });
+  }
+  if (sites.size() > count) {
+    sites.resize(count);
+  }
+  return sites;
+}
+
+std::string MemoryTracker::export_heap_snapshot() const {
+  auto snapshot = take_heap_snapshot();
+
+  std::ostringstream oss;
+  oss << "# unilink heap profile\n";
+  oss << "# sample_interval: " << snapshot.sample_interval << "\n";
+  oss << "# live_bytes: " << snapshot.live_bytes << " live_allocations: " << snapshot.live_allocations << "\n";
+  oss << "# live_bytes live_allocations total_bytes total_allocations site\n";
+  for (const auto& site : snapshot.sites) {
+    oss << site.live_bytes << " " << site.live_allocations << " " << site.total_bytes << " " << site.total_allocations
+        << " " << site.file << ":" << site.line << " " << site.function << "\n";
+  }
+  return oss.str();
+}
+
 void MemoryTracker::enable_tracking(bool enable) { tracking_enabled_.store(enable); }
 
 void MemoryTracker::disable_tracking() { tracking_enabled_.store(false); }
@@ -108,40 +409,53 @@ void MemoryTracker::disable_tracking() { tracking_enabled_.store(false); }
 bool MemoryTracker::is_tracking_enabled() const { return tracking_enabled_.load(); }
 
 void MemoryTracker::clear_tracking_data() {
-  std::lock_guard<std::mutex> lock(allocations_mutex_);
-  allocations_.clear();
+  for (auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.samples.clear();
+    shard.sample_count.store(0);
+  }
+
+  // Counters are only written by their own thread, so clearing records a baseline instead
+  {
+    std::lock_guard<std::mutex> lock(counters_mutex_);
+    cleared_totals_ = sum_counters();
+  }
 
   // Reset statistics
-  stats_.total_allocations = 0;
-  stats_.total_deallocations = 0;
-  stats_.current_allocations = 0;
-  stats_.peak_allocations = 0;
-  stats_.total_bytes_allocated = 0;
-  stats_.total_bytes_deallocated = 0;
-  stats_.current_bytes_allocated = 0;
-  stats_.peak_bytes_allocated = 0;
+  live_bytes_.store(0);
+  live_allocations_.store(0);
+  peak_bytes_.store(0);
+  peak_allocations_.store(0);
+  sampled_total_.store(0);
+
+  auto& table = site_table();
+  for (auto& entry : table.entries) {
+    entry.total_bytes.store(0);
+    entry.total_allocations.store(0);
+  }
 }
 
 void MemoryTracker::print_memory_report() const {
   auto stats = get_stats();
-  auto current_allocations = get_current_allocations();
+  auto top_sites = get_top_allocation_sites(10);
 
   std::cout << "\n=== Memory Tracker Report ===" << std::endl;
+  std::cout << "Sample interval: " << get_sample_interval() << " bytes" << std::endl;
   std::cout << "Total allocations: " << stats.total_allocations << std::endl;
   std::cout << "Total deallocations: " << stats.total_deallocations << std::endl;
-  std::cout << "Current allocations: " << stats.current_allocations << std::endl;
-  std::cout << "Peak allocations: " << stats.peak_allocations << std::endl;
+  std::cout << "Current allocations (est.): " << stats.current_allocations << std::endl;
+  std::cout << "Peak allocations (est.): " << stats.peak_allocations << std::endl;
   std::cout << "Total bytes allocated: " << stats.total_bytes_allocated << std::endl;
-  std::cout << "Total bytes deallocated: " << stats.total_bytes_deallocated << std::endl;
-  std::cout << "Current bytes allocated: " << stats.current_bytes_allocated << std::endl;
-  std::cout << "Peak bytes allocated: " << stats.peak_bytes_allocated << std::endl;
-  std::cout << "Current active allocations: " << current_allocations.size() << std::endl;
-
-  if (!current_allocations.empty()) {
-    std::cout << "\n=== Current Allocations ===" << std::endl;
-    for (const auto& alloc : current_allocations) {
-      std::cout << "Ptr: " << alloc.ptr << ", Size: " << alloc.size << ", File: " << alloc.file << ":" << alloc.line
-                << ", Function: " << alloc.function << std::endl;
+  std::cout << "Current bytes allocated (est.): " << stats.current_bytes_allocated << std::endl;
+  std::cout << "Peak bytes allocated (est.): " << stats.peak_bytes_allocated << std::endl;
+  std::cout << "Sampled allocations: " << stats.sampled_allocations << std::endl;
+
+  if (!top_sites.empty()) {
+    std::cout << "\n=== Top Allocation Sites (live bytes) ===" << std::endl;
+    for (const auto& site : top_sites) {
+      std::cout << "Live: " << site.live_bytes << " bytes in " << site.live_allocations
+                << " allocations, Total: " << site.total_bytes << " bytes, Site: " << site.file << ":" << site.line
+                << " (" << site.function << ")" << std::endl;
     }
   }
 }
@@ -155,44 +469,45 @@ void MemoryTracker::print_leak_report() const {
   }
 
   std::cout << "\n=== Memory Leak Report ===" << std::endl;
-  std::cout << "Found " << leaked_allocations.size() << " potential memory leaks:" << std::endl;
+  std::cout << "Found " << leaked_allocations.size() << " sampled live allocations:" << std::endl;
 
   size_t total_leaked_bytes = 0;
   for (const auto& alloc : leaked_allocations) {
     std::cout << "Leaked: " << alloc.size << " bytes at " << alloc.ptr << " allocated in " << alloc.file << ":"
               << alloc.line << " (" << alloc.function << ")" << std::endl;
-    total_leaked_bytes += alloc.size;
+    total_leaked_bytes += alloc.estimated_bytes;
   }
 
-  std::cout << "Total leaked bytes: " << total_leaked_bytes << std::endl;
+  std::cout << "Estimated leaked bytes: " << total_leaked_bytes << std::endl;
 }
 
 void MemoryTracker::log_memory_report() const {
   auto stats = get_stats();
-  auto current_allocations = get_current_allocations();
+  auto top_sites = get_top_allocation_sites(10);
 
   std::ostringstream oss;
   oss << "\n=== Memory Tracker Report ===\n";
+  oss << "Sample interval: " << get_sample_interval() << " bytes\n";
   oss << "Total allocations: " << stats.total_allocations << "\n";
   oss << "Total deallocations: " << stats.total_deallocations << "\n";
-  oss << "Current allocations: " << stats.current_allocations << "\n";
-  oss << "Peak allocations: " << stats.peak_allocations << "\n";
+  oss << "Current allocations (est.): " << stats.current_allocations << "\n";
+  oss << "Peak allocations (est.): " << stats.peak_allocations << "\n";
   oss << "Total bytes allocated: " << stats.total_bytes_allocated << "\n";
-  oss << "Total bytes deallocated: " << stats.total_bytes_deallocated << "\n";
-  oss << "Current bytes allocated: " << stats.current_bytes_allocated << "\n";
-  oss << "Peak bytes allocated: " << stats.peak_bytes_allocated << "\n";
-  oss << "Current active allocations: " << current_allocations.size();
+  oss << "Current bytes allocated (est.): " << stats.current_bytes_allocated << "\n";
+  oss << "Peak bytes allocated (est.): " << stats.peak_bytes_allocated << "\n";
+  oss << "Sampled allocations: " << stats.sampled_allocations;
 
   UNILINK_LOG_INFO("memory_tracker", "report", oss.str());
 
-  if (!current_allocations.empty()) {
-    std::ostringstream alloc_oss;
-    alloc_oss << "\n=== Current Allocations ===\n";
-    for (const auto& alloc : current_allocations) {
-      alloc_oss << "Ptr: " << alloc.ptr << ", Size: " << alloc.size << ", File: " << alloc.file << ":" << alloc.line
-                << ", Function: " << alloc.function << "\n";
+  if (!top_sites.empty()) {
+    std::ostringstream site_oss;
+    site_oss << "\n=== Top Allocation Sites (live bytes) ===\n";
+    for (const auto& site : top_sites) {
+      site_oss << "Live: " << site.live_bytes << " bytes in " << site.live_allocations
+               << " allocations, Total: " << site.total_bytes << " bytes, Site: " << site.file << ":" << site.line
+               << " (" << site.function << ")\n";
     }
-    UNILINK_LOG_INFO("memory_tracker", "allocations", alloc_oss.str());
+    UNILINK_LOG_INFO("memory_tracker", "allocations", site_oss.str());
   }
 }
 
@@ -206,29 +521,29 @@ void MemoryTracker::log_leak_report() const {
 
   std::ostringstream oss;
   oss << "\n=== Memory Leak Report ===\n";
-  oss << "Found " << leaked_allocations.size() << " potential memory leaks:\n";
+  oss << "Found " << leaked_allocations.size() << " sampled live allocations:\n";
 
   size_t total_leaked_bytes = 0;
   for (const auto& alloc : leaked_allocations) {
     oss << "Leaked: " << alloc.size << " bytes at " << alloc.ptr << " allocated in " << alloc.file << ":" << alloc.line
         << " (" << alloc.function << ")\n";
-    total_leaked_bytes += alloc.size;
+    total_leaked_bytes += alloc.estimated_bytes;
   }
 
-  oss << "Total leaked bytes: " << total_leaked_bytes;
+  oss << "Estimated leaked bytes: " << total_leaked_bytes;
   UNILINK_LOG_ERROR("memory_tracker", "leak_check", oss.str());
 }
 
 // ScopedMemoryTracker implementation
 ScopedMemoryTracker::ScopedMemoryTracker(const char* file, int line, const char* function)
-    : file_(file), line_(line), function_(function) {}
+    : site_(MemoryTracker::register_site(file, line, function)) {}
 
 ScopedMemoryTracker::~ScopedMemoryTracker() {
   // Destructor can be used for cleanup if needed
 }
 
 void ScopedMemoryTracker::track_allocation(void* ptr, size_t size) {
-  MemoryTracker::instance().track_allocation(ptr, size, file_, line_, function_);
+  MemoryTracker::instance().track_allocation(ptr, size, site_);
 }
 
 void ScopedMemoryTracker::track_deallocation(void* ptr) { MemoryTracker::instance().track_deallocation(ptr); }
@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -28,13 +30,29 @@ namespace unilink {
 namespace common {
 
 /**
- * @brief Memory allocation tracker for debugging and monitoring
+ * @brief Compact identifier of an allocation call site
+ */
+using AllocationSiteId = uint32_t;
+
+/**
+ * @brief Sampling allocation profiler
+ *
+ * Records roughly one allocation per sample_interval bytes (Poisson sampling,
+ * as in tcmalloc's heap profiler) tagged with a compact call-site ID. Sampled
+ * allocations are weighted so that heap snapshots and per-site totals are
+ * unbiased estimates of the real heap. An unsampled allocation only updates
+ * thread-local counters (no locked instructions), so tracking can stay
+ * enabled in production.
  *
- * Tracks memory allocations and deallocations to detect leaks,
- * monitor usage patterns, and provide debugging information.
+ * Live samples are kept in pointer-sharded tables, so threads only contend
+ * when they sample or free into the same shard.
  */
 class MemoryTracker {
  public:
+  static constexpr size_t DEFAULT_SAMPLE_INTERVAL = 256 * 1024;  // Bytes between samples (mean)
+  static constexpr size_t MAX_SITES = 4096;
+  static constexpr AllocationSiteId UNKNOWN_SITE = 0;
+
   struct AllocationInfo {
     void* ptr;
     size_t size;
@@ -42,8 +60,16 @@ class MemoryTracker {
     int line;
     std::chrono::steady_clock::time_point timestamp;
     std::string function;
+    AllocationSiteId site = UNKNOWN_SITE;
+    size_t estimated_bytes = 0;  // Bytes this sample stands for
   };
 
+  /**
+   * @brief Allocation counters
+   *
+   * Totals are exact; current and peak values are estimated from samples
+   * (exact when the sample interval is 1).
+   */
   struct MemoryStats {
     size_t total_allocations{0};
     size_t total_deallocations{0};
@@ -53,20 +79,64 @@ class MemoryTracker {
     size_t total_bytes_deallocated{0};
     size_t current_bytes_allocated{0};
     size_t peak_bytes_allocated{0};
+    size_t sampled_allocations{0};
+  };
+
+  /**
+   * @brief Estimated usage of one call site
+   */
+  struct SiteUsage {
+    AllocationSiteId site = UNKNOWN_SITE;
+    std::string file;
+    int line = 0;
+    std::string function;
+    size_t live_bytes = 0;        // Estimated bytes still allocated
+    size_t live_allocations = 0;  // Estimated allocations still live
+    size_t total_bytes = 0;       // Estimated bytes allocated since the last clear
+    size_t total_allocations = 0;  // Estimated allocations since the last clear
+  };
+
+  /**
+   * @brief Point-in-time view of the sampled heap, sites ordered by live bytes
+   */
+  struct HeapSnapshot {
+    std::chrono::system_clock::time_point timestamp;
+    size_t sample_interval = 0;
+    size_t live_bytes = 0;
+    size_t live_allocations = 0;
+    std::vector<SiteUsage> sites;
   };
 
   // Singleton access
   static MemoryTracker& instance();
 
+  /**
+   * @brief Intern a call site (normally once per site via MEMORY_TRACK_ALLOCATION)
+   *
+   * @p file and @p function must outlive the tracker (string literals). Sites
+   * beyond MAX_SITES share UNKNOWN_SITE.
+   */
+  static AllocationSiteId register_site(const char* file, int line, const char* function);
+
   // Tracking methods
+  void track_allocation(void* ptr, size_t size, AllocationSiteId site);
   void track_allocation(void* ptr, size_t size, const char* file, int line, const char* function);
   void track_deallocation(void* ptr);
 
+  // Sampling
+  void set_sample_interval(size_t bytes);  // 1 records every allocation
+  size_t get_sample_interval() const;
+
   // Statistics
   MemoryStats get_stats() const;
   std::vector<AllocationInfo> get_current_allocations() const;
   std::vector<AllocationInfo> get_leaked_allocations() const;
 
+  // Heap profiles
+  HeapSnapshot take_heap_snapshot() const;
+  std::vector<SiteUsage> get_top_allocation_sites(size_t count = 10, bool by_live_bytes = true) const;
+  std::string export_heap_snapshot() const;
+
   // Control
   void enable_tracking(bool enable = true);
   void disable_tracking();
@@ -90,10 +160,61 @@ class MemoryTracker {
   MemoryTracker(const MemoryTracker&) = delete;
   MemoryTracker& operator=(const MemoryTracker&) = delete;
 
-  mutable std::mutex allocations_mutex_;
-  std::unordered_map<void*, AllocationInfo> allocations_;
-  MemoryStats stats_;
+  static constexpr size_t SHARD_COUNT = 16;
+
+  struct Sample {
+    AllocationSiteId site;
+    size_t size;
+    size_t estimated_bytes;
+    size_t estimated_count;
+    std::chrono::steady_clock::time_point timestamp;
+  };
+
+  // Live samples, sharded by pointer
+  struct alignas(64) Shard {
+    mutable std::mutex mutex;
+    std::unordered_map<void*, Sample> samples;
+    std::atomic<size_t> sample_count{0};
+  };
+
+  // Per-thread exact counters and sampling state, written only by the owning thread;
+  // blocks are reused after their thread exits
+  struct alignas(64) ThreadState {
+    std::atomic<size_t> allocations{0};
+    std::atomic<size_t> bytes{0};
+    std::atomic<size_t> deallocations{0};
+    std::atomic<bool> in_use{true};
+    int64_t bytes_until_sample = 0;
+    uint32_t epoch = UINT32_MAX;  // Sampling interval epoch the countdown was drawn for
+    uint64_t rng = 0;
+  };
+
+  struct Totals {
+    size_t allocations = 0;
+    size_t bytes = 0;
+    size_t deallocations = 0;
+  };
+
+  std::array<Shard, SHARD_COUNT> shards_;
+  mutable std::mutex counters_mutex_;
+  std::vector<std::unique_ptr<ThreadState>> thread_states_;
+  Totals cleared_totals_;  // Counter values at the last clear (guarded by counters_mutex_)
   std::atomic<bool> tracking_enabled_{true};
+  std::atomic<size_t> sample_interval_{DEFAULT_SAMPLE_INTERVAL};
+  std::atomic<uint32_t> interval_epoch_{0};  // Bumped so threads redraw their sampling distance
+
+  // Estimated live totals, updated on the sampled path only
+  std::atomic<size_t> live_bytes_{0};
+  std::atomic<size_t> live_allocations_{0};
+  std::atomic<size_t> peak_bytes_{0};
+  std::atomic<size_t> peak_allocations_{0};
+  std::atomic<size_t> sampled_total_{0};
+
+  bool should_sample(ThreadState& state, size_t size);
+  void record_sample(void* ptr, size_t size, AllocationSiteId site);
+  Shard& shard_for(const void* ptr);
+  ThreadState& thread_state();
+  Totals sum_counters() const;
 };
 
 /**
@@ -108,18 +229,20 @@ class ScopedMemoryTracker {
   void track_deallocation(void* ptr);
 
  private:
-  const char* file_;
-  int line_;
-  const char* function_;
+  AllocationSiteId site_;
 };
 
 }  // namespace common
 }  // namespace unilink
 
-// Convenience macros for automatic tracking
+// Convenience macros for automatic tracking; each call site is interned once
 #ifdef UNILINK_ENABLE_MEMORY_TRACKING
-#define MEMORY_TRACK_ALLOCATION(ptr, size) \
-  unilink::common::MemoryTracker::instance().track_allocation(ptr, size, __FILE__, __LINE__, __FUNCTION__)
+#define MEMORY_TRACK_ALLOCATION(ptr, size)                                                                     \
+  do {                                                                                                         \
+    static const ::unilink::common::AllocationSiteId unilink_alloc_site_ =                                     \
+        ::unilink::common::MemoryTracker::register_site(__FILE__, __LINE__, __FUNCTION__);                     \
+    ::unilink::common::MemoryTracker::instance().track_allocation(ptr, size, unilink_alloc_site_);             \
+  } while (0)
 
 #define MEMORY_TRACK_DEALLOCATION(ptr) unilink::common::MemoryTracker::instance().track_deallocation(ptr)
 
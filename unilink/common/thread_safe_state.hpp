@@ -21,8 +21,10 @@
 #include <chrono>
 #include <condition_variable>
 #include <functional>
+#include <iterator>
 #include <mutex>
 #include <shared_mutex>
+#include <type_traits>
 #include <vector>
 
 #include "unilink/common/common.hpp"
@@ -37,7 +39,7 @@ namespace common {
  * Multiple readers can access the state simultaneously, but only one writer
  * can modify the state at a time.
  */
-template <typename StateType>
+template <typename StateType, typename Enable = void>
 class ThreadSafeState {
  public:
   using State = StateType;
@@ -85,6 +87,65 @@ class ThreadSafeState {
   void notify_callbacks(const State& new_state);
 };
 
+/**
+ * @brief Lock-free specialization for enum states
+ *
+ * Reads are a single atomic load. A write is an atomic store, and only takes
+ * the slow path (callbacks and condition variable) while callbacks are
+ * registered or a thread is waiting, so the common unobserved case never
+ * locks. The interface matches the generic template.
+ */
+template <typename StateType>
+class ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>> {
+ public:
+  using State = StateType;
+  using StateCallback = std::function<void(const State&)>;
+
+  // Constructors
+  explicit ThreadSafeState(const State& initial_state = State{});
+  ThreadSafeState(const ThreadSafeState&) = delete;
+  ThreadSafeState& operator=(const ThreadSafeState&) = delete;
+  ThreadSafeState(ThreadSafeState&&) = delete;
+  ThreadSafeState& operator=(ThreadSafeState&&) = delete;
+
+  // State access methods
+  State get_state() const noexcept;
+  void set_state(const State& new_state);
+
+  // Atomic state operations
+  bool compare_and_set(const State& expected, const State& desired);
+  State exchange(const State& new_state);
+
+  // State change notifications
+  void add_state_change_callback(StateCallback callback);
+  void remove_state_change_callback(StateCallback callback);
+  void clear_state_change_callbacks();
+
+  // Wait for state change
+  void wait_for_state(const State& expected_state, std::chrono::milliseconds timeout = std::chrono::milliseconds(1000));
+  void wait_for_state_change(std::chrono::milliseconds timeout = std::chrono::milliseconds(1000));
+
+  // Utility methods
+  bool is_state(const State& expected_state) const noexcept;
+  void notify_state_change();
+
+ private:
+  std::atomic<State> state_;
+  std::atomic<bool> state_changed_{false};
+
+  // Registered callbacks plus waiting threads; writers skip notification while zero
+  std::atomic<uint32_t> observers_{0};
+
+  std::vector<StateCallback> callbacks_;
+  mutable std::mutex callbacks_mutex_;
+
+  std::mutex wait_mutex_;
+  std::condition_variable state_cv_;
+
+  void on_state_written(const State& new_state);
+  void notify_callbacks(const State& new_state);
+};
+
 /**
  * @brief Thread-safe atomic state wrapper
  *
@@ -161,17 +222,17 @@ using ThreadSafeLinkState = ThreadSafeState<LinkState>;
 using AtomicLinkState = AtomicState<LinkState>;
 
 // Template implementations (must be in header for template instantiation)
-template <typename StateType>
-ThreadSafeState<StateType>::ThreadSafeState(const State& initial_state) : state_(initial_state) {}
+template <typename StateType, typename Enable>
+ThreadSafeState<StateType, Enable>::ThreadSafeState(const State& initial_state) : state_(initial_state) {}
 
-template <typename StateType>
-StateType ThreadSafeState<StateType>::get_state() const {
+template <typename StateType, typename Enable>
+StateType ThreadSafeState<StateType, Enable>::get_state() const {
   std::shared_lock<std::shared_mutex> lock(state_mutex_);
   return state_;
 }
 
-template <typename StateType>
-void ThreadSafeState<StateType>::set_state(const State& new_state) {
+template <typename StateType, typename Enable>
+void ThreadSafeState<StateType, Enable>::set_state(const State& new_state) {
   {
     std::unique_lock<std::shared_mutex> lock(state_mutex_);
     state_ = new_state;
@@ -181,8 +242,8 @@ void ThreadSafeState<StateType>::set_state(const State& new_state) {
   state_cv_.notify_all();
 }
 
-template <typename StateType>
-void ThreadSafeState<StateType>::set_state(State&& new_state) {
+template <typename StateType, typename Enable>
+void ThreadSafeState<StateType, Enable>::set_state(State&& new_state) {
   {
     std::unique_lock<std::shared_mutex> lock(state_mutex_);
     state_ = std::move(new_state);
@@ -192,8 +253,8 @@ void ThreadSafeState<StateType>::set_state(State&& new_state) {
   state_cv_.notify_all();
 }
 
-template <typename StateType>
-bool ThreadSafeState<StateType>::compare_and_set(const State& expected, const State& desired) {
+template <typename StateType, typename Enable>
+bool ThreadSafeState<StateType, Enable>::compare_and_set(const State& expected, const State& desired) {
   std::unique_lock<std::shared_mutex> lock(state_mutex_);
   if (state_ == expected) {
     state_ = desired;
@@ -206,8 +267,8 @@ bool ThreadSafeState<StateType>::compare_and_set(const State& expected, const St
   return false;
 }
 
-template <typename StateType>
-StateType ThreadSafeState<StateType>::exchange(const State& new_state) {
+template <typename StateType, typename Enable>
+StateType ThreadSafeState<StateType, Enable>::exchange(const State& new_state) {
   State old_state;
   {
     std::unique_lock<std::shared_mutex> lock(state_mutex_);
@@ -220,50 +281,173 @@ StateType ThreadSafeState<StateType>::exchange(const State& new_state) {
   return old_state;
 }
 
-template <typename StateType>
-void ThreadSafeState<StateType>::add_state_change_callback(StateCallback callback) {
+template <typename StateType, typename Enable>
+void ThreadSafeState<StateType, Enable>::add_state_change_callback(StateCallback callback) {
   std::lock_guard<std::mutex> lock(callbacks_mutex_);
   callbacks_.push_back(callback);
 }
 
-template <typename StateType>
-void ThreadSafeState<StateType>::remove_state_change_callback(StateCallback callback) {
+template <typename StateType, typename Enable>
+void ThreadSafeState<StateType, Enable>::remove_state_change_callback(StateCallback callback) {
   std::lock_guard<std::mutex> lock(callbacks_mutex_);
   callbacks_.erase(std::remove(callbacks_.begin(), callbacks_.end(), callback), callbacks_.end());
 }
 
-template <typename StateType>
-void ThreadSafeState<StateType>::clear_state_change_callbacks() {
+template <typename StateType, typename Enable>
+void ThreadSafeState<StateType, Enable>::clear_state_change_callbacks() {
   std::lock_guard<std::mutex> lock(callbacks_mutex_);
   callbacks_.clear();
 }
 
-template <typename StateType>
-void ThreadSafeState<StateType>::wait_for_state(const State& expected_state, std::chrono::milliseconds timeout) {
+template <typename StateType, typename Enable>
+void ThreadSafeState<StateType, Enable>::wait_for_state(const State& expected_state,
+                                                         std::chrono::milliseconds timeout) {
   std::unique_lock<std::shared_mutex> lock(state_mutex_);
   state_cv_.wait_for(lock, timeout, [this, &expected_state] { return state_ == expected_state; });
 }
 
-template <typename StateType>
-void ThreadSafeState<StateType>::wait_for_state_change(std::chrono::milliseconds timeout) {
+template <typename StateType, typename Enable>
+void ThreadSafeState<StateType, Enable>::wait_for_state_change(std::chrono::milliseconds timeout) {
   std::unique_lock<std::shared_mutex> lock(state_mutex_);
   state_cv_.wait_for(lock, timeout, [this] { return state_changed_.load(); });
   state_changed_.store(false);
 }
 
-template <typename StateType>
-bool ThreadSafeState<StateType>::is_state(const State& expected_state) const {
+template <typename StateType, typename Enable>
+bool ThreadSafeState<StateType, Enable>::is_state(const State& expected_state) const {
   std::shared_lock<std::shared_mutex> lock(state_mutex_);
   return state_ == expected_state;
 }
 
+template <typename StateType, typename Enable>
+void ThreadSafeState<StateType, Enable>::notify_state_change() {
+  state_cv_.notify_all();
+}
+
+template <typename StateType, typename Enable>
+void ThreadSafeState<StateType, Enable>::notify_callbacks(const State& new_state) {
+  std::lock_guard<std::mutex> lock(callbacks_mutex_);
+  for (const auto& callback : callbacks_) {
+    try {
+      callback(new_state);
+    } catch (...) {
+      // Ignore callback exceptions to prevent state corruption
+    }
+  }
+}
+
+// Lock-free enum specialization implementations
+template <typename StateType>
+ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>>::ThreadSafeState(
+    const State& initial_state)
+    : state_(initial_state) {}
+
+template <typename StateType>
+StateType ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>>::get_state() const noexcept {
+  return state_.load(std::memory_order_acquire);
+}
+
+template <typename StateType>
+void ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>>::set_state(const State& new_state) {
+  state_.store(new_state);
+  on_state_written(new_state);
+}
+
+template <typename StateType>
+bool ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>>::compare_and_set(
+    const State& expected, const State& desired) {
+  State expected_copy = expected;
+  if (!state_.compare_exchange_strong(expected_copy, desired)) {
+    return false;
+  }
+  on_state_written(desired);
+  return true;
+}
+
+template <typename StateType>
+StateType ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>>::exchange(
+    const State& new_state) {
+  State old_state = state_.exchange(new_state);
+  on_state_written(new_state);
+  return old_state;
+}
+
+template <typename StateType>
+void ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>>::add_state_change_callback(
+    StateCallback callback) {
+  std::lock_guard<std::mutex> lock(callbacks_mutex_);
+  callbacks_.push_back(callback);
+  observers_.fetch_add(1);
+}
+
+template <typename StateType>
+void ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>>::remove_state_change_callback(
+    StateCallback callback) {
+  std::lock_guard<std::mutex> lock(callbacks_mutex_);
+  auto it = std::remove(callbacks_.begin(), callbacks_.end(), callback);
+  observers_.fetch_sub(static_cast<uint32_t>(std::distance(it, callbacks_.end())));
+  callbacks_.erase(it, callbacks_.end());
+}
+
+template <typename StateType>
+void ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>>::clear_state_change_callbacks() {
+  std::lock_guard<std::mutex> lock(callbacks_mutex_);
+  observers_.fetch_sub(static_cast<uint32_t>(callbacks_.size()));
+  callbacks_.clear();
+}
+
+template <typename StateType>
+void ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>>::wait_for_state(
+    const State& expected_state, std::chrono::milliseconds timeout) {
+  // Register before checking the state so a concurrent writer either sees us or we see its write
+  observers_.fetch_add(1);
+  {
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    state_cv_.wait_for(lock, timeout, [this, &expected_state] { return state_.load() == expected_state; });
+  }
+  observers_.fetch_sub(1);
+}
+
 template <typename StateType>
-void ThreadSafeState<StateType>::notify_state_change() {
+void ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>>::wait_for_state_change(
+    std::chrono::milliseconds timeout) {
+  observers_.fetch_add(1);
+  {
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    state_cv_.wait_for(lock, timeout, [this] { return state_changed_.load(); });
+    state_changed_.store(false);
+  }
+  observers_.fetch_sub(1);
+}
+
+template <typename StateType>
+bool ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>>::is_state(
+    const State& expected_state) const noexcept {
+  return state_.load(std::memory_order_acquire) == expected_state;
+}
+
+template <typename StateType>
+void ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>>::notify_state_change() {
+  std::lock_guard<std::mutex> lock(wait_mutex_);
   state_cv_.notify_all();
 }
 
 template <typename StateType>
-void ThreadSafeState<StateType>::notify_callbacks(const State& new_state) {
+void ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>>::on_state_written(
+    const State& new_state) {
+  if (!state_changed_.load(std::memory_order_relaxed)) {
+    state_changed_.store(true);
+  }
+  if (observers_.load() == 0) {
+    return;
+  }
+  notify_callbacks(new_state);
+  notify_state_change();
+}
+
+template <typename StateType>
+void ThreadSafeState<StateType, std::enable_if_t<std::is_enum<StateType>::value>>::notify_callbacks(
+    const State& new_state) {
   std::lock_guard<std::mutex> lock(callbacks_mutex_);
   for (const auto& callback : callbacks_) {
     try {
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+/**
+ * @brief USDT (static tracepoint) probes
+ *
+ * With UNILINK_ENABLE_USDT and <sys/sdt.h> available, each probe compiles to
+ * a single nop plus an ELF note, so bpftrace or perf can attach to a release
+ * binary without recompiling and nothing runs while no tracer is attached.
+ * Otherwise the macros expand to nothing and their arguments are not
+ * evaluated.
+ *
+ * All probes use the provider "unilink". The first argument is the channel
+ * id, the address of the transport object (a TcpServerSession for server
+ * connections):
+ *   accept(server, channel, client_id)
+ *   reject(server, client_count)
+ *   read(channel, bytes)
+ *   write_start(channel, bytes, queued_bytes)
+ *   write_done(channel, bytes, queued_bytes)
+ *   backpressure(channel, queued_bytes)
+ *   retry(channel, interval_ms)
+ *   state(channel, LinkState)
+ */
+
+#if defined(UNILINK_ENABLE_USDT)
+#include <sys/sdt.h>
+
+#define UNILINK_TRACE1(name, a) DTRACE_PROBE1(unilink, name, a)
+#define UNILINK_TRACE2(name, a, b) DTRACE_PROBE2(unilink, name, a, b)
+#define UNILINK_TRACE3(name, a, b, c) DTRACE_PROBE3(unilink, name, a, b, c)
+#else
+#define UNILINK_TRACE1(name, a) ((void)0)
+#define UNILINK_TRACE2(name, a, b) ((void)0)
+#define UNILINK_TRACE3(name, a, b, c) ((void)0)
+#endif
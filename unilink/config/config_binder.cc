@@ -0,0 +1,146 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config_binder.hpp"
+
+#include "unilink/common/constants.hpp"
+#include "unilink/common/logger.hpp"
+#include "unilink/transport/serial/serial.hpp"
+#include "unilink/transport/tcp_client/tcp_client.hpp"
+#include "unilink/transport/tcp_server/tcp_server.hpp"
+
+namespace unilink {
+namespace config {
+
+namespace {
+
+constexpr int64_t MIN_BACKPRESSURE = static_cast<int64_t>(common::constants::MIN_BACKPRESSURE_THRESHOLD);
+constexpr int64_t MAX_BACKPRESSURE = static_cast<int64_t>(common::constants::MAX_BACKPRESSURE_THRESHOLD);
+constexpr int64_t MIN_RETRY_INTERVAL = common::constants::MIN_RETRY_INTERVAL_MS;
+constexpr int64_t MAX_RETRY_INTERVAL = common::constants::MAX_RETRY_INTERVAL_MS;
+constexpr int64_t MAX_CONNECTIONS = static_cast<int64_t>(common::constants::MAX_MAX_CONNECTIONS);
+
+// Wrap a setter so it only runs while the channel is alive
+template <typename Channel, typename Setter>
+std::function<bool(int64_t)> weak_setter(const std::shared_ptr<Channel>& channel, Setter setter) {
+  return [weak = std::weak_ptr<Channel>(channel), setter](int64_t value) {
+    auto locked = weak.lock();
+    if (!locked) return false;
+    setter(*locked, value);
+    return true;
+  };
+}
+
+}  // namespace
+
+ConfigBinder::ConfigBinder(std::shared_ptr<ConfigManagerInterface> config) : config_(std::move(config)) {
+  listener_id_ = config_->add_reload_listener([this](const std::vector<std::string>&) { apply(); });
+}
+
+ConfigBinder::~ConfigBinder() {
+  // Waits for a reload that is currently calling apply()
+  config_->remove_reload_listener(listener_id_);
+}
+
+void ConfigBinder::bind(const std::shared_ptr<transport::TcpClient>& client, const std::string& prefix) {
+  if (!client) return;
+  add_setting(prefix + ".backpressure_threshold", MIN_BACKPRESSURE, MAX_BACKPRESSURE,
+              weak_setter(client, [](transport::TcpClient& c, int64_t v) {
+                c.set_backpressure_threshold(static_cast<size_t>(v));
+              }));
+  add_setting(prefix + ".retry_interval_ms", MIN_RETRY_INTERVAL, MAX_RETRY_INTERVAL,
+              weak_setter(client, [](transport::TcpClient& c, int64_t v) {
+                c.set_retry_interval(static_cast<unsigned>(v));
+              }));
+}
+
+void ConfigBinder::bind(const std::shared_ptr<transport::TcpServer>& server, const std::string& prefix) {
+  if (!server) return;
+  add_setting(prefix + ".backpressure_threshold", MIN_BACKPRESSURE, MAX_BACKPRESSURE,
+              weak_setter(server, [](transport::TcpServer& s, int64_t v) {
+                s.set_backpressure_threshold(static_cast<size_t>(v));
+              }));
+  add_setting(prefix + ".max_connections", 0, MAX_CONNECTIONS,
+              weak_setter(server, [](transport::TcpServer& s, int64_t v) {
+                if (v == 0) {
+                  s.set_unlimited_clients();
+                } else {
+                  s.set_client_limit(static_cast<size_t>(v));
+                }
+              }));
+}
+
+void ConfigBinder::bind(const std::shared_ptr<transport::Serial>& serial, const std::string& prefix) {
+  if (!serial) return;
+  add_setting(prefix + ".backpressure_threshold", MIN_BACKPRESSURE, MAX_BACKPRESSURE,
+              weak_setter(serial, [](transport::Serial& s, int64_t v) {
+                s.set_backpressure_threshold(static_cast<size_t>(v));
+              }));
+  add_setting(prefix + ".retry_interval_ms", MIN_RETRY_INTERVAL, MAX_RETRY_INTERVAL,
+              weak_setter(serial, [](transport::Serial& s, int64_t v) {
+                s.set_retry_interval(static_cast<unsigned>(v));
+              }));
+}
+
+size_t ConfigBinder::apply() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t pushed = 0;
+  for (auto it = settings_.begin(); it != settings_.end();) {
+    if (!it->push) {
+      it = settings_.erase(it);
+      continue;
+    }
+    if (apply_setting(*it)) ++pushed;
+    ++it;
+  }
+  return pushed;
+}
+
+void ConfigBinder::add_setting(std::string key, int64_t min_value, int64_t max_value,
+                               std::function<bool(int64_t)> push) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  settings_.push_back(Setting{std::move(key), min_value, max_value, std::move(push), std::nullopt});
+  apply_setting(settings_.back());
+}
+
+bool ConfigBinder::apply_setting(Setting& setting) {
+  std::any value = config_->get(setting.key, std::any());
+  if (!value.has_value()) return false;
+
+  if (value.type() != typeid(int)) {
+    UNILINK_LOG_WARNING("config_binder", "apply", "Ignoring non-integer value for '" + setting.key + "'");
+    return false;
+  }
+  int64_t number = std::any_cast<int>(value);
+  if (number < setting.min_value || number > setting.max_value) {
+    UNILINK_LOG_WARNING("config_binder", "apply",
+                        "Ignoring out-of-range value for '" + setting.key + "': " + std::to_string(number) +
+                            " (allowed " + std::to_string(setting.min_value) + "-" +
+                            std::to_string(setting.max_value) + ")");
+    return false;
+  }
+  if (setting.applied == number) return false;
+
+  if (!setting.push(number)) {
+    setting.push = nullptr;  // Channel destroyed; dropped on the next apply()
+    return false;
+  }
+  setting.applied = number;
+  return true;
+}
+
+}  // namespace config
+}  // namespace unilink
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "iconfig_manager.hpp"
+
+namespace unilink {
+
+namespace transport {
+class TcpClient;
+class TcpServer;
+class Serial;
+}  // namespace transport
+
+namespace config {
+
+/**
+ * @brief Applies configuration changes to running channels
+ *
+ * Each bound channel follows the keys under its prefix:
+ *   - <prefix>.backpressure_threshold  (all transports)
+ *   - <prefix>.retry_interval_ms       (TcpClient, Serial)
+ *   - <prefix>.max_connections         (TcpServer, 0 means unlimited)
+ *
+ * Values are applied when a channel is bound and after every reload of the
+ * manager. Out-of-range values are rejected and the channel keeps its current
+ * setting. Only values that differ from the last applied one are pushed, and
+ * open connections are not interrupted. Channels are held weakly; destroyed
+ * ones are dropped.
+ */
+class ConfigBinder {
+ public:
+  explicit ConfigBinder(std::shared_ptr<ConfigManagerInterface> config);
+  ~ConfigBinder();
+
+  ConfigBinder(const ConfigBinder&) = delete;
+  ConfigBinder& operator=(const ConfigBinder&) = delete;
+
+  void bind(const std::shared_ptr<transport::TcpClient>& client, const std::string& prefix = "tcp.client");
+  void bind(const std::shared_ptr<transport::TcpServer>& server, const std::string& prefix = "tcp.server");
+  void bind(const std::shared_ptr<transport::Serial>& serial, const std::string& prefix = "serial");
+
+  /**
+   * @brief Push current values to all bound channels
+   * @return Number of settings that were pushed
+   */
+  size_t apply();
+
+ private:
+  struct Setting {
+    std::string key;
+    int64_t min_value;
+    int64_t max_value;
+    std::function<bool(int64_t)> push;  // Returns false once the channel is gone
+    std::optional<int64_t> applied;
+  };
+
+  void add_setting(std::string key, int64_t min_value, int64_t max_value, std::function<bool(int64_t)> push);
+  bool apply_setting(Setting& setting);
+
+  std::shared_ptr<ConfigManagerInterface> config_;
+  size_t listener_id_ = 0;
+  std::mutex mutex_;
+  std::vector<Setting> settings_;
+};
+
+}  // namespace config
+}  // namespace unilink
@@ -17,13 +17,111 @@
 #include "config_manager.hpp"
 
 #include <algorithm>
+#include <filesystem>
 #include <stdexcept>
 
 #include "unilink/common/logger.hpp"
 
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
 namespace unilink {
 namespace config {
 
+namespace {
+
+/**
+ * Change source for one watched file
+ *
+ * On Linux the parent directory is watched with inotify, which also catches
+ * editors that save by writing a temporary file and renaming it over the
+ * original. Elsewhere the file's modification time and size are polled.
+ */
+class FileWatch {
+ public:
+  explicit FileWatch(const std::string& filepath) : path_(filepath) {
+#ifdef __linux__
+    std::filesystem::path dir = path_.parent_path().empty() ? std::filesystem::path(".") : path_.parent_path();
+    name_ = path_.filename().string();
+    fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd_ >= 0 && inotify_add_watch(fd_, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0) {
+      ::close(fd_);
+      fd_ = -1;
+    }
+#else
+    last_stamp_ = stamp();
+#endif
+  }
+
+  ~FileWatch() {
+#ifdef __linux__
+    if (fd_ >= 0) ::close(fd_);
+#endif
+  }
+
+  FileWatch(const FileWatch&) = delete;
+  FileWatch& operator=(const FileWatch&) = delete;
+
+  bool valid() const {
+#ifdef __linux__
+    return fd_ >= 0;
+#else
+    return true;
+#endif
+  }
+
+  // Block for at most timeout; true if the watched file changed meanwhile
+  bool wait(std::chrono::milliseconds timeout) {
+#ifdef __linux__
+    pollfd pfd{fd_, POLLIN, 0};
+    if (::poll(&pfd, 1, static_cast<int>(timeout.count())) <= 0) return false;
+
+    bool changed = false;
+    alignas(inotify_event) char buffer[4096];
+    ssize_t len;
+    while ((len = ::read(fd_, buffer, sizeof(buffer))) > 0) {
+      for (char* ptr = buffer; ptr < buffer + len;) {
+        auto* event = reinterpret_cast<inotify_event*>(ptr);
+        if (event->len > 0 && name_ == event->name) changed = true;
+        ptr += sizeof(inotify_event) + event->len;
+      }
+    }
+    return changed;
+#else
+    std::this_thread::sleep_for(timeout);
+    auto current = stamp();
+    if (current == last_stamp_) return false;
+    last_stamp_ = current;
+    return true;
+#endif
+  }
+
+ private:
+  std::filesystem::path path_;
+#ifdef __linux__
+  std::string name_;
+  int fd_ = -1;
+#else
+  std::pair<std::filesystem::file_time_type, uintmax_t> stamp() const {
+    std::error_code ec;
+    auto time = std::filesystem::last_write_time(path_, ec);
+    auto size = std::filesystem::file_size(path_, ec);
+    return {time, ec ? 0 : size};
+  }
+
+  std::pair<std::filesystem::file_time_type, uintmax_t> last_stamp_;
+#endif
+};
+
+}  // namespace
+
+ConfigManager::ConfigManager() : snapshot_(std::make_shared<const ConfigSnapshot>()) {}
+
+ConfigManager::~ConfigManager() { stop_watching(); }
+
 std::any ConfigManager::get(const std::string& key) const {
   std::lock_guard<std::mutex> lock(mutex_);
   auto it = config_items_.find(key);
@@ -65,10 +163,11 @@ ValidationResult ConfigManager::set(const std::string& key, const std::any& valu
     had_key = true;
     it->second.value = value;
   } else {
-    // Create new config item
-    ConfigItem item(key, value, ConfigType::String, false);
+    // Create new config item, typed after its first value so later typed sets validate
+    ConfigItem item(key, value, type_of(value), false);
     config_items_[key] = item;
   }
+  publish_if_tracked(key);
 
   // Notify change
   if (had_key) {
@@ -83,6 +182,7 @@ bool ConfigManager::remove(const std::string& key) {
   auto it = config_items_.find(key);
   if (it != config_items_.end()) {
     config_items_.erase(it);
+    publish_if_tracked(key);
     return true;
   }
   return false;
@@ -91,6 +191,7 @@ bool ConfigManager::remove(const std::string& key) {
 void ConfigManager::clear() {
   std::lock_guard<std::mutex> lock(mutex_);
   config_items_.clear();
+  publish_snapshot();
 }
 
 ValidationResult ConfigManager::validate() const {
@@ -119,6 +220,7 @@ ValidationResult ConfigManager::validate(const std::string& key) const {
 void ConfigManager::register_item(const ConfigItem& item) {
   std::lock_guard<std::mutex> lock(mutex_);
   config_items_[item.key] = item;
+  publish_if_tracked(item.key);
 }
 
 void ConfigManager::register_validator(const std::string& key,
@@ -168,54 +270,172 @@ bool ConfigManager::load_from_file(const std::string& filepath) {
   std::lock_guard<std::mutex> lock(mutex_);
 
   try {
-    std::ifstream file(filepath);
-    if (!file.is_open()) {
+    std::vector<std::pair<std::string, std::string>> entries;
+    if (!read_entries(filepath, entries)) {
       return false;
     }
 
-    std::string line;
-    while (std::getline(file, line)) {
-      // Skip comments and empty lines
-      if (line.empty() || line[0] == '#') {
-        continue;
+    for (const auto& [key, value_str] : entries) {
+      ConfigType type = infer_type(value_str);
+      std::any value = deserialize_value(value_str, type);
+      ConfigItem item(key, value, type, false);
+      config_items_[key] = item;
+    }
+
+    publish_snapshot();
+    return true;
+  } catch (const std::exception& e) {
+    UNILINK_LOG_ERROR("config_manager", "load", "Error loading configuration: " + std::string(e.what()));
+    return false;
+  }
+}
+
+bool ConfigManager::reload_from_file(const std::string& filepath) {
+  std::vector<std::string> changed_keys;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    try {
+      std::vector<std::pair<std::string, std::string>> entries;
+      if (!read_entries(filepath, entries)) {
+        return false;
       }
 
-      // Parse key=value pairs
-      size_t pos = line.find('=');
-      if (pos != std::string::npos) {
-        std::string key = line.substr(0, pos);
-        std::string value_str = line.substr(pos + 1);
-
-        // Trim whitespace
-        key.erase(0, key.find_first_not_of(" \t"));
-        key.erase(key.find_last_not_of(" \t") + 1);
-        value_str.erase(0, value_str.find_first_not_of(" \t"));
-        value_str.erase(value_str.find_last_not_of(" \t") + 1);
-
-        // Try to determine type and deserialize
-        ConfigType type = ConfigType::String;
-        if (value_str == "true" || value_str == "false") {
-          type = ConfigType::Boolean;
-        } else if (std::all_of(value_str.begin(), value_str.end(),
-                               [](char c) { return std::isdigit(c) || c == '-'; })) {
-          type = ConfigType::Integer;
-        } else if (std::count(value_str.begin(), value_str.end(), '.') == 1 &&
-                   std::all_of(value_str.begin(), value_str.end(),
-                               [](char c) { return std::isdigit(c) || c == '.' || c == '-'; })) {
-          type = ConfigType::Double;
+      for (const auto& [key, value_str] : entries) {
+        auto it = config_items_.find(key);
+        if (it == config_items_.end()) {
+          ConfigType type = infer_type(value_str);
+          config_items_[key] = ConfigItem(key, deserialize_value(value_str, type), type, false);
+          publish_if_tracked(key);
+          changed_keys.push_back(key);
+          continue;
         }
 
-        std::any value = deserialize_value(value_str, type);
-        ConfigItem item(key, value, type, false);
-        config_items_[key] = item;
+        // Known keys keep their registered type and validator; a bad value leaves the old one in place
+        std::any value = deserialize_value(value_str, it->second.type);
+        auto result = validate_value(key, value);
+        if (!result.is_valid) {
+          UNILINK_LOG_WARNING("config_manager", "reload",
+                              "Rejected value for '" + key + "': " + value_str + " (" + result.error_message + ")");
+          continue;
+        }
+        if (serialize_value(value, it->second.type) == serialize_value(it->second.value, it->second.type)) {
+          continue;
+        }
+
+        std::any old_value = it->second.value;
+        it->second.value = value;
+        publish_if_tracked(key);
+        changed_keys.push_back(key);
+        notify_change(key, old_value, value);
       }
+    } catch (const std::exception& e) {
+      UNILINK_LOG_ERROR("config_manager", "reload", "Error reloading configuration: " + std::string(e.what()));
+      return false;
     }
+  }
 
-    return true;
-  } catch (const std::exception& e) {
-    UNILINK_LOG_ERROR("config_manager", "load", "Error loading configuration: " + std::string(e.what()));
+  if (!changed_keys.empty()) {
+    UNILINK_LOG_INFO("config_manager", "reload",
+                     "Reloaded " + std::to_string(changed_keys.size()) + " changed key(s) from " + filepath);
+    notify_reload(changed_keys);
+  }
+  return true;
+}
+
+bool ConfigManager::watch_file(const std::string& filepath, std::chrono::milliseconds debounce) {
+  std::lock_guard<std::mutex> lock(watch_mutex_);
+  stop_watching_locked();
+
+  auto watch = std::make_shared<FileWatch>(filepath);
+  if (!watch->valid()) {
+    UNILINK_LOG_ERROR("config_manager", "watch", "Unable to watch configuration file: " + filepath);
     return false;
   }
+
+  auto running = std::make_shared<std::atomic<bool>>(true);
+  watch_running_ = running;
+  watch_thread_ = std::thread([this, watch, running, filepath, debounce] {
+    using clock = std::chrono::steady_clock;
+    const auto poll_interval = std::chrono::milliseconds(common::constants::CONFIG_WATCH_POLL_INTERVAL_MS);
+    const auto max_delay = debounce * common::constants::CONFIG_RELOAD_MAX_DELAY_WINDOWS;
+
+    // Every change restarts the quiet period; the reload runs once the file has settled
+    bool pending = false;
+    clock::time_point first_change;
+    clock::time_point deadline;
+    while (running->load(std::memory_order_acquire)) {
+      auto timeout = poll_interval;
+      if (pending) {
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - clock::now());
+        timeout = std::clamp(remaining, std::chrono::milliseconds(0), poll_interval);
+      }
+
+      if (watch->wait(timeout)) {
+        auto now = clock::now();
+        if (!pending) {
+          pending = true;
+          first_change = now;
+        }
+        deadline = std::min(now + debounce, first_change + max_delay);
+      }
+
+      if (pending && clock::now() >= deadline && running->load(std::memory_order_acquire)) {
+        pending = false;
+        reload_from_file(filepath);
+      }
+    }
+  });
+  return true;
+}
+
+void ConfigManager::stop_watching() {
+  std::lock_guard<std::mutex> lock(watch_mutex_);
+  stop_watching_locked();
+}
+
+void ConfigManager::stop_watching_locked() {
+  if (watch_running_) {
+    watch_running_->store(false, std::memory_order_release);
+    watch_running_.reset();
+  }
+  if (!watch_thread_.joinable()) {
+    return;
+  }
+  if (watch_thread_.get_id() == std::this_thread::get_id()) {
+    watch_thread_.detach();  // Called from a reload listener; the loop exits on its own
+  } else {
+    watch_thread_.join();
+  }
+}
+
+bool ConfigManager::is_watching() const {
+  std::lock_guard<std::mutex> lock(watch_mutex_);
+  return watch_running_ != nullptr;
+}
+
+size_t ConfigManager::add_reload_listener(ConfigReloadCallback callback) {
+  std::lock_guard<std::mutex> lock(listeners_mutex_);
+  size_t id = next_listener_id_++;
+  reload_listeners_.emplace(id, std::move(callback));
+  return id;
+}
+
+void ConfigManager::remove_reload_listener(size_t listener_id) {
+  std::lock_guard<std::mutex> lock(listeners_mutex_);
+  reload_listeners_.erase(listener_id);
+}
+
+void ConfigManager::notify_reload(const std::vector<std::string>& changed_keys) {
+  std::lock_guard<std::mutex> lock(listeners_mutex_);
+  for (const auto& [id, listener] : reload_listeners_) {
+    try {
+      listener(changed_keys);
+    } catch (const std::exception& e) {
+      UNILINK_LOG_ERROR("config_manager", "reload", "Error in reload listener: " + std::string(e.what()));
+    }
+  }
 }
 
 std::vector<std::string> ConfigManager::get_keys() const {
@@ -257,6 +477,59 @@ bool ConfigManager::is_required(const std::string& key) const {
   return false;
 }
 
+std::shared_ptr<const ConfigSnapshot> ConfigManager::snapshot() const {
+  return std::atomic_load_explicit(&snapshot_, std::memory_order_acquire);
+}
+
+uint64_t ConfigManager::snapshot_version() const { return snapshot_version_.load(std::memory_order_acquire); }
+
+size_t ConfigManager::register_key_slot(const std::string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = key_slots_.find(name);
+  if (it != key_slots_.end()) {
+    return it->second;
+  }
+
+  size_t slot = slot_keys_.size();
+  key_slots_.emplace(name, slot);
+  slot_keys_.push_back(name);
+  publish_snapshot();
+  return slot;
+}
+
+void ConfigManager::publish_snapshot() {
+  std::vector<ConfigValue> values(slot_keys_.size());
+  for (size_t slot = 0; slot < slot_keys_.size(); ++slot) {
+    auto it = config_items_.find(slot_keys_[slot]);
+    if (it != config_items_.end()) {
+      values[slot] = ConfigSnapshot::from_any(it->second.value);
+    }
+  }
+
+  uint64_t version = snapshot_version_.load(std::memory_order_relaxed) + 1;
+  std::atomic_store_explicit(&snapshot_, std::make_shared<const ConfigSnapshot>(std::move(values), version),
+                             std::memory_order_release);
+  snapshot_version_.store(version, std::memory_order_release);
+}
+
+void ConfigManager::publish_if_tracked(const std::string& key) {
+  auto slot = key_slots_.find(key);
+  if (slot == key_slots_.end()) {
+    return;  // No handle reads this key, so the snapshot is unaffected
+  }
+
+  // Copy-on-write: only the changed slot differs from the current snapshot
+  std::vector<ConfigValue> values = snapshot_->values();
+  values.resize(slot_keys_.size());
+  auto it = config_items_.find(key);
+  values[slot->second] = it != config_items_.end() ? ConfigSnapshot::from_any(it->second.value) : ConfigValue{};
+
+  uint64_t version = snapshot_version_.load(std::memory_order_relaxed) + 1;
+  std::atomic_store_explicit(&snapshot_, std::make_shared<const ConfigSnapshot>(std::move(values), version),
+                             std::memory_order_release);
+  snapshot_version_.store(version, std::memory_order_release);
+}
+
 ValidationResult ConfigManager::validate_value(const std::string& key, const std::any& value) const {
   auto it = config_items_.find(key);
   if (it != config_items_.end()) {
@@ -266,20 +539,7 @@ ValidationResult ConfigManager::validate_value(const std::string& key, const std
     }
 
     // Basic type validation
-    ConfigType expected_type = it->second.type;
-    ConfigType actual_type = ConfigType::String;
-
-    if (value.type() == typeid(std::string)) {
-      actual_type = ConfigType::String;
-    } else if (value.type() == typeid(int)) {
-      actual_type = ConfigType::Integer;
-    } else if (value.type() == typeid(bool)) {
-      actual_type = ConfigType::Boolean;
-    } else if (value.type() == typeid(double)) {
-      actual_type = ConfigType::Double;
-    }
-
-    if (expected_type != actual_type) {
+    if (it->second.type != type_of(value)) {
       return ValidationResult::error("Type mismatch for key '" + key + "'");
     }
   }
@@ -287,6 +547,62 @@ ValidationResult ConfigManager::validate_value(const std::string& key, const std
   return ValidationResult::success();
 }
 
+ConfigType ConfigManager::infer_type(const std::string& value_str) {
+  if (value_str == "true" || value_str == "false") {
+    return ConfigType::Boolean;
+  } else if (std::all_of(value_str.begin(), value_str.end(), [](char c) { return std::isdigit(c) || c == '-'; })) {
+    return ConfigType::Integer;
+  } else if (std::count(value_str.begin(), value_str.end(), '.') == 1 &&
+             std::all_of(value_str.begin(), value_str.end(),
+                         [](char c) { return std::isdigit(c) || c == '.' || c == '-'; })) {
+    return ConfigType::Double;
+  }
+  return ConfigType::String;
+}
+
+bool ConfigManager::read_entries(const std::string& filepath,
+                                 std::vector<std::pair<std::string, std::string>>& entries) {
+  std::ifstream file(filepath);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  std::string line;
+  while (std::getline(file, line)) {
+    // Skip comments and empty lines
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    // Parse key=value pairs
+    size_t pos = line.find('=');
+    if (pos != std::string::npos) {
+      std::string key = line.substr(0, pos);
+      std::string value_str = line.substr(pos + 1);
+
+      // Trim whitespace
+      key.erase(0, key.find_first_not_of(" \t"));
+      key.erase(key.find_last_not_of(" \t") + 1);
+      value_str.erase(0, value_str.find_first_not_of(" \t"));
+      value_str.erase(value_str.find_last_not_of(" \t") + 1);
+
+      entries.emplace_back(std::move(key), std::move(value_str));
+    }
+  }
+  return true;
+}
+
+ConfigType ConfigManager::type_of(const std::any& value) {
+  if (value.type() == typeid(int)) {
+    return ConfigType::Integer;
+  } else if (value.type() == typeid(bool)) {
+    return ConfigType::Boolean;
+  } else if (value.type() == typeid(double)) {
+    return ConfigType::Double;
+  }
+  return ConfigType::String;
+}
+
 void ConfigManager::notify_change(const std::string& key, const std::any& old_value, const std::any& new_value) {
   auto it = change_callbacks_.find(key);
   if (it != change_callbacks_.end()) {
@@ -16,10 +16,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <mutex>
 #include <sstream>
+#include <thread>
+#include <utility>
 
 #include "iconfig_manager.hpp"
 
@@ -28,11 +31,20 @@ namespace config {
 
 /**
  * Thread-safe configuration manager implementation
+ *
+ * Keys with a handle (key<T>()) are mirrored into an immutable ConfigSnapshot
+ * that is republished copy-on-write after each change, so typed reads from
+ * I/O threads never wait for a writer holding the manager mutex.
+ *
+ * watch_file() follows a file on a background thread (inotify on Linux,
+ * modification-time polling elsewhere). A burst of writes is debounced into a
+ * single reload_from_file(), which validates each value before applying it and
+ * then notifies the reload listeners once with every key that changed.
  */
 class ConfigManager : public ConfigManagerInterface {
  public:
-  ConfigManager() = default;
-  ~ConfigManager() = default;
+  ConfigManager();
+  ~ConfigManager() override;
 
   // Configuration access
   std::any get(const std::string& key) const override;
@@ -60,19 +72,59 @@ class ConfigManager : public ConfigManagerInterface {
   bool save_to_file(const std::string& filepath) const override;
   bool load_from_file(const std::string& filepath) override;
 
+  // Live reload
+  bool reload_from_file(const std::string& filepath) override;
+  bool watch_file(const std::string& filepath,
+                  std::chrono::milliseconds debounce = std::chrono::milliseconds(
+                      common::constants::DEFAULT_CONFIG_RELOAD_DEBOUNCE_MS)) override;
+  void stop_watching() override;
+  bool is_watching() const override;
+  size_t add_reload_listener(ConfigReloadCallback callback) override;
+  void remove_reload_listener(size_t listener_id) override;
+
   // Configuration introspection
   std::vector<std::string> get_keys() const override;
   ConfigType get_type(const std::string& key) const override;
   std::string get_description(const std::string& key) const override;
   bool is_required(const std::string& key) const override;
 
+  // Snapshot access
+  std::shared_ptr<const ConfigSnapshot> snapshot() const override;
+  uint64_t snapshot_version() const override;
+
+ protected:
+  size_t register_key_slot(const std::string& name) override;
+
  private:
   mutable std::mutex mutex_;
   std::unordered_map<std::string, ConfigItem> config_items_;
   std::unordered_map<std::string, ConfigChangeCallback> change_callbacks_;
 
+  // Snapshot state: slots are assigned under mutex_, the snapshot is swapped atomically
+  std::unordered_map<std::string, size_t> key_slots_;
+  std::vector<std::string> slot_keys_;
+  std::shared_ptr<const ConfigSnapshot> snapshot_;
+  std::atomic<uint64_t> snapshot_version_{0};
+
+  void publish_snapshot();
+  void publish_if_tracked(const std::string& key);
+
+  // File watching: listeners run under listeners_mutex_ so removal waits for an in-flight reload
+  std::thread watch_thread_;
+  std::shared_ptr<std::atomic<bool>> watch_running_;  // Per-watch stop flag
+  mutable std::mutex watch_mutex_;
+  std::mutex listeners_mutex_;
+  std::unordered_map<size_t, ConfigReloadCallback> reload_listeners_;
+  size_t next_listener_id_ = 1;
+
+  void stop_watching_locked();
+  void notify_reload(const std::vector<std::string>& changed_keys);
+
   // Helper methods
   ValidationResult validate_value(const std::string& key, const std::any& value) const;
+  static ConfigType type_of(const std::any& value);
+  static ConfigType infer_type(const std::string& value_str);
+  static bool read_entries(const std::string& filepath, std::vector<std::pair<std::string, std::string>>& entries);
   void notify_change(const std::string& key, const std::any& old_value, const std::any& new_value);
   std::string serialize_value(const std::any& value, ConfigType type) const;
   std::any deserialize_value(const std::string& value_str, ConfigType type) const;
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace unilink {
+namespace config {
+
+/**
+ * Typed configuration value held by a snapshot (monostate = unset or unsupported type)
+ */
+using ConfigValue = std::variant<std::monostate, std::string, int, bool, double>;
+
+/**
+ * Precompiled handle to a configuration key
+ *
+ * Obtained once from ConfigManagerInterface::key<T>() and then used for O(1)
+ * typed reads from a ConfigSnapshot. T must be std::string, int, bool or double.
+ */
+template <typename T>
+class ConfigKey {
+ public:
+  static_assert(std::is_same<T, std::string>::value || std::is_same<T, int>::value || std::is_same<T, bool>::value ||
+                    std::is_same<T, double>::value,
+                "ConfigKey supports std::string, int, bool and double");
+
+  ConfigKey() = default;
+  ConfigKey(std::string name, size_t slot) : name_(std::move(name)), slot_(slot) {}
+
+  const std::string& name() const { return name_; }
+  size_t slot() const { return slot_; }
+
+ private:
+  std::string name_;
+  size_t slot_ = static_cast<size_t>(-1);
+};
+
+/**
+ * Immutable configuration snapshot
+ *
+ * A new snapshot is published on every change to a key that has a handle,
+ * so a snapshot can be read from any thread without locking.
+ */
+class ConfigSnapshot {
+ public:
+  ConfigSnapshot() = default;
+  ConfigSnapshot(std::vector<ConfigValue> values, uint64_t version) : values_(std::move(values)), version_(version) {}
+
+  /**
+   * Get a pointer to the value, or nullptr if unset or of another type
+   */
+  template <typename T>
+  const T* get_if(const ConfigKey<T>& key) const {
+    return key.slot() < values_.size() ? std::get_if<T>(&values_[key.slot()]) : nullptr;
+  }
+
+  /**
+   * Get the value, or default_value if unset or of another type
+   */
+  template <typename T>
+  T get(const ConfigKey<T>& key, T default_value = T{}) const {
+    const T* value = get_if(key);
+    return value ? *value : default_value;
+  }
+
+  template <typename T>
+  bool has(const ConfigKey<T>& key) const {
+    return get_if(key) != nullptr;
+  }
+
+  uint64_t version() const { return version_; }
+  const std::vector<ConfigValue>& values() const { return values_; }
+
+  /**
+   * Convert a dynamically typed value into a snapshot value
+   */
+  static ConfigValue from_any(const std::any& value) {
+    if (value.type() == typeid(std::string)) return std::any_cast<std::string>(value);
+    if (value.type() == typeid(int)) return std::any_cast<int>(value);
+    if (value.type() == typeid(bool)) return std::any_cast<bool>(value);
+    if (value.type() == typeid(double)) return std::any_cast<double>(value);
+    if (value.type() == typeid(const char*)) return std::string(std::any_cast<const char*>(value));
+    return std::monostate{};
+  }
+
+ private:
+  std::vector<ConfigValue> values_;
+  uint64_t version_ = 0;
+};
+
+}  // namespace config
+}  // namespace unilink
@@ -17,12 +17,17 @@
 #pragma once
 
 #include <any>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "config_snapshot.hpp"
+#include "unilink/common/constants.hpp"
+
 namespace unilink {
 namespace config {
 
@@ -68,6 +73,11 @@ struct ConfigItem {
 using ConfigChangeCallback =
     std::function<void(const std::string& key, const std::any& old_value, const std::any& new_value)>;
 
+/**
+ * Reload callback, invoked once per reload that changed at least one value
+ */
+using ConfigReloadCallback = std::function<void(const std::vector<std::string>& changed_keys)>;
+
 /**
  * Abstract interface for configuration management
  */
@@ -102,11 +112,68 @@ class ConfigManagerInterface {
   virtual bool save_to_file(const std::string& filepath) const = 0;
   virtual bool load_from_file(const std::string& filepath) = 0;
 
+  // Live reload
+  virtual bool reload_from_file(const std::string& filepath) = 0;
+  virtual bool watch_file(const std::string& filepath,
+                          std::chrono::milliseconds debounce = std::chrono::milliseconds(
+                              common::constants::DEFAULT_CONFIG_RELOAD_DEBOUNCE_MS)) = 0;
+  virtual void stop_watching() = 0;
+  virtual bool is_watching() const = 0;
+  virtual size_t add_reload_listener(ConfigReloadCallback callback) = 0;
+  virtual void remove_reload_listener(size_t listener_id) = 0;
+
   // Configuration introspection
   virtual std::vector<std::string> get_keys() const = 0;
   virtual ConfigType get_type(const std::string& key) const = 0;
   virtual std::string get_description(const std::string& key) const = 0;
   virtual bool is_required(const std::string& key) const = 0;
+
+  // Snapshot access (lock-free typed reads)
+  virtual std::shared_ptr<const ConfigSnapshot> snapshot() const = 0;
+  virtual uint64_t snapshot_version() const = 0;
+
+  /**
+   * Get a precompiled handle for typed snapshot reads of key
+   */
+  template <typename T>
+  ConfigKey<T> key(const std::string& name) {
+    return ConfigKey<T>(name, register_key_slot(name));
+  }
+
+ protected:
+  // Assign (or look up) the snapshot slot backing a key handle
+  virtual size_t register_key_slot(const std::string& name) = 0;
+};
+
+/**
+ * Per-thread cached view of the current configuration snapshot
+ *
+ * current() costs one atomic load while the configuration is unchanged and
+ * only re-acquires the snapshot after a write. Keep one reader per thread
+ * (or per connection); a reader itself is not thread-safe.
+ */
+class ConfigReader {
+ public:
+  explicit ConfigReader(const ConfigManagerInterface& manager) : manager_(manager) {}
+
+  const ConfigSnapshot& current() {
+    uint64_t version = manager_.snapshot_version();
+    if (!cached_ || version != cached_version_) {
+      cached_ = manager_.snapshot();
+      cached_version_ = cached_->version();
+    }
+    return *cached_;
+  }
+
+  template <typename T>
+  T get(const ConfigKey<T>& key, T default_value = T{}) {
+    return current().get(key, std::move(default_value));
+  }
+
+ private:
+  const ConfigManagerInterface& manager_;
+  std::shared_ptr<const ConfigSnapshot> cached_;
+  uint64_t cached_version_ = 0;
 };
 
 }  // namespace config
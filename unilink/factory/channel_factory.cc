@@ -16,8 +16,10 @@
 
 #include "unilink/factory/channel_factory.hpp"
 
+#include "unilink/transport/serial/boost_serial_port.hpp"
 #include "unilink/transport/serial/serial.hpp"
 #include "unilink/transport/tcp_client/tcp_client.hpp"
+#include "unilink/transport/tcp_server/boost_tcp_acceptor.hpp"
 #include "unilink/transport/tcp_server/tcp_server.hpp"
 
 namespace unilink {
@@ -42,6 +44,26 @@ std::shared_ptr<interface::Channel> ChannelFactory::create(const ChannelOptions&
       options);
 }
 
+std::shared_ptr<interface::Channel> ChannelFactory::create(const ChannelOptions& options,
+                                                           boost::asio::io_context& ioc) {
+  return std::visit(
+      [&ioc](const auto& config) -> std::shared_ptr<interface::Channel> {
+        using T = std::decay_t<decltype(config)>;
+
+        if constexpr (std::is_same_v<T, config::TcpClientConfig>) {
+          return create_tcp_client(config, ioc);
+        } else if constexpr (std::is_same_v<T, config::TcpServerConfig>) {
+          return create_tcp_server(config, ioc);
+        } else if constexpr (std::is_same_v<T, config::SerialConfig>) {
+          return create_serial(config, ioc);
+        } else {
+          static_assert(std::is_same_v<T, void>, "Unsupported config type");
+          return nullptr;
+        }
+      },
+      options);
+}
+
 std::shared_ptr<interface::Channel> ChannelFactory::create_tcp_server(const config::TcpServerConfig& cfg) {
   return std::make_shared<transport::TcpServer>(cfg);
 }
@@ -54,5 +76,20 @@ std::shared_ptr<interface::Channel> ChannelFactory::create_serial(const config::
   return std::make_shared<transport::Serial>(cfg);
 }
 
+std::shared_ptr<interface::Channel> ChannelFactory::create_tcp_server(const config::TcpServerConfig& cfg,
+                                                                     boost::asio::io_context& ioc) {
+  return std::make_shared<transport::TcpServer>(cfg, std::make_unique<transport::BoostTcpAcceptor>(ioc), ioc);
+}
+
+std::shared_ptr<interface::Channel> ChannelFactory::create_tcp_client(const config::TcpClientConfig& cfg,
+                                                                     boost::asio::io_context& ioc) {
+  return std::make_shared<transport::TcpClient>(cfg, ioc);
+}
+
+std::shared_ptr<interface::Channel> ChannelFactory::create_serial(const config::SerialConfig& cfg,
+                                                                 boost::asio::io_context& ioc) {
+  return std::make_shared<transport::Serial>(cfg, std::make_unique<transport::BoostSerialPort>(ioc), ioc);
+}
+
 }  // namespace factory
 }  // namespace unilink
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <boost/asio/io_context.hpp>
 #include <memory>
 #include <variant>
 
@@ -39,11 +40,21 @@ class ChannelFactory {
   // Channel creation
   static std::shared_ptr<interface::Channel> create(const ChannelOptions& options);
 
+  // Channel creation on a caller-run io_context (no thread is started by the channel)
+  static std::shared_ptr<interface::Channel> create(const ChannelOptions& options, boost::asio::io_context& ioc);
+
  private:
   // Creation functions for each Transport type
   static std::shared_ptr<interface::Channel> create_tcp_server(const config::TcpServerConfig& cfg);
   static std::shared_ptr<interface::Channel> create_tcp_client(const config::TcpClientConfig& cfg);
   static std::shared_ptr<interface::Channel> create_serial(const config::SerialConfig& cfg);
+
+  static std::shared_ptr<interface::Channel> create_tcp_server(const config::TcpServerConfig& cfg,
+                                                               boost::asio::io_context& ioc);
+  static std::shared_ptr<interface::Channel> create_tcp_client(const config::TcpClientConfig& cfg,
+                                                               boost::asio::io_context& ioc);
+  static std::shared_ptr<interface::Channel> create_serial(const config::SerialConfig& cfg,
+                                                           boost::asio::io_context& ioc);
 };
 
 }  // namespace factory
@@ -0,0 +1,298 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "unilink/factory/channel_provisioner.hpp"
+
+#include <algorithm>
+#include <any>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+
+#include "unilink/common/exceptions.hpp"
+#include "unilink/common/logger.hpp"
+#include "unilink/config/config_manager.hpp"
+
+namespace unilink {
+namespace factory {
+
+namespace {
+
+constexpr const char* CHANNEL_PREFIX = "channels.";
+
+/**
+ * Typed access to the fields of one channel; every field must be consumed
+ */
+class FieldReader {
+ public:
+  FieldReader(const std::string& channel, const std::map<std::string, std::any>& fields)
+      : channel_(channel), fields_(fields) {}
+
+  std::string string(const std::string& field, const std::string& fallback) {
+    const std::any* value = take(field);
+    if (!value) return fallback;
+    if (value->type() == typeid(std::string)) return std::any_cast<std::string>(*value);
+    if (value->type() == typeid(int)) return std::to_string(std::any_cast<int>(*value));
+    fail(field, "expected a string");
+    return fallback;
+  }
+
+  int64_t integer(const std::string& field, int64_t fallback, int64_t min_value, int64_t max_value) {
+    const std::any* value = take(field);
+    if (!value) return fallback;
+    if (value->type() != typeid(int)) fail(field, "expected an integer");
+    int64_t number = std::any_cast<int>(*value);
+    if (number < min_value || number > max_value) {
+      fail(field, "out of range [" + std::to_string(min_value) + ", " + std::to_string(max_value) + "]");
+    }
+    return number;
+  }
+
+  bool boolean(const std::string& field, bool fallback) {
+    const std::any* value = take(field);
+    if (!value) return fallback;
+    if (value->type() != typeid(bool)) fail(field, "expected true or false");
+    return std::any_cast<bool>(*value);
+  }
+
+  // Reject typos: any field left over was not understood
+  void finish() const {
+    for (const auto& [field, value] : fields_) {
+      if (consumed_.count(field) == 0) fail(field, "unknown field");
+    }
+  }
+
+  [[noreturn]] void fail(const std::string& field, const std::string& reason) const {
+    throw common::ConfigurationException("Channel '" + channel_ + "' field '" + field + "': " + reason,
+                                         CHANNEL_PREFIX + channel_, "parse");
+  }
+
+ private:
+  const std::any* take(const std::string& field) {
+    consumed_.insert(field);
+    auto it = fields_.find(field);
+    return it != fields_.end() ? &it->second : nullptr;
+  }
+
+  std::string channel_;
+  const std::map<std::string, std::any>& fields_;
+  std::set<std::string> consumed_;
+};
+
+using common::constants::MAX_BACKPRESSURE_THRESHOLD;
+using common::constants::MAX_RETRIES_LIMIT;
+using common::constants::MAX_RETRY_INTERVAL_MS;
+using common::constants::MIN_BACKPRESSURE_THRESHOLD;
+using common::constants::MIN_RETRY_INTERVAL_MS;
+
+config::TcpClientConfig parse_tcp_client(FieldReader& reader) {
+  config::TcpClientConfig cfg;
+  cfg.host = reader.string("host", cfg.host);
+  cfg.port = static_cast<uint16_t>(reader.integer("port", cfg.port, 1, 65535));
+  cfg.retry_interval_ms = static_cast<unsigned>(
+      reader.integer("retry_interval_ms", cfg.retry_interval_ms, MIN_RETRY_INTERVAL_MS, MAX_RETRY_INTERVAL_MS));
+  cfg.connection_timeout_ms = static_cast<unsigned>(
+      reader.integer("connection_timeout_ms", cfg.connection_timeout_ms, common::constants::MIN_CONNECTION_TIMEOUT_MS,
+                     common::constants::MAX_CONNECTION_TIMEOUT_MS));
+  cfg.max_retries = static_cast<int>(reader.integer("max_retries", cfg.max_retries, -1, MAX_RETRIES_LIMIT));
+  cfg.backpressure_threshold =
+      static_cast<size_t>(reader.integer("backpressure_threshold", static_cast<int64_t>(cfg.backpressure_threshold),
+                                         MIN_BACKPRESSURE_THRESHOLD, MAX_BACKPRESSURE_THRESHOLD));
+  if (cfg.host.empty()) reader.fail("host", "must not be empty");
+  return cfg;
+}
+
+config::TcpServerConfig parse_tcp_server(FieldReader& reader) {
+  config::TcpServerConfig cfg;
+  cfg.port = static_cast<uint16_t>(reader.integer("port", cfg.port, 1, 65535));
+  cfg.max_connections = static_cast<int>(reader.integer(
+      "max_connections", cfg.max_connections, 1, static_cast<int64_t>(common::constants::MAX_MAX_CONNECTIONS)));
+  cfg.backpressure_threshold =
+      static_cast<size_t>(reader.integer("backpressure_threshold", static_cast<int64_t>(cfg.backpressure_threshold),
+                                         MIN_BACKPRESSURE_THRESHOLD, MAX_BACKPRESSURE_THRESHOLD));
+  cfg.enable_port_retry = reader.boolean("enable_port_retry", cfg.enable_port_retry);
+  cfg.max_port_retries = static_cast<int>(reader.integer("max_port_retries", cfg.max_port_retries, 0, 1000));
+  cfg.port_retry_interval_ms = static_cast<int>(reader.integer("port_retry_interval_ms", cfg.port_retry_interval_ms,
+                                                               MIN_RETRY_INTERVAL_MS, MAX_RETRY_INTERVAL_MS));
+  return cfg;
+}
+
+config::SerialConfig parse_serial(FieldReader& reader) {
+  config::SerialConfig cfg;
+  cfg.device = reader.string("device", cfg.device);
+  cfg.baud_rate = static_cast<unsigned>(reader.integer("baud_rate", cfg.baud_rate, 1, 4000000));
+  cfg.char_size = static_cast<unsigned>(reader.integer("char_size", cfg.char_size, 5, 8));
+  cfg.stop_bits = static_cast<unsigned>(reader.integer("stop_bits", cfg.stop_bits, 1, 2));
+  cfg.retry_interval_ms = static_cast<unsigned>(
+      reader.integer("retry_interval_ms", cfg.retry_interval_ms, MIN_RETRY_INTERVAL_MS, MAX_RETRY_INTERVAL_MS));
+  cfg.max_retries = static_cast<int>(reader.integer("max_retries", cfg.max_retries, -1, MAX_RETRIES_LIMIT));
+  cfg.reopen_on_error = reader.boolean("reopen_on_error", cfg.reopen_on_error);
+  cfg.backpressure_threshold =
+      static_cast<size_t>(reader.integer("backpressure_threshold", static_cast<int64_t>(cfg.backpressure_threshold),
+                                         MIN_BACKPRESSURE_THRESHOLD, MAX_BACKPRESSURE_THRESHOLD));
+
+  std::string parity = reader.string("parity", "none");
+  if (parity == "none") {
+    cfg.parity = config::SerialConfig::Parity::None;
+  } else if (parity == "even") {
+    cfg.parity = config::SerialConfig::Parity::Even;
+  } else if (parity == "odd") {
+    cfg.parity = config::SerialConfig::Parity::Odd;
+  } else {
+    reader.fail("parity", "expected none, even or odd");
+  }
+
+  std::string flow = reader.string("flow", "none");
+  if (flow == "none") {
+    cfg.flow = config::SerialConfig::Flow::None;
+  } else if (flow == "software") {
+    cfg.flow = config::SerialConfig::Flow::Software;
+  } else if (flow == "hardware") {
+    cfg.flow = config::SerialConfig::Flow::Hardware;
+  } else {
+    reader.fail("flow", "expected none, software or hardware");
+  }
+
+  if (cfg.device.empty()) reader.fail("device", "must not be empty");
+  return cfg;
+}
+
+}  // namespace
+
+std::chrono::microseconds ProvisionReport::latency_percentile(double percentile) const {
+  std::vector<std::chrono::microseconds> latencies;
+  latencies.reserve(channels.size());
+  for (const auto& result : channels) {
+    if (result.ok()) latencies.push_back(result.startup_latency);
+  }
+  if (latencies.empty()) {
+    return std::chrono::microseconds(0);
+  }
+
+  // Nearest-rank percentile
+  percentile = std::clamp(percentile, 0.0, 100.0);
+  size_t rank = static_cast<size_t>(percentile / 100.0 * static_cast<double>(latencies.size()) + 0.5);
+  size_t index = std::min(rank == 0 ? 0 : rank - 1, latencies.size() - 1);
+  std::nth_element(latencies.begin(), latencies.begin() + static_cast<std::ptrdiff_t>(index), latencies.end());
+  return latencies[index];
+}
+
+ChannelProvisioner::ChannelProvisioner(common::IoContextPool& pool) : pool_(pool) {}
+
+std::vector<ChannelSpec> ChannelProvisioner::parse(const config::ConfigManagerInterface& config) {
+  // Group "channels.<name>.<field>" keys by channel name; names are sorted for a stable order
+  std::map<std::string, std::map<std::string, std::any>> groups;
+  const std::string prefix = CHANNEL_PREFIX;
+  for (const auto& key : config.get_keys()) {
+    if (key.compare(0, prefix.size(), prefix) != 0) continue;
+    size_t dot = key.find('.', prefix.size());
+    if (dot == std::string::npos || dot == prefix.size() || dot + 1 == key.size()) {
+      throw common::ConfigurationException("Malformed channel key: " + key, "channels", "parse");
+    }
+    groups[key.substr(prefix.size(), dot - prefix.size())][key.substr(dot + 1)] = config.get(key);
+  }
+
+  std::vector<ChannelSpec> specs;
+  specs.reserve(groups.size());
+  for (const auto& [name, fields] : groups) {
+    FieldReader reader(name, fields);
+    std::string type = reader.string("type", "");
+
+    ChannelSpec spec{name, config::TcpClientConfig{}};
+    if (type == "tcp_client") {
+      spec.options = parse_tcp_client(reader);
+    } else if (type == "tcp_server") {
+      spec.options = parse_tcp_server(reader);
+    } else if (type == "serial") {
+      spec.options = parse_serial(reader);
+    } else {
+      reader.fail("type", "expected tcp_client, tcp_server or serial");
+    }
+    reader.finish();
+    specs.push_back(std::move(spec));
+  }
+  return specs;
+}
+
+std::vector<ChannelSpec> ChannelProvisioner::load_file(const std::string& filepath) {
+  config::ConfigManager config;
+  if (!config.load_from_file(filepath)) {
+    throw common::ConfigurationException("Unable to read channel file: " + filepath, "channels", "load");
+  }
+  return parse(config);
+}
+
+ProvisionReport ChannelProvisioner::provision(const std::vector<ChannelSpec>& specs, ConfigureHandler configure) {
+  // Waiting below on a pool thread would block the context that has to run the posted work
+  for (size_t i = 0; i < pool_.size(); ++i) {
+    if (pool_.get_context(i).get_executor().running_in_this_thread()) {
+      throw std::logic_error("ChannelProvisioner::provision() must not be called from a pool thread");
+    }
+  }
+  pool_.start();  // No-op when already running
+
+  ProvisionReport report;
+  report.channels.resize(specs.size());
+  auto begin = std::chrono::steady_clock::now();
+
+  std::mutex done_mutex;
+  std::condition_variable done_cv;
+  size_t remaining = specs.size();
+
+  // Each channel is created and started on the context it will run on; the contexts work in parallel
+  for (size_t i = 0; i < specs.size(); ++i) {
+    auto& ioc = pool_.get_context(i);
+    boost::asio::post(ioc, [&, i] {
+      auto& result = report.channels[i];
+      result.name = specs[i].name;
+      try {
+        auto channel = ChannelFactory::create(specs[i].options, ioc);
+        if (configure) configure(result.name, *channel);
+        channel->start();
+        result.channel = std::move(channel);
+      } catch (const std::exception& e) {
+        result.error = e.what();
+      }
+      result.startup_latency =
+          std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+
+      std::lock_guard<std::mutex> lock(done_mutex);
+      if (--remaining == 0) done_cv.notify_one();
+    });
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(done_mutex);
+    done_cv.wait(lock, [&] { return remaining == 0; });
+  }
+  report.total_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+
+  for (const auto& result : report.channels) {
+    if (!result.ok()) {
+      ++report.failed;
+      UNILINK_LOG_ERROR("channel_provisioner", "provision", "Channel '" + result.name + "' failed: " + result.error);
+    }
+  }
+  UNILINK_LOG_INFO("channel_provisioner", "provision",
+                   "Started " + std::to_string(specs.size() - report.failed) + "/" + std::to_string(specs.size()) +
+                       " channels in " + std::to_string(report.total_time.count()) + "us");
+  return report;
+}
+
+}  // namespace factory
+}  // namespace unilink
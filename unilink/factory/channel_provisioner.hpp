@@ -0,0 +1,100 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "unilink/common/io_context_pool.hpp"
+#include "unilink/config/iconfig_manager.hpp"
+#include "unilink/factory/channel_factory.hpp"
+
+namespace unilink {
+namespace factory {
+
+/**
+ * One channel of a declarative fleet description
+ */
+struct ChannelSpec {
+  std::string name;
+  ChannelFactory::ChannelOptions options;
+};
+
+/**
+ * Outcome of provisioning one channel
+ */
+struct ProvisionResult {
+  std::string name;
+  std::shared_ptr<interface::Channel> channel;   // Null if creation failed
+  std::chrono::microseconds startup_latency{0};  // From provision() entry until the channel was started
+  std::string error;
+
+  bool ok() const { return channel != nullptr; }
+};
+
+/**
+ * Outcome of provisioning a fleet, in the order of the specs
+ */
+struct ProvisionReport {
+  std::vector<ProvisionResult> channels;
+  std::chrono::microseconds total_time{0};
+  size_t failed = 0;
+
+  // Startup latency at the given percentile (0-100) over successful channels
+  std::chrono::microseconds latency_percentile(double percentile) const;
+};
+
+/**
+ * Creates and starts many channels in parallel on a shared IoContextPool
+ *
+ * Each channel is created through ChannelFactory on one of the pool's
+ * contexts and started from that context's thread, so resolver, open and bind
+ * work of different channels overlaps instead of running one after another,
+ * and no channel starts a thread of its own.
+ *
+ * The declarative format is the ConfigManager key=value file, one group of
+ * keys per channel:
+ *
+ *   channels.<name>.type=tcp_client|tcp_server|serial
+ *   channels.<name>.host / port / retry_interval_ms / ...   (fields of the matching config struct)
+ */
+class ChannelProvisioner {
+ public:
+  // Invoked on the channel's executor before start(), e.g. to attach callbacks
+  using ConfigureHandler = std::function<void(const std::string& name, interface::Channel& channel)>;
+
+  explicit ChannelProvisioner(common::IoContextPool& pool);
+
+  // Parse channel specs; throws ConfigurationException on unknown types or invalid fields
+  static std::vector<ChannelSpec> parse(const config::ConfigManagerInterface& config);
+  static std::vector<ChannelSpec> load_file(const std::string& filepath);
+
+  /**
+   * @brief Create and start the channels, blocking until all of them are started
+   * @throws std::logic_error if called from one of the pool's threads, which would deadlock
+   */
+  ProvisionReport provision(const std::vector<ChannelSpec>& specs, ConfigureHandler configure = nullptr);
+
+ private:
+  common::IoContextPool& pool_;
+};
+
+}  // namespace factory
+}  // namespace unilink
@@ -16,8 +16,11 @@
 
 #pragma once
 #include <functional>
+#include <memory>
 
+#include "unilink/common/channel_metrics.hpp"
 #include "unilink/common/common.hpp"
+#include "unilink/common/loop_monitor.hpp"
 
 namespace unilink {
 namespace interface {
@@ -40,6 +43,13 @@ class Channel {
   virtual void on_bytes(OnBytes cb) = 0;
   virtual void on_state(OnState cb) = 0;
   virtual void on_backpressure(OnBackpressure cb) = 0;
+
+  // Data-plane counters and write latency; channels without metrics report zeros
+  virtual common::ChannelMetricsSnapshot metrics() const { return {}; }
+  // Opt-in enqueue-to-completion latency of queued writes, reported as metrics().queue_latency_ns
+  virtual void set_tx_latency_tracking(bool /*enabled*/) {}
+  // Probe the io_context this channel runs on while it is started; nullptr detaches
+  virtual void set_loop_monitor(std::shared_ptr<common::LoopMonitor> /*monitor*/) {}
 };
 }  // namespace interface
 }  // namespace unilink
\ No newline at end of file
@@ -16,11 +16,14 @@
 
 #include "unilink/transport/serial/serial.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 
+#include "unilink/common/async_tracer.hpp"
 #include "unilink/common/io_context_manager.hpp"
 #include "unilink/common/memory_pool.hpp"
+#include "unilink/common/tracepoints.hpp"
 #include "unilink/transport/serial/boost_serial_port.hpp"
 
 namespace unilink {
@@ -30,6 +33,7 @@ namespace net = boost::asio;
 
 // Use fully qualified names for clarity
 using namespace common;  // For error_reporting namespace
+using Track = AsyncTracer::Track;
 
 Serial::Serial(const config::SerialConfig& cfg)
     : ioc_(common::IoContextManager::instance().get_context()),
@@ -40,6 +44,7 @@ Serial::Serial(const config::SerialConfig& cfg)
   // Validate and clamp configuration
   cfg_.validate_and_clamp();
   bp_high_ = cfg_.backpressure_threshold;
+  retry_interval_ms_ = cfg_.retry_interval_ms;
 
   rx_.resize(cfg_.read_chunk);
   port_ = std::make_unique<BoostSerialPort>(ioc_);
@@ -56,6 +61,7 @@ Serial::Serial(const SerialConfig& cfg, std::unique_ptr<interface::SerialPortInt
   // Validate and clamp configuration
   cfg_.validate_and_clamp();
   bp_high_ = cfg_.backpressure_threshold;
+  retry_interval_ms_ = cfg_.retry_interval_ms;
 
   rx_.resize(cfg_.read_chunk);
 }
@@ -74,25 +80,37 @@ void Serial::start() {
   if (owns_ioc_) {
     ioc_thread_ = std::thread([this] { ioc_.run(); });
   }
+  if (loop_monitor_) loop_monitor_->start(ioc_);
+  if (AsyncTracer::enabled()) AsyncTracer::instance().name_channel(this, "serial " + cfg_.device);
   net::post(ioc_, [this] {
     UNILINK_LOG_DEBUG("serial", "start", "Posting open_and_configure for device: " + cfg_.device);
     state_.set_state(common::LinkState::Connecting);
     notify_state();
+    AsyncTracer::begin(this, Track::Lifecycle, "open");
     open_and_configure();
+    AsyncTracer::end(this, Track::Lifecycle, "open");
   });
 }
 
 void Serial::stop() {
   if (!state_.is_state(common::LinkState::Closed)) {
-    work_guard_->reset();  // Allow the io_context to run out of work.
-    net::post(ioc_, [this] {
-      // Cancel all pending async operations to unblock the io_context
+    if (loop_monitor_) loop_monitor_->stop();
+    if (work_guard_) work_guard_->reset();  // Allow the io_context to run out of work.
+    auto self = owns_ioc_ ? nullptr : weak_from_this().lock();
+    if (!owns_ioc_ && !self) {
+      // Being destroyed on a caller-run context: nothing may touch this object later
       retry_timer_.cancel();
       close_port();
-      // Post stop() to ensure it's the last thing to run before the context
-      // runs out of work.
-      ioc_.stop();
-    });
+    } else {
+      net::post(ioc_, [this, self] {
+        // Cancel all pending async operations to unblock the io_context
+        retry_timer_.cancel();
+        close_port();
+        // Post stop() to ensure it's the last thing to run before the context
+        // runs out of work. A caller-run context is shared with other channels and keeps running.
+        if (owns_ioc_) ioc_.stop();
+      });
+    }
 
     // Wait for all async operations to complete
     if (owns_ioc_ && ioc_thread_.joinable()) {
@@ -121,8 +139,15 @@ void Serial::async_write_copy(const uint8_t* data, size_t n) {
 
       net::post(ioc_, [self = shared_from_this(), buf = std::move(pooled_buffer)]() mutable {
         self->queued_bytes_ += buf.size();
+        AsyncTracer::counter(self.get(), "queued_bytes", self->queued_bytes_);
+        self->metrics_.record_enqueue(buf.size());
+        self->tx_latency_.on_enqueue();
         self->tx_.emplace_back(std::move(buf));
-        if (self->on_bp_ && self->queued_bytes_ > self->bp_high_) self->on_bp_(self->queued_bytes_);
+        if (self->queued_bytes_ > self->bp_high_) {
+          self->metrics_.record_backpressure();
+          UNILINK_TRACE2(backpressure, self.get(), self->queued_bytes_);
+          if (self->on_bp_) self->on_bp_(self->queued_bytes_);
+        }
         if (!self->writing_) self->do_write();
       });
       return;
@@ -134,8 +159,15 @@ void Serial::async_write_copy(const uint8_t* data, size_t n) {
 
   net::post(ioc_, [self = shared_from_this(), buf = std::move(fallback)]() mutable {
     self->queued_bytes_ += buf.size();
+    AsyncTracer::counter(self.get(), "queued_bytes", self->queued_bytes_);
+    self->metrics_.record_enqueue(buf.size());
+    self->tx_latency_.on_enqueue();
     self->tx_.emplace_back(std::move(buf));
-    if (self->on_bp_ && self->queued_bytes_ > self->bp_high_) self->on_bp_(self->queued_bytes_);
+    if (self->queued_bytes_ > self->bp_high_) {
+      self->metrics_.record_backpressure();
+      UNILINK_TRACE2(backpressure, self.get(), self->queued_bytes_);
+      if (self->on_bp_) self->on_bp_(self->queued_bytes_);
+    }
     if (!self->writing_) self->do_write();
   });
 }
@@ -143,12 +175,24 @@ void Serial::async_write_copy(const uint8_t* data, size_t n) {
 void Serial::on_bytes(OnBytes cb) { on_bytes_ = std::move(cb); }
 void Serial::on_state(OnState cb) { on_state_ = std::move(cb); }
 void Serial::on_backpressure(OnBackpressure cb) { on_bp_ = std::move(cb); }
+common::ChannelMetricsSnapshot Serial::metrics() const { return metrics_.snapshot(); }
+void Serial::set_tx_latency_tracking(bool enabled) {
+  post_config([this, enabled] { tx_latency_.set_enabled(enabled, tx_.size()); });
+}
+
+void Serial::set_loop_monitor(std::shared_ptr<common::LoopMonitor> monitor) {
+  if (loop_monitor_) loop_monitor_->stop();
+  loop_monitor_ = std::move(monitor);
+  if (loop_monitor_) loop_monitor_->start(ioc_);
+}
 
 void Serial::open_and_configure() {
   boost::system::error_code ec;
   port_->open(cfg_.device, ec);
   if (ec) {
-    UNILINK_LOG_ERROR("serial", "open", "Failed to open device: " + cfg_.device + " - " + ec.message());
+    UNILINK_LOG_RATE_LIMITED(LogLevel::ERROR, "serial", "open", constants::ERROR_LOG_RATE_PER_SECOND,
+                             constants::ERROR_LOG_BURST,
+                             "Failed to open device: " + cfg_.device + " - " + ec.message());
     handle_error("open", ec);
     return;
   }
@@ -208,17 +252,22 @@ void Serial::open_and_configure() {
   start_read();
 
   opened_ = true;
+  metrics_.record_connect();
   state_.set_state(common::LinkState::Connected);
   notify_state();
 }
 
 void Serial::start_read() {
   auto self = shared_from_this();
+  AsyncTracer::begin(this, Track::Read, "read");
   port_->async_read_some(net::buffer(rx_.data(), rx_.size()), [self](auto ec, std::size_t n) {
+    AsyncTracer::end(self.get(), Track::Read, "read");
     if (ec) {
       self->handle_error("read", ec);
       return;
     }
+    self->metrics_.record_read(n);
+    UNILINK_TRACE2(read, self.get(), n);
     if (self->on_bytes_) self->on_bytes_(self->rx_.data(), n);
     self->start_read();
   });
@@ -231,28 +280,44 @@ void Serial::do_write() {
   }
   writing_ = true;
   auto self = shared_from_this();
+  auto started = common::ChannelMetrics::now();
+  AsyncTracer::begin(this, Track::Write, "write");
 
   // Handle both PooledBuffer and std::vector<uint8_t> (fallback)
   auto& front_buffer = tx_.front();
   if (std::holds_alternative<common::PooledBuffer>(front_buffer)) {
     auto& pooled_buf = std::get<common::PooledBuffer>(front_buffer);
-    port_->async_write(net::buffer(pooled_buf.data(), pooled_buf.size()), [self](auto ec, std::size_t n) {
+    UNILINK_TRACE3(write_start, this, pooled_buf.size(), queued_bytes_);
+    port_->async_write(net::buffer(pooled_buf.data(), pooled_buf.size()), [self, started](auto ec, std::size_t n) {
+      AsyncTracer::end(self.get(), Track::Write, "write");
       self->queued_bytes_ -= n;
+      AsyncTracer::counter(self.get(), "queued_bytes", self->queued_bytes_);
+      self->metrics_.record_dequeue(n);
       if (ec) {
         self->handle_error("write", ec);
         return;
       }
+      self->metrics_.record_write(n, started);
+      UNILINK_TRACE3(write_done, self.get(), n, self->queued_bytes_);
+      self->tx_latency_.on_complete(self->metrics_);
       self->tx_.pop_front();
       self->do_write();
     });
   } else {
     auto& vec_buf = std::get<std::vector<uint8_t>>(front_buffer);
-    port_->async_write(net::buffer(vec_buf), [self](auto ec, std::size_t n) {
+    UNILINK_TRACE3(write_start, this, vec_buf.size(), queued_bytes_);
+    port_->async_write(net::buffer(vec_buf), [self, started](auto ec, std::size_t n) {
+      AsyncTracer::end(self.get(), Track::Write, "write");
       self->queued_bytes_ -= n;
+      AsyncTracer::counter(self.get(), "queued_bytes", self->queued_bytes_);
+      self->metrics_.record_dequeue(n);
       if (ec) {
         self->handle_error("write", ec);
         return;
       }
+      self->metrics_.record_write(n, started);
+      UNILINK_TRACE3(write_done, self.get(), n, self->queued_bytes_);
+      self->tx_latency_.on_complete(self->metrics_);
       self->tx_.pop_front();
       self->do_write();
     });
@@ -271,8 +336,12 @@ void Serial::handle_error(const char* where, const boost::system::error_code& ec
   bool retryable = cfg_.reopen_on_error;
   common::error_reporting::report_connection_error("serial", where, ec, retryable);
 
-  UNILINK_LOG_ERROR("serial", where, "Error: " + ec.message() + " (code: " + std::to_string(ec.value()) + ")");
+  UNILINK_LOG_RATE_LIMITED(LogLevel::ERROR, "serial", "error", constants::ERROR_LOG_RATE_PER_SECOND,
+                           constants::ERROR_LOG_BURST,
+                           std::string(where) + " error: " + ec.message() + " (code: " + std::to_string(ec.value()) +
+                               ")");
 
+  if (opened_) metrics_.record_disconnect();
   if (cfg_.reopen_on_error) {
     opened_ = false;
     close_port();
@@ -288,17 +357,46 @@ void Serial::handle_error(const char* where, const boost::system::error_code& ec
 }
 
 void Serial::schedule_retry(const char* where, const boost::system::error_code& ec) {
-  UNILINK_LOG_INFO("serial", "retry",
-                   "Scheduling retry after " + std::to_string(cfg_.retry_interval_ms / 1000.0) + "s at " + where +
-                       " (" + ec.message() + ")");
+  const unsigned interval_ms = retry_interval_ms_.load();
+  UNILINK_LOG_RATE_LIMITED(LogLevel::INFO, "serial", "retry", constants::RETRY_LOG_RATE_PER_SECOND,
+                           constants::RETRY_LOG_BURST,
+                           "Scheduling retry after " + std::to_string(interval_ms / 1000.0) + "s at " +
+                               where + " (" + ec.message() + ")");
+  metrics_.record_reconnect_attempt();
+  UNILINK_TRACE2(retry, this, interval_ms);
   auto self = shared_from_this();
-  retry_timer_.expires_after(std::chrono::milliseconds(cfg_.retry_interval_ms));
+  AsyncTracer::begin(this, Track::Lifecycle, "retry_wait");
+  retry_timer_.expires_after(std::chrono::milliseconds(interval_ms));
   retry_timer_.async_wait([self](auto e) {
-    if (!e) self->open_and_configure();
+    AsyncTracer::end(self.get(), Track::Lifecycle, "retry_wait");
+    if (e) return;
+    AsyncTracer::begin(self.get(), Track::Lifecycle, "open");
+    self->open_and_configure();
+    AsyncTracer::end(self.get(), Track::Lifecycle, "open");
   });
 }
 
-void Serial::set_retry_interval(unsigned interval_ms) { cfg_.retry_interval_ms = interval_ms; }
+void Serial::set_retry_interval(unsigned interval_ms) { retry_interval_ms_.store(interval_ms); }
+
+void Serial::set_backpressure_threshold(size_t threshold) {
+  threshold = std::clamp(threshold, common::constants::MIN_BACKPRESSURE_THRESHOLD,
+                         common::constants::MAX_BACKPRESSURE_THRESHOLD);
+  post_config([this, threshold] {
+    cfg_.backpressure_threshold = threshold;
+    bp_high_ = threshold;
+  });
+}
+
+void Serial::post_config(std::function<void()> apply) {
+  auto weak = weak_from_this();
+  if (weak.expired()) {
+    apply();  // Not owned by a shared_ptr, so there is no handler lifetime to tie the update to
+    return;
+  }
+  net::post(ioc_, [weak, apply = std::move(apply)] {
+    if (auto self = weak.lock()) apply();
+  });
+}
 
 void Serial::close_port() {
   boost::system::error_code ec;
@@ -310,9 +408,11 @@ void Serial::close_port() {
 }
 
 void Serial::notify_state() {
+  auto state = state_.get_state();
+  UNILINK_TRACE2(state, this, static_cast<int>(state));
   if (on_state_) {
     try {
-      on_state_(state_.get_state());
+      on_state_(state);
     } catch (const std::exception& e) {
       UNILINK_LOG_ERROR("serial", "callback", "State callback error: " + std::string(e.what()));
       common::error_reporting::report_system_error("serial", "state_callback",
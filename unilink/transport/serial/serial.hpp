@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <boost/asio.hpp>
 #include <cstddef>
 #include <deque>
@@ -25,6 +26,7 @@
 #include <variant>
 #include <vector>
 
+#include "unilink/common/channel_metrics.hpp"
 #include "unilink/common/constants.hpp"
 #include "unilink/common/error_handler.hpp"
 #include "unilink/common/logger.hpp"
@@ -61,9 +63,13 @@ class Serial : public Channel, public std::enable_shared_from_this<Serial> {
   void on_bytes(OnBytes cb) override;
   void on_state(OnState cb) override;
   void on_backpressure(OnBackpressure cb) override;
+  common::ChannelMetricsSnapshot metrics() const override;
+  void set_tx_latency_tracking(bool enabled) override;
+  void set_loop_monitor(std::shared_ptr<common::LoopMonitor> monitor) override;
 
-  // Dynamic configuration methods
+  // Dynamic configuration methods (applied on the port's executor, the port stays open)
   void set_retry_interval(unsigned interval_ms);
+  void set_backpressure_threshold(size_t threshold);
 
  private:
   void open_and_configure();
@@ -73,6 +79,7 @@ class Serial : public Channel, public std::enable_shared_from_this<Serial> {
   void schedule_retry(const char* where, const boost::system::error_code&);
   void close_port();
   void notify_state();
+  void post_config(std::function<void()> apply);
 
  private:
   net::io_context& ioc_;
@@ -83,12 +90,16 @@ class Serial : public Channel, public std::enable_shared_from_this<Serial> {
   std::unique_ptr<interface::SerialPortInterface> port_;
   SerialConfig cfg_;
   net::steady_timer retry_timer_;
+  std::atomic<unsigned> retry_interval_ms_{0};  // Settable from any thread
 
   std::vector<uint8_t> rx_;
   std::deque<std::variant<common::PooledBuffer, std::vector<uint8_t>>> tx_;
   bool writing_ = false;
   size_t queued_bytes_ = 0;
   size_t bp_high_;  // Configurable backpressure threshold
+  common::ChannelMetrics metrics_;
+  common::TxLatencyTracker tx_latency_;
+  std::shared_ptr<common::LoopMonitor> loop_monitor_;
 
   OnBytes on_bytes_;
   OnState on_state_;
@@ -16,11 +16,14 @@
 
 #include "unilink/transport/tcp_client/tcp_client.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 
+#include "unilink/common/async_tracer.hpp"
 #include "unilink/common/io_context_manager.hpp"
 #include "unilink/common/memory_pool.hpp"
+#include "unilink/common/tracepoints.hpp"
 
 namespace unilink {
 namespace transport {
@@ -35,27 +38,31 @@ using common::ThreadSafeLinkState;
 using config::TcpClientConfig;
 using interface::Channel;
 using namespace common;  // For error_reporting namespace
+using Track = AsyncTracer::Track;
 
 TcpClient::TcpClient(const TcpClientConfig& cfg)
-    : ioc_(std::make_unique<net::io_context>()),
-      resolver_(*ioc_),
-      socket_(*ioc_),
-      cfg_(cfg),
-      retry_timer_(*ioc_),
+    : owned_ioc_(std::make_unique<net::io_context>()),
       owns_ioc_(true),
+      ioc_(*owned_ioc_),
+      resolver_(ioc_),
+      socket_(ioc_),
+      cfg_(cfg),
+      retry_timer_(ioc_),
       bp_high_(cfg.backpressure_threshold) {
   // Validate and clamp configuration
   cfg_.validate_and_clamp();
   bp_high_ = cfg_.backpressure_threshold;
+  retry_interval_ms_ = cfg_.retry_interval_ms;
 }
 
 TcpClient::TcpClient(const TcpClientConfig& cfg, net::io_context& ioc)
-    : ioc_(nullptr),
+    : owned_ioc_(nullptr),
+      owns_ioc_(false),
+      ioc_(ioc),
       resolver_(ioc),
       socket_(ioc),
       cfg_(cfg),
       retry_timer_(ioc),
-      owns_ioc_(false),
       bp_high_(cfg.backpressure_threshold) {
   // Initialize state (ThreadSafeLinkState is already initialized in header)
   connected_ = false;
@@ -65,6 +72,7 @@ TcpClient::TcpClient(const TcpClientConfig& cfg, net::io_context& ioc)
   // Validate and clamp configuration
   cfg_.validate_and_clamp();
   bp_high_ = cfg_.backpressure_threshold;
+  retry_interval_ms_ = cfg_.retry_interval_ms;
 }
 
 TcpClient::~TcpClient() {
@@ -82,9 +90,9 @@ TcpClient::~TcpClient() {
   writing_ = false;
 
   // Clean up thread if still running and we own the io_context
-  if (owns_ioc_ && ioc_ && ioc_thread_.joinable()) {
+  if (owns_ioc_ && ioc_thread_.joinable()) {
     try {
-      ioc_->stop();
+      ioc_.stop();
       ioc_thread_.join();
     } catch (const std::exception& e) {
       UNILINK_LOG_ERROR("tcp_client", "destructor", "Destructor error: " + std::string(e.what()));
@@ -100,11 +108,11 @@ TcpClient::~TcpClient() {
 }
 
 void TcpClient::start() {
-  if (owns_ioc_ && ioc_) {
+  if (owns_ioc_) {
     // Create our own thread for this io_context
     ioc_thread_ = std::thread([this]() {
       try {
-        ioc_->run();
+        ioc_.run();
       } catch (const std::exception& e) {
         UNILINK_LOG_ERROR("tcp_client", "io_context", "IO context error: " + std::string(e.what()));
         error_reporting::report_system_error("tcp_client", "io_context",
@@ -113,39 +121,43 @@ void TcpClient::start() {
     });
   }
 
-  if (ioc_) {
-    net::post(*ioc_, [this] {
-      state_.set_state(LinkState::Connecting);
-      notify_state();
-      do_resolve_connect();
-    });
+  if (loop_monitor_) loop_monitor_->start(ioc_);
+  if (AsyncTracer::enabled()) {
+    AsyncTracer::instance().name_channel(this, "tcp_client " + cfg_.host + ":" + std::to_string(cfg_.port));
   }
+
+  net::post(ioc_, [this, self = shared_handle()] {
+    state_.set_state(LinkState::Connecting);
+    notify_state();
+    do_resolve_connect();
+  });
 }
 
 void TcpClient::stop() {
   // Set state to closed first to prevent new operations
   state_.set_state(LinkState::Closed);
+  if (loop_monitor_) loop_monitor_->stop();
 
   // Post cleanup work to io_context
-  if (ioc_) {
-    net::post(*ioc_, [this] {
-      try {
-        retry_timer_.cancel();
-        close_socket();
-        // Clear any pending write operations
-        tx_.clear();
-        queue_bytes_ = 0;
-        writing_ = false;
-      } catch (...) {
-        // Ignore exceptions during cleanup
-      }
-    });
-  }
+  net::post(ioc_, [this, self = shared_handle()] {
+    try {
+      retry_timer_.cancel();
+      close_socket();
+      // Clear any pending write operations
+      metrics_.record_dequeue(queue_bytes_);
+      tx_latency_.clear();
+      tx_.clear();
+      queue_bytes_ = 0;
+      writing_ = false;
+    } catch (...) {
+      // Ignore exceptions during cleanup
+    }
+  });
 
   // Stop io_context and wait for thread to finish only if we own it
-  if (owns_ioc_ && ioc_ && ioc_thread_.joinable()) {
+  if (owns_ioc_ && ioc_thread_.joinable()) {
     try {
-      ioc_->stop();
+      ioc_.stop();
       ioc_thread_.join();
     } catch (const std::exception& e) {
       UNILINK_LOG_ERROR("tcp_client", "stop", "Stop error: " + std::string(e.what()));
@@ -172,7 +184,7 @@ bool TcpClient::is_connected() const { return connected_; }
 
 void TcpClient::async_write_copy(const uint8_t* data, size_t size) {
   // Don't queue writes if client is stopped or in error state
-  if (state_.is_state(LinkState::Closed) || state_.is_state(LinkState::Error) || !ioc_) {
+  if (state_.is_state(LinkState::Closed) || state_.is_state(LinkState::Error)) {
     return;
   }
 
@@ -183,16 +195,23 @@ void TcpClient::async_write_copy(const uint8_t* data, size_t size) {
       // Copy data to pooled buffer safely
       common::safe_memory::safe_memcpy(pooled_buffer.data(), data, size);
 
-      net::post(*ioc_, [self = shared_from_this(), buf = std::move(pooled_buffer)]() mutable {
+      net::post(ioc_, [self = shared_from_this(), buf = std::move(pooled_buffer)]() mutable {
         // Double-check state in case client was stopped while in queue
         if (self->state_.is_state(LinkState::Closed) || self->state_.is_state(LinkState::Error)) {
           return;
         }
 
         self->queue_bytes_ += buf.size();
+        AsyncTracer::counter(self.get(), "queued_bytes", self->queue_bytes_);
+        self->metrics_.record_enqueue(buf.size());
+        self->tx_latency_.on_enqueue();
         self->tx_.emplace_back(std::move(buf));
-        if (self->on_bp_ && self->queue_bytes_ > self->bp_high_) self->on_bp_(self->queue_bytes_);
-        self->do_write();
+        if (self->queue_bytes_ > self->bp_high_) {
+          self->metrics_.record_backpressure();
+          UNILINK_TRACE2(backpressure, self.get(), self->queue_bytes_);
+          if (self->on_bp_) self->on_bp_(self->queue_bytes_);
+        }
+        if (!self->writing_) self->do_write();
       });
       return;
     }
@@ -201,15 +220,22 @@ void TcpClient::async_write_copy(const uint8_t* data, size_t size) {
   // Fallback to regular allocation for large buffers or pool exhaustion
   std::vector<uint8_t> fallback(data, data + size);
 
-  net::post(*ioc_, [self = shared_from_this(), buf = std::move(fallback)]() mutable {
+  net::post(ioc_, [self = shared_from_this(), buf = std::move(fallback)]() mutable {
     // Double-check state in case client was stopped while in queue
     if (self->state_.is_state(LinkState::Closed) || self->state_.is_state(LinkState::Error)) {
       return;
     }
 
     self->queue_bytes_ += buf.size();
+    AsyncTracer::counter(self.get(), "queued_bytes", self->queue_bytes_);
+    self->metrics_.record_enqueue(buf.size());
+    self->tx_latency_.on_enqueue();
     self->tx_.emplace_back(std::move(buf));
-    if (self->on_bp_ && self->queue_bytes_ > self->bp_high_) self->on_bp_(self->queue_bytes_);
+    if (self->queue_bytes_ > self->bp_high_) {
+      self->metrics_.record_backpressure();
+      UNILINK_TRACE2(backpressure, self.get(), self->queue_bytes_);
+      if (self->on_bp_) self->on_bp_(self->queue_bytes_);
+    }
     if (!self->writing_) self->do_write();
   });
 }
@@ -217,20 +243,35 @@ void TcpClient::async_write_copy(const uint8_t* data, size_t size) {
 void TcpClient::on_bytes(OnBytes cb) { on_bytes_ = std::move(cb); }
 void TcpClient::on_state(OnState cb) { on_state_ = std::move(cb); }
 void TcpClient::on_backpressure(OnBackpressure cb) { on_bp_ = std::move(cb); }
+common::ChannelMetricsSnapshot TcpClient::metrics() const { return metrics_.snapshot(); }
+void TcpClient::set_tx_latency_tracking(bool enabled) {
+  post_config([this, enabled] { tx_latency_.set_enabled(enabled, tx_.size()); });
+}
+
+void TcpClient::set_loop_monitor(std::shared_ptr<common::LoopMonitor> monitor) {
+  if (loop_monitor_) loop_monitor_->stop();
+  loop_monitor_ = std::move(monitor);
+  if (loop_monitor_) loop_monitor_->start(ioc_);
+}
 
 void TcpClient::do_resolve_connect() {
   auto self = shared_from_this();
+  AsyncTracer::begin(this, Track::Lifecycle, "resolve");
   resolver_.async_resolve(cfg_.host, std::to_string(cfg_.port), [self](auto ec, tcp::resolver::results_type results) {
+    AsyncTracer::end(self.get(), Track::Lifecycle, "resolve");
     if (ec) {
       self->schedule_retry();
       return;
     }
+    AsyncTracer::begin(self.get(), Track::Lifecycle, "connect");
     net::async_connect(self->socket_, results, [self](auto ec2, const auto&) {
+      AsyncTracer::end(self.get(), Track::Lifecycle, "connect");
       if (ec2) {
         self->schedule_retry();
         return;
       }
       self->connected_ = true;
+      self->metrics_.record_connect();
       self->state_.set_state(LinkState::Connected);
       self->notify_state();
       boost::system::error_code ep_ec;
@@ -245,29 +286,66 @@ void TcpClient::do_resolve_connect() {
 }
 
 void TcpClient::schedule_retry() {
+  const unsigned interval_ms = retry_interval_ms_.load();
   connected_ = false;
+  metrics_.record_reconnect_attempt();
+  UNILINK_TRACE2(retry, this, interval_ms);
   state_.set_state(LinkState::Connecting);
   notify_state();
 
-  UNILINK_LOG_INFO("tcp_client", "retry",
-                   "Scheduling retry in " + std::to_string(cfg_.retry_interval_ms / 1000.0) + "s");
+  UNILINK_LOG_RATE_LIMITED(LogLevel::INFO, "tcp_client", "retry", constants::RETRY_LOG_RATE_PER_SECOND,
+                           constants::RETRY_LOG_BURST,
+                           "Scheduling retry in " + std::to_string(interval_ms / 1000.0) + "s");
 
   auto self = shared_from_this();
-  retry_timer_.expires_after(std::chrono::milliseconds(cfg_.retry_interval_ms));
+  AsyncTracer::begin(this, Track::Lifecycle, "retry_wait");
+  retry_timer_.expires_after(std::chrono::milliseconds(interval_ms));
   retry_timer_.async_wait([self](const boost::system::error_code& ec) {
+    AsyncTracer::end(self.get(), Track::Lifecycle, "retry_wait");
     if (!ec) self->do_resolve_connect();
   });
 }
 
-void TcpClient::set_retry_interval(unsigned interval_ms) { cfg_.retry_interval_ms = interval_ms; }
+void TcpClient::set_retry_interval(unsigned interval_ms) { retry_interval_ms_.store(interval_ms); }
+
+void TcpClient::set_backpressure_threshold(size_t threshold) {
+  threshold = std::clamp(threshold, common::constants::MIN_BACKPRESSURE_THRESHOLD,
+                         common::constants::MAX_BACKPRESSURE_THRESHOLD);
+  post_config([this, threshold] {
+    cfg_.backpressure_threshold = threshold;
+    bp_high_ = threshold;
+  });
+}
+
+std::shared_ptr<TcpClient> TcpClient::shared_handle() {
+  // An owned io_context may be stopped with handlers still queued; holding a reference there would leak
+  // the client through its own context. A shared context keeps running, so the handler keeps us alive.
+  return owns_ioc_ ? nullptr : weak_from_this().lock();
+}
+
+void TcpClient::post_config(std::function<void()> apply) {
+  auto weak = weak_from_this();
+  if (weak.expired()) {
+    apply();  // Not owned by a shared_ptr, so there is no handler lifetime to tie the update to
+    return;
+  }
+  // Settings are only read by handlers on this executor, so applying here needs no lock
+  net::post(retry_timer_.get_executor(), [weak, apply = std::move(apply)] {
+    if (auto self = weak.lock()) apply();
+  });
+}
 
 void TcpClient::start_read() {
   auto self = shared_from_this();
+  AsyncTracer::begin(this, Track::Read, "read");
   socket_.async_read_some(net::buffer(rx_.data(), rx_.size()), [self](auto ec, std::size_t n) {
+    AsyncTracer::end(self.get(), Track::Read, "read");
     if (ec) {
       self->handle_close();
       return;
     }
+    self->metrics_.record_read(n);
+    UNILINK_TRACE2(read, self.get(), n);
     if (self->on_bytes_) self->on_bytes_(self->rx_.data(), n);
     self->start_read();
   });
@@ -280,38 +358,55 @@ void TcpClient::do_write() {
   }
   writing_ = true;
   auto self = shared_from_this();
+  auto started = common::ChannelMetrics::now();
+  AsyncTracer::begin(this, Track::Write, "write");
 
   // Handle both PooledBuffer and std::vector<uint8_t> (fallback)
   auto& front_buffer = tx_.front();
   if (std::holds_alternative<common::PooledBuffer>(front_buffer)) {
     auto& pooled_buf = std::get<common::PooledBuffer>(front_buffer);
-    net::async_write(socket_, net::buffer(pooled_buf.data(), pooled_buf.size()), [self](auto ec, std::size_t n) {
+    auto buffer = net::buffer(pooled_buf.data(), pooled_buf.size());
+    UNILINK_TRACE3(write_start, this, pooled_buf.size(), queue_bytes_);
+    net::async_write(socket_, buffer, [self, started](auto ec, std::size_t n) {
+      AsyncTracer::end(self.get(), Track::Write, "write");
       if (self->state_.is_state(LinkState::Closed) || self->state_.is_state(LinkState::Error)) {
         self->writing_ = false;
         return;
       }
 
       self->queue_bytes_ -= n;
+      AsyncTracer::counter(self.get(), "queued_bytes", self->queue_bytes_);
+      self->metrics_.record_dequeue(n);
       if (ec) {
         self->handle_close();
         return;
       }
+      self->metrics_.record_write(n, started);
+      UNILINK_TRACE3(write_done, self.get(), n, self->queue_bytes_);
+      self->tx_latency_.on_complete(self->metrics_);
       self->tx_.pop_front();
       self->do_write();
     });
   } else {
     auto& vec_buf = std::get<std::vector<uint8_t>>(front_buffer);
-    net::async_write(socket_, net::buffer(vec_buf), [self](auto ec, std::size_t n) {
+    UNILINK_TRACE3(write_start, this, vec_buf.size(), queue_bytes_);
+    net::async_write(socket_, net::buffer(vec_buf), [self, started](auto ec, std::size_t n) {
+      AsyncTracer::end(self.get(), Track::Write, "write");
       if (self->state_.is_state(LinkState::Closed) || self->state_.is_state(LinkState::Error)) {
         self->writing_ = false;
         return;
       }
 
       self->queue_bytes_ -= n;
+      AsyncTracer::counter(self.get(), "queued_bytes", self->queue_bytes_);
+      self->metrics_.record_dequeue(n);
       if (ec) {
         self->handle_close();
         return;
       }
+      self->metrics_.record_write(n, started);
+      UNILINK_TRACE3(write_done, self.get(), n, self->queue_bytes_);
+      self->tx_latency_.on_complete(self->metrics_);
       self->tx_.pop_front();
       self->do_write();
     });
@@ -320,6 +415,7 @@ void TcpClient::do_write() {
 
 void TcpClient::handle_close() {
   connected_ = false;
+  metrics_.record_disconnect();
   close_socket();
   state_.set_state(LinkState::Connecting);
   notify_state();
@@ -333,7 +429,9 @@ void TcpClient::close_socket() {
 }
 
 void TcpClient::notify_state() {
-  if (on_state_) on_state_(state_.get_state());
+  auto state = state_.get_state();
+  UNILINK_TRACE2(state, this, static_cast<int>(state));
+  if (on_state_) on_state_(state);
 }
 }  // namespace transport
 }  // namespace unilink
\ No newline at end of file
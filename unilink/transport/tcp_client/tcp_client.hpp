@@ -17,6 +17,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <boost/asio.hpp>
 #include <cstdint>
 #include <deque>
@@ -26,6 +27,7 @@
 #include <variant>
 #include <vector>
 
+#include "unilink/common/channel_metrics.hpp"
 #include "unilink/common/constants.hpp"
 #include "unilink/common/error_handler.hpp"
 #include "unilink/common/logger.hpp"
@@ -61,9 +63,13 @@ class TcpClient : public Channel, public std::enable_shared_from_this<TcpClient>
   void on_bytes(OnBytes cb) override;
   void on_state(OnState cb) override;
   void on_backpressure(OnBackpressure cb) override;
+  common::ChannelMetricsSnapshot metrics() const override;
+  void set_tx_latency_tracking(bool enabled) override;
+  void set_loop_monitor(std::shared_ptr<common::LoopMonitor> monitor) override;
 
-  // Dynamic configuration methods
+  // Dynamic configuration methods (applied on the client's executor, the connection is kept)
   void set_retry_interval(unsigned interval_ms);
+  void set_backpressure_threshold(size_t threshold);
 
  private:
   void do_resolve_connect();
@@ -73,21 +79,28 @@ class TcpClient : public Channel, public std::enable_shared_from_this<TcpClient>
   void handle_close();
   void close_socket();
   void notify_state();
+  void post_config(std::function<void()> apply);
+  std::shared_ptr<TcpClient> shared_handle();
 
  private:
-  std::unique_ptr<net::io_context> ioc_;
+  std::unique_ptr<net::io_context> owned_ioc_;
+  bool owns_ioc_ = true;
+  net::io_context& ioc_;
   std::thread ioc_thread_;
   tcp::resolver resolver_;
   tcp::socket socket_;
   TcpClientConfig cfg_;
   net::steady_timer retry_timer_;
-  bool owns_ioc_ = true;
+  std::atomic<unsigned> retry_interval_ms_{0};  // Settable from any thread
 
   std::array<uint8_t, common::constants::DEFAULT_READ_BUFFER_SIZE> rx_{};
   std::deque<std::variant<common::PooledBuffer, std::vector<uint8_t>>> tx_;
   bool writing_ = false;
   size_t queue_bytes_ = 0;
   size_t bp_high_;  // Configurable backpressure threshold
+  common::ChannelMetrics metrics_;
+  common::TxLatencyTracker tx_latency_;
+  std::shared_ptr<common::LoopMonitor> loop_monitor_;
 
   OnBytes on_bytes_;
   OnState on_state_;
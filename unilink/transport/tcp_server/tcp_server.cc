@@ -16,10 +16,13 @@
 
 #include "unilink/transport/tcp_server/tcp_server.hpp"
 
+#include <algorithm>
 #include <future>
 #include <iostream>
 
+#include "unilink/common/async_tracer.hpp"
 #include "unilink/common/io_context_manager.hpp"
+#include "unilink/common/tracepoints.hpp"
 #include "unilink/transport/tcp_server/boost_tcp_acceptor.hpp"
 
 namespace unilink {
@@ -27,6 +30,7 @@ namespace transport {
 
 namespace net = boost::asio;
 using tcp = net::ip::tcp;
+using Track = common::AsyncTracer::Track;
 
 TcpServer::TcpServer(const config::TcpServerConfig& cfg)
     : owned_ioc_(nullptr),
@@ -82,11 +86,16 @@ void TcpServer::start() {
   if (owns_ioc_) {
     ioc_thread_ = std::thread([this] { ioc_.run(); });
   }
+  if (loop_monitor_) loop_monitor_->start(ioc_);
+  if (common::AsyncTracer::enabled()) {
+    common::AsyncTracer::instance().name_channel(this, "tcp_server :" + std::to_string(cfg_.port));
+  }
   auto self = shared_from_this();
   net::post(ioc_, [self] { self->attempt_port_binding(0); });
 }
 
 void TcpServer::stop() {
+  if (loop_monitor_) loop_monitor_->stop();
   if (owns_ioc_ && ioc_thread_.joinable()) {
     auto self = shared_from_this();
     std::promise<void> cleanup_promise;
@@ -101,6 +110,7 @@ void TcpServer::stop() {
       {
         std::lock_guard<std::mutex> lock(self->sessions_mutex_);
         self->sessions_.clear();
+        self->topics_.clear();
       }
       if (self->current_session_) self->current_session_.reset();
       cleanup_promise.set_value();
@@ -123,6 +133,7 @@ void TcpServer::stop() {
     {
       std::lock_guard<std::mutex> lock(sessions_mutex_);
       sessions_.clear();
+      topics_.clear();
     }
     if (current_session_) current_session_.reset();
   }
@@ -150,6 +161,8 @@ void TcpServer::on_backpressure(OnBackpressure cb) {
   if (current_session_) current_session_->on_backpressure(on_bp_);
 }
 
+common::ChannelMetricsSnapshot TcpServer::metrics() const { return metrics_->snapshot(); }
+
 void TcpServer::attempt_port_binding(int retry_count) {
   boost::system::error_code ec;
 
@@ -236,13 +249,17 @@ void TcpServer::do_accept() {
   if (!acceptor_ || !acceptor_->is_open()) return;
 
   auto self = shared_from_this();
+  common::AsyncTracer::begin(this, Track::Lifecycle, "accept");
   acceptor_->async_accept([self](auto ec, tcp::socket sock) {
+    common::AsyncTracer::end(self.get(), Track::Lifecycle, "accept");
     if (ec) {
       // "Operation canceled"는 정상적인 종료 과정에서 발생하는 에러이므로 로그 레벨을 낮춤
       if (ec == boost::asio::error::operation_aborted) {
         UNILINK_LOG_DEBUG("tcp_server", "accept", "Accept canceled (server shutting down)");
       } else {
-        UNILINK_LOG_ERROR("tcp_server", "accept", "Accept error: " + ec.message());
+        UNILINK_LOG_RATE_LIMITED(common::LogLevel::ERROR, "tcp_server", "accept",
+                                 common::constants::ERROR_LOG_RATE_PER_SECOND, common::constants::ERROR_LOG_BURST,
+                                 "Accept error: " + ec.message());
         common::error_reporting::report_connection_error("tcp_server", "accept", ec, true);
         self->state_.set_state(common::LinkState::Error);
         self->notify_state();
@@ -262,14 +279,17 @@ void TcpServer::do_accept() {
     }
 
     // Client limit check (after connection acceptance, before session creation)
-    if (self->client_limit_enabled_) {
+    {
       std::lock_guard<std::mutex> lock(self->sessions_mutex_);
-      if (self->sessions_.size() >= self->max_clients_) {
+      if (self->client_limit_enabled_ && self->sessions_.size() >= self->max_clients_) {
         UNILINK_LOG_WARNING("tcp_server", "accept",
                             "Client connection rejected - server at capacity (" +
                                 std::to_string(self->sessions_.size()) + "/" + std::to_string(self->max_clients_) +
                                 "): " + client_info);
 
+        self->metrics_->record_reject();
+        UNILINK_TRACE2(reject, self.get(), self->sessions_.size());
+
         // 소켓을 즉시 닫아서 연결 거부
         boost::system::error_code close_ec;
         sock.close(close_ec);
@@ -290,8 +310,10 @@ void TcpServer::do_accept() {
     }
 
     // Create new session
-    auto new_session =
-        std::make_shared<TcpServerSession>(self->ioc_, std::move(sock), self->cfg_.backpressure_threshold);
+    auto new_session = std::make_shared<TcpServerSession>(self->ioc_, std::move(sock),
+                                                          self->cfg_.backpressure_threshold, self->metrics_);
+    self->metrics_->record_accept();
+    if (self->track_tx_latency_) new_session->set_tx_latency_tracking(true);
 
     // Add session to list
     size_t client_id;
@@ -301,6 +323,11 @@ void TcpServer::do_accept() {
       self->sessions_.push_back(new_session);
       client_id = self->sessions_.size() - 1;
     }
+    UNILINK_TRACE3(accept, self.get(), new_session.get(), client_id);
+    if (common::AsyncTracer::enabled()) {
+      common::AsyncTracer::instance().name_channel(new_session.get(),
+                                                   "tcp_session " + std::to_string(client_id) + " " + client_info);
+    }
 
     // Update current active session (existing API compatibility)
     self->current_session_ = new_session;
@@ -331,12 +358,14 @@ void TcpServer::do_accept() {
       }
 
       // Remove from session list
+      // Under the same lock as subscribe(), so a closing session cannot be subscribed after its removal
       {
         std::lock_guard<std::mutex> lock(self->sessions_mutex_);
         auto it = std::find(self->sessions_.begin(), self->sessions_.end(), new_session);
         if (it != self->sessions_.end()) {
           self->sessions_.erase(it);
         }
+        self->topics_.remove(new_session.get());
       }
 
       // Clean up if current session is the terminated session
@@ -364,9 +393,11 @@ void TcpServer::do_accept() {
 }
 
 void TcpServer::notify_state() {
+  auto state = state_.get_state();
+  UNILINK_TRACE2(state, this, static_cast<int>(state));
   if (on_state_) {
     try {
-      on_state_(state_.get_state());
+      on_state_(state);
     } catch (const std::exception& e) {
       UNILINK_LOG_ERROR("tcp_server", "callback", "State callback error: " + std::string(e.what()));
       common::error_reporting::report_system_error("tcp_server", "state_callback",
@@ -399,6 +430,33 @@ void TcpServer::send_to_client(size_t client_id, const std::string& message) {
   }
 }
 
+bool TcpServer::subscribe(size_t client_id, const std::string& topic) {
+  // The close handler removes a session from sessions_ and topics_ under this lock
+  std::lock_guard<std::mutex> lock(sessions_mutex_);
+  if (client_id >= sessions_.size()) return false;
+  const auto& session = sessions_[client_id];
+  if (!session || !session->alive()) return false;
+  return topics_.subscribe(session, topic);
+}
+
+bool TcpServer::unsubscribe(size_t client_id, const std::string& topic) {
+  std::lock_guard<std::mutex> lock(sessions_mutex_);
+  if (client_id >= sessions_.size()) return false;
+  const auto& session = sessions_[client_id];
+  if (!session) return false;
+  return topics_.unsubscribe(session.get(), topic);
+}
+
+size_t TcpServer::publish(const std::string& topic, const uint8_t* data, size_t size) {
+  return topics_.publish(ioc_, topic, data, size);
+}
+
+size_t TcpServer::publish(const std::string& topic, const std::string& message) {
+  return publish(topic, reinterpret_cast<const uint8_t*>(message.data()), message.size());
+}
+
+size_t TcpServer::get_subscriber_count(const std::string& topic) const { return topics_.subscriber_count(topic); }
+
 size_t TcpServer::get_client_count() const {
   std::lock_guard<std::mutex> lock(sessions_mutex_);
   return sessions_.size();
@@ -424,14 +482,56 @@ void TcpServer::on_multi_data(MultiClientDataHandler handler) { on_multi_data_ =
 void TcpServer::on_multi_disconnect(MultiClientDisconnectHandler handler) { on_multi_disconnect_ = std::move(handler); }
 
 void TcpServer::set_client_limit(size_t max_clients) {
+  std::lock_guard<std::mutex> lock(sessions_mutex_);
   max_clients_ = max_clients;
   client_limit_enabled_ = true;
 }
 
 void TcpServer::set_unlimited_clients() {
+  std::lock_guard<std::mutex> lock(sessions_mutex_);
   client_limit_enabled_ = false;
   max_clients_ = 0;
 }
 
+void TcpServer::set_backpressure_threshold(size_t threshold) {
+  threshold = std::clamp(threshold, common::constants::MIN_BACKPRESSURE_THRESHOLD,
+                         common::constants::MAX_BACKPRESSURE_THRESHOLD);
+  post_config([this, threshold] {
+    cfg_.backpressure_threshold = threshold;
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+    for (auto& session : sessions_) {
+      if (session) session->set_backpressure_threshold(threshold);
+    }
+  });
+}
+
+void TcpServer::set_tx_latency_tracking(bool enabled) {
+  post_config([this, enabled] {
+    track_tx_latency_ = enabled;
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+    for (auto& session : sessions_) {
+      if (session) session->set_tx_latency_tracking(enabled);
+    }
+  });
+}
+
+void TcpServer::set_loop_monitor(std::shared_ptr<common::LoopMonitor> monitor) {
+  if (loop_monitor_) loop_monitor_->stop();
+  loop_monitor_ = std::move(monitor);
+  if (loop_monitor_) loop_monitor_->start(ioc_);
+}
+
+void TcpServer::post_config(std::function<void()> apply) {
+  auto weak = weak_from_this();
+  if (weak.expired()) {
+    apply();  // Not owned by a shared_ptr, so there is no handler lifetime to tie the update to
+    return;
+  }
+  // The accept handler reads these settings on ioc_, so updates are serialized with it
+  net::post(ioc_, [weak, apply = std::move(apply)] {
+    if (auto self = weak.lock()) apply();
+  });
+}
+
 }  // namespace transport
 }  // namespace unilink
\ No newline at end of file
@@ -35,6 +35,7 @@
 #include "unilink/interface/channel.hpp"
 #include "unilink/interface/itcp_acceptor.hpp"
 #include "unilink/transport/tcp_server/tcp_server_session.hpp"
+#include "unilink/transport/tcp_server/topic_router.hpp"
 
 namespace unilink {
 namespace transport {
@@ -64,6 +65,7 @@ class TcpServer : public Channel,
   void on_bytes(OnBytes cb) override;
   void on_state(OnState cb) override;
   void on_backpressure(OnBackpressure cb) override;
+  common::ChannelMetricsSnapshot metrics() const override;
 
   // Multi-client support methods
   void broadcast(const std::string& message);
@@ -71,6 +73,13 @@ class TcpServer : public Channel,
   size_t get_client_count() const;
   std::vector<size_t> get_connected_clients() const;
 
+  // Topic pub/sub; subscriptions are dropped when the client disconnects
+  bool subscribe(size_t client_id, const std::string& topic);
+  bool unsubscribe(size_t client_id, const std::string& topic);
+  size_t publish(const std::string& topic, const uint8_t* data, size_t size);
+  size_t publish(const std::string& topic, const std::string& message);
+  size_t get_subscriber_count(const std::string& topic) const;
+
   // Multi-client callback type definitions
   using MultiClientConnectHandler = std::function<void(size_t client_id, const std::string& client_info)>;
   using MultiClientDataHandler = std::function<void(size_t client_id, const std::string& data)>;
@@ -84,10 +93,18 @@ class TcpServer : public Channel,
   void set_client_limit(size_t max_clients);
   void set_unlimited_clients();
 
+  // Applied to new and already connected sessions without closing them
+  void set_backpressure_threshold(size_t threshold);
+
+  // Record enqueue-to-completion time of every queued write into metrics()
+  void set_tx_latency_tracking(bool enabled) override;
+  void set_loop_monitor(std::shared_ptr<common::LoopMonitor> monitor) override;
+
  private:
   void do_accept();
   void notify_state();
   void attempt_port_binding(int retry_count);
+  void post_config(std::function<void()> apply);
 
  private:
   std::unique_ptr<net::io_context> owned_ioc_;
@@ -101,10 +118,14 @@ class TcpServer : public Channel,
   // Multi-client support
   std::vector<std::shared_ptr<TcpServerSession>> sessions_;
   mutable std::mutex sessions_mutex_;
+  TopicRouter topics_;  // Membership changes are made under sessions_mutex_
+  std::shared_ptr<common::ChannelMetrics> metrics_ = std::make_shared<common::ChannelMetrics>();
+  std::shared_ptr<common::LoopMonitor> loop_monitor_;
 
   // Client limit configuration
-  size_t max_clients_;
+  size_t max_clients_;  // Client limit settings are guarded by sessions_mutex_
   bool client_limit_enabled_;
+  bool track_tx_latency_ = false;
 
   // Current active session for existing API compatibility
   std::shared_ptr<TcpServerSession> current_session_;
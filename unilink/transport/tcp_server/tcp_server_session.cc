@@ -19,29 +19,48 @@
 #include <cstring>
 #include <iostream>
 
+#include "unilink/common/async_tracer.hpp"
 #include "unilink/common/memory_pool.hpp"
+#include "unilink/common/tracepoints.hpp"
 #include "unilink/transport/tcp_server/boost_tcp_socket.hpp"
 
 namespace unilink {
 namespace transport {
 
 using namespace common;
+using Track = AsyncTracer::Track;
 
-TcpServerSession::TcpServerSession(net::io_context& ioc, tcp::socket sock, size_t backpressure_threshold)
+namespace {
+
+net::const_buffer buffer_view(const common::PooledBuffer& buf) { return net::buffer(buf.data(), buf.size()); }
+net::const_buffer buffer_view(const std::vector<uint8_t>& buf) { return net::buffer(buf); }
+net::const_buffer buffer_view(const TcpServerSession::SharedBuffer& buf) { return net::buffer(*buf); }
+
+template <typename... Ts>
+net::const_buffer buffer_view(const std::variant<Ts...>& buf) {
+  return std::visit([](const auto& alternative) { return buffer_view(alternative); }, buf);
+}
+
+}  // namespace
+
+TcpServerSession::TcpServerSession(net::io_context& ioc, tcp::socket sock, size_t backpressure_threshold,
+                                   std::shared_ptr<common::ChannelMetrics> metrics)
     : ioc_(ioc),
       socket_(std::make_unique<BoostTcpSocket>(std::move(sock))),
       writing_(false),
       queue_bytes_(0),
       bp_high_(backpressure_threshold),
+      metrics_(metrics ? std::move(metrics) : std::make_shared<common::ChannelMetrics>()),
       alive_(false) {}
 
 TcpServerSession::TcpServerSession(net::io_context& ioc, std::unique_ptr<interface::TcpSocketInterface> socket,
-                                   size_t backpressure_threshold)
+                                   size_t backpressure_threshold, std::shared_ptr<common::ChannelMetrics> metrics)
     : ioc_(ioc),
       socket_(std::move(socket)),
       writing_(false),
       queue_bytes_(0),
       bp_high_(backpressure_threshold),
+      metrics_(metrics ? std::move(metrics) : std::make_shared<common::ChannelMetrics>()),
       alive_(false) {}
 
 void TcpServerSession::start() { start_read(); }
@@ -57,11 +76,7 @@ void TcpServerSession::async_write_copy(const uint8_t* data, size_t size) {
       common::safe_memory::safe_memcpy(pooled_buffer.data(), data, size);
 
       net::post(ioc_, [self = shared_from_this(), buf = std::move(pooled_buffer)]() mutable {
-        if (!self->alive_) return;  // Double-check in case session was closed
-        self->queue_bytes_ += buf.size();
-        self->tx_.emplace_back(std::move(buf));
-        if (self->on_bp_ && self->queue_bytes_ > self->bp_high_) self->on_bp_(self->queue_bytes_);
-        if (!self->writing_) self->do_write();
+        self->enqueue(std::move(buf));
       });
       return;
     }
@@ -70,28 +85,57 @@ void TcpServerSession::async_write_copy(const uint8_t* data, size_t size) {
   // Fallback to regular allocation for large buffers or pool exhaustion
   std::vector<uint8_t> fallback(data, data + size);
 
-  net::post(ioc_, [self = shared_from_this(), buf = std::move(fallback)]() mutable {
-    if (!self->alive_) return;  // Double-check in case session was closed
-    self->queue_bytes_ += buf.size();
-    self->tx_.emplace_back(std::move(buf));
-    if (self->on_bp_ && self->queue_bytes_ > self->bp_high_) self->on_bp_(self->queue_bytes_);
-    if (!self->writing_) self->do_write();
-  });
+  net::post(ioc_, [self = shared_from_this(), buf = std::move(fallback)]() mutable { self->enqueue(std::move(buf)); });
+}
+
+void TcpServerSession::enqueue_shared(SharedBuffer buffer) {
+  if (buffer) enqueue(std::move(buffer));
+}
+
+void TcpServerSession::enqueue(TxBuffer buffer) {
+  if (!alive_) return;  // Double-check in case session was closed
+  size_t size = buffer_view(buffer).size();
+  queue_bytes_ += size;
+  AsyncTracer::counter(this, "queued_bytes", queue_bytes_);
+  metrics_->record_enqueue(size);
+  tx_latency_.on_enqueue();
+  tx_.emplace_back(std::move(buffer));
+  if (queue_bytes_ > bp_high_) {
+    metrics_->record_backpressure();
+    UNILINK_TRACE2(backpressure, this, queue_bytes_);
+    if (on_bp_) on_bp_(queue_bytes_);
+  }
+  if (!writing_) do_write();
 }
 
 void TcpServerSession::on_bytes(OnBytes cb) { on_bytes_ = std::move(cb); }
 void TcpServerSession::on_backpressure(OnBackpressure cb) { on_bp_ = std::move(cb); }
 void TcpServerSession::on_close(OnClose cb) { on_close_ = std::move(cb); }
+void TcpServerSession::set_backpressure_threshold(size_t threshold) {
+  net::post(ioc_, [weak = weak_from_this(), threshold] {
+    if (auto self = weak.lock()) self->bp_high_ = threshold;
+  });
+}
+void TcpServerSession::set_tx_latency_tracking(bool enabled) {
+  net::post(ioc_, [weak = weak_from_this(), enabled] {
+    if (auto self = weak.lock()) self->tx_latency_.set_enabled(enabled, self->tx_.size());
+  });
+}
 bool TcpServerSession::alive() const { return alive_; }
+const common::ChannelMetrics& TcpServerSession::metrics() const { return *metrics_; }
 
 void TcpServerSession::start_read() {
   alive_ = true;
   auto self = shared_from_this();
+  AsyncTracer::begin(this, Track::Read, "read");
   socket_->async_read_some(net::buffer(rx_.data(), rx_.size()), [self](auto ec, std::size_t n) {
+    AsyncTracer::end(self.get(), Track::Read, "read");
     if (ec) {
       self->do_close();
       return;
     }
+    self->metrics_->record_read(n);
+    UNILINK_TRACE2(read, self.get(), n);
     if (self->on_bytes_) self->on_bytes_(self->rx_.data(), n);
     self->start_read();
   });
@@ -104,37 +148,32 @@ void TcpServerSession::do_write() {
   }
   writing_ = true;
   auto self = shared_from_this();
-
-  // Handle both PooledBuffer and std::vector<uint8_t> (fallback)
-  auto& front_buffer = tx_.front();
-  if (std::holds_alternative<common::PooledBuffer>(front_buffer)) {
-    auto& pooled_buf = std::get<common::PooledBuffer>(front_buffer);
-    socket_->async_write(net::buffer(pooled_buf.data(), pooled_buf.size()), [self](auto ec, std::size_t n) {
-      self->queue_bytes_ -= n;
-      if (ec) {
-        self->do_close();
-        return;
-      }
-      self->tx_.pop_front();
-      self->do_write();
-    });
-  } else {
-    auto& vec_buf = std::get<std::vector<uint8_t>>(front_buffer);
-    socket_->async_write(net::buffer(vec_buf), [self](auto ec, std::size_t n) {
-      self->queue_bytes_ -= n;
-      if (ec) {
-        self->do_close();
-        return;
-      }
-      self->tx_.pop_front();
-      self->do_write();
-    });
-  }
+  UNILINK_TRACE3(write_start, this, buffer_view(tx_.front()).size(), queue_bytes_);
+  AsyncTracer::begin(this, Track::Write, "write");
+
+  socket_->async_write(buffer_view(tx_.front()), [self, started = ChannelMetrics::now()](auto ec, std::size_t n) {
+    AsyncTracer::end(self.get(), Track::Write, "write");
+    self->queue_bytes_ -= n;
+    if (!self->alive_) return;  // do_close() already settled the queue accounting
+    AsyncTracer::counter(self.get(), "queued_bytes", self->queue_bytes_);
+    self->metrics_->record_dequeue(n);
+    if (ec) {
+      self->do_close();
+      return;
+    }
+    self->metrics_->record_write(n, started);
+    UNILINK_TRACE3(write_done, self.get(), n, self->queue_bytes_);
+    self->tx_latency_.on_complete(*self->metrics_);
+    self->tx_.pop_front();
+    self->do_write();
+  });
 }
 
 void TcpServerSession::do_close() {
   if (!alive_) return;
   alive_ = false;
+  metrics_->record_dequeue(queue_bytes_);
+  metrics_->record_disconnect();
   UNILINK_LOG_INFO("tcp_server_session", "disconnect", "Client disconnected");
   boost::system::error_code ec;
   socket_->shutdown(tcp::socket::shutdown_both, ec);
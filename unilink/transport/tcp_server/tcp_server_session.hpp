@@ -25,6 +25,7 @@
 #include <variant>
 #include <vector>
 
+#include "unilink/common/channel_metrics.hpp"
 #include "unilink/common/constants.hpp"
 #include "unilink/common/error_handler.hpp"
 #include "unilink/common/logger.hpp"
@@ -47,22 +48,34 @@ class TcpServerSession : public std::enable_shared_from_this<TcpServerSession> {
   using OnBytes = interface::Channel::OnBytes;
   using OnBackpressure = interface::Channel::OnBackpressure;
   using OnClose = std::function<void()>;
+  using SharedBuffer = std::shared_ptr<const std::vector<uint8_t>>;
 
+  // Sessions of one server share its metrics; a session without one keeps its own
   TcpServerSession(net::io_context& ioc, tcp::socket sock,
-                   size_t backpressure_threshold = common::constants::DEFAULT_BACKPRESSURE_THRESHOLD);
+                   size_t backpressure_threshold = common::constants::DEFAULT_BACKPRESSURE_THRESHOLD,
+                   std::shared_ptr<common::ChannelMetrics> metrics = nullptr);
   // Constructor for testing with dependency injection
   TcpServerSession(net::io_context& ioc, std::unique_ptr<interface::TcpSocketInterface> socket,
-                   size_t backpressure_threshold = common::constants::DEFAULT_BACKPRESSURE_THRESHOLD);
+                   size_t backpressure_threshold = common::constants::DEFAULT_BACKPRESSURE_THRESHOLD,
+                   std::shared_ptr<common::ChannelMetrics> metrics = nullptr);
 
   void start();
   void async_write_copy(const uint8_t* data, size_t size);
+  // Queue a buffer shared with other sessions; must be called on the io thread
+  void enqueue_shared(SharedBuffer buffer);
   void on_bytes(OnBytes cb);
   void on_backpressure(OnBackpressure cb);
   void on_close(OnClose cb);
+  void set_backpressure_threshold(size_t threshold);
+  void set_tx_latency_tracking(bool enabled);
   bool alive() const;
+  const common::ChannelMetrics& metrics() const;
 
  private:
   void start_read();
+  using TxBuffer = std::variant<common::PooledBuffer, std::vector<uint8_t>, SharedBuffer>;
+
+  void enqueue(TxBuffer buffer);
   void do_write();
   void do_close();
 
@@ -70,10 +83,12 @@ class TcpServerSession : public std::enable_shared_from_this<TcpServerSession> {
   net::io_context& ioc_;
   std::unique_ptr<interface::TcpSocketInterface> socket_;
   std::array<uint8_t, common::constants::DEFAULT_READ_BUFFER_SIZE> rx_{};
-  std::deque<std::variant<common::PooledBuffer, std::vector<uint8_t>>> tx_;
+  std::deque<TxBuffer> tx_;
   bool writing_ = false;
   size_t queue_bytes_ = 0;
   size_t bp_high_;  // Configurable backpressure threshold
+  std::shared_ptr<common::ChannelMetrics> metrics_;
+  common::TxLatencyTracker tx_latency_;
 
   OnBytes on_bytes_;
   OnBackpressure on_bp_;
@@ -0,0 +1,123 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "unilink/transport/tcp_server/topic_router.hpp"
+
+#include <algorithm>
+
+namespace unilink {
+namespace transport {
+
+bool TopicRouter::subscribe(const std::shared_ptr<TcpServerSession>& session, const std::string& topic) {
+  if (!session) return false;
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& entry = topics_[topic];
+  auto it = std::find(entry.subscribers.begin(), entry.subscribers.end(), session);
+  if (it != entry.subscribers.end()) return false;
+
+  entry.subscribers.push_back(session);
+  entry.snapshot.reset();
+  session_topics_[session.get()].push_back(topic);
+  return true;
+}
+
+bool TopicRouter::unsubscribe(const TcpServerSession* session, const std::string& topic) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!erase_subscriber(session, topic)) return false;
+
+  auto it = session_topics_.find(session);
+  if (it != session_topics_.end()) {
+    auto& names = it->second;
+    names.erase(std::remove(names.begin(), names.end(), topic), names.end());
+    if (names.empty()) session_topics_.erase(it);
+  }
+  return true;
+}
+
+void TopicRouter::remove(const TcpServerSession* session) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = session_topics_.find(session);
+  if (it == session_topics_.end()) return;
+  for (const auto& topic : it->second) {
+    erase_subscriber(session, topic);
+  }
+  session_topics_.erase(it);
+}
+
+void TopicRouter::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  topics_.clear();
+  session_topics_.clear();
+}
+
+size_t TopicRouter::publish(net::io_context& ioc, const std::string& topic, const uint8_t* data, size_t size) {
+  std::shared_ptr<const Subscribers> subscribers;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = topics_.find(topic);
+    if (it == topics_.end()) return 0;
+    auto& entry = it->second;
+    if (!entry.snapshot) entry.snapshot = std::make_shared<const Subscribers>(entry.subscribers);
+    subscribers = entry.snapshot;
+  }
+
+  auto payload = std::make_shared<const std::vector<uint8_t>>(data, data + size);
+  net::post(ioc, [subscribers, payload = std::move(payload)] {
+    for (const auto& session : *subscribers) {
+      session->enqueue_shared(payload);
+    }
+  });
+  return subscribers->size();
+}
+
+size_t TopicRouter::subscriber_count(const std::string& topic) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = topics_.find(topic);
+  return it == topics_.end() ? 0 : it->second.subscribers.size();
+}
+
+std::vector<std::string> TopicRouter::topics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<std::string> names;
+  names.reserve(topics_.size());
+  for (const auto& entry : topics_) {
+    names.push_back(entry.first);
+  }
+  return names;
+}
+
+bool TopicRouter::erase_subscriber(const TcpServerSession* session, const std::string& topic) {
+  auto it = topics_.find(topic);
+  if (it == topics_.end()) return false;
+  auto& subscribers = it->second.subscribers;
+  auto pos = std::find_if(subscribers.begin(), subscribers.end(),
+                          [session](const auto& candidate) { return candidate.get() == session; });
+  if (pos == subscribers.end()) return false;
+
+  // Order does not matter, so swap with the last entry instead of shifting
+  *pos = std::move(subscribers.back());
+  subscribers.pop_back();
+  if (subscribers.empty()) {
+    topics_.erase(it);
+  } else {
+    it->second.snapshot.reset();
+  }
+  return true;
+}
+
+}  // namespace transport
+}  // namespace unilink
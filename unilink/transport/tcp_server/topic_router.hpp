@@ -0,0 +1,87 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "unilink/transport/tcp_server/tcp_server_session.hpp"
+
+namespace unilink {
+namespace transport {
+
+/**
+ * @brief Maps topic names to the server sessions subscribed to them
+ *
+ * Each topic keeps its subscribers in a contiguous vector so a publish walks
+ * them linearly. The vector is published to the io thread as an immutable
+ * snapshot that is rebuilt only after the subscriber set changes, so
+ * repeated publishes to a stable topic copy neither the subscriber list nor
+ * the payload: the payload is copied once into a shared buffer and every
+ * session queues a reference to it.
+ */
+class TopicRouter {
+ public:
+  using Subscribers = std::vector<std::shared_ptr<TcpServerSession>>;
+
+  /**
+   * @brief Add a session to a topic
+   * @return false if the session was already subscribed
+   */
+  bool subscribe(const std::shared_ptr<TcpServerSession>& session, const std::string& topic);
+
+  /**
+   * @brief Remove a session from a topic
+   * @return false if the session was not subscribed
+   */
+  bool unsubscribe(const TcpServerSession* session, const std::string& topic);
+
+  // Drop a session from every topic (called when it closes)
+  void remove(const TcpServerSession* session);
+  void clear();
+
+  /**
+   * @brief Queue a payload to every subscriber of a topic
+   *
+   * The fan-out runs as a single handler on @p ioc.
+   * @return Number of subscribers the payload was queued for
+   */
+  size_t publish(net::io_context& ioc, const std::string& topic, const uint8_t* data, size_t size);
+
+  size_t subscriber_count(const std::string& topic) const;
+  std::vector<std::string> topics() const;
+
+ private:
+  struct Topic {
+    Subscribers subscribers;
+    std::shared_ptr<const Subscribers> snapshot;  // Reset whenever subscribers change
+  };
+
+  bool erase_subscriber(const TcpServerSession* session, const std::string& topic);
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Topic> topics_;
+  std::unordered_map<const TcpServerSession*, std::vector<std::string>> session_topics_;
+};
+
+}  // namespace transport
+}  // namespace unilink
@@ -41,8 +41,12 @@
 #include "unilink/builder/tcp_server_builder.hpp"
 #include "unilink/builder/unified_builder.hpp"
 
+// Request/response correlation over any channel
+#include "unilink/wrapper/request/request_channel.hpp"
+
 // Configuration Management API includes (optional)
 #ifdef UNILINK_ENABLE_CONFIG
+#include "unilink/config/config_binder.hpp"
 #include "unilink/config/config_factory.hpp"
 #include "unilink/config/config_manager.hpp"
 #include "unilink/config/iconfig_manager.hpp"
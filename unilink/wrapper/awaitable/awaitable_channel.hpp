@@ -0,0 +1,212 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <boost/asio/awaitable.hpp>
+
+#if defined(BOOST_ASIO_HAS_CO_AWAIT) && __cplusplus >= 202002L
+
+#include <algorithm>
+#include <atomic>
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/system/system_error.hpp>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include "unilink/common/common.hpp"
+#include "unilink/interface/channel.hpp"
+
+namespace unilink {
+namespace wrapper {
+
+/**
+ * @brief Coroutine interface over a Channel
+ *
+ * Exposes a channel as boost::asio awaitables so protocol code can be written
+ * as straight-line coroutines instead of callback state machines:
+ *
+ * @code
+ *   co_await link.wait_connected();
+ *   co_await link.write(request);
+ *   size_t n = co_await link.read_some(reply);
+ * @endcode
+ *
+ * Received bytes are buffered until read; the buffer keeps its capacity, so a
+ * steady stream of reads does not allocate. Coroutine frames are allocated
+ * through Asio's per-thread recycling allocator, so repeated calls reuse the
+ * same frame memory instead of going to the heap.
+ *
+ * The adapter takes over the channel's on_bytes and on_state callbacks. All
+ * awaitables resume on @p executor, which must be single-threaded (an
+ * io_context run by one thread). When it is the context the channel itself
+ * runs on (see the builders' executor() option), no thread hop is involved.
+ *
+ * Header-only: requires a C++20 translation unit; the library itself stays C++17.
+ */
+class AwaitableChannel {
+ public:
+  AwaitableChannel(std::shared_ptr<interface::Channel> channel, boost::asio::any_io_executor executor)
+      : channel_(std::move(channel)), state_(std::make_shared<State>(std::move(executor))) {
+    std::weak_ptr<State> weak = state_;
+    channel_->on_bytes([weak](const uint8_t* data, size_t size) {
+      if (auto state = weak.lock()) state->push(data, size);
+    });
+    channel_->on_state([weak](common::LinkState link_state) {
+      if (auto state = weak.lock()) state->set_link_state(link_state);
+    });
+    state_->set_link_state(channel_->is_connected() ? common::LinkState::Connected : common::LinkState::Idle);
+  }
+
+  ~AwaitableChannel() {
+    channel_->on_bytes(nullptr);
+    channel_->on_state(nullptr);
+  }
+
+  AwaitableChannel(const AwaitableChannel&) = delete;
+  AwaitableChannel& operator=(const AwaitableChannel&) = delete;
+
+  /**
+   * @brief Read at least one byte into @p buffer
+   * @return Number of bytes copied
+   * @throws boost::system::system_error operation_aborted after cancel()
+   */
+  boost::asio::awaitable<size_t> read_some(std::span<uint8_t> buffer) {
+    for (;;) {
+      if (size_t copied = state_->pop(buffer)) co_return copied;
+      if (state_->cancelled) throw boost::system::system_error(boost::asio::error::operation_aborted);
+      boost::system::error_code ec;  // A wake-up is a cancel of the signal timer
+      co_await state_->rx_signal.async_wait(boost::asio::redirect_error(boost::asio::use_awaitable, ec));
+    }
+  }
+
+  /**
+   * @brief Queue @p data for transmission
+   *
+   * Completes once the bytes are copied into the channel's send queue.
+   * @throws boost::system::system_error not_connected if the link is down
+   */
+  boost::asio::awaitable<void> write(std::span<const uint8_t> data) {
+    if (!channel_->is_connected()) throw boost::system::system_error(boost::asio::error::not_connected);
+    channel_->async_write_copy(data.data(), data.size());
+    co_return;
+  }
+
+  /**
+   * @brief Suspend until the channel reports a connection
+   * @throws boost::system::system_error operation_aborted after cancel()
+   */
+  boost::asio::awaitable<void> wait_connected() {
+    for (;;) {
+      if (state_->link_state.load() == common::LinkState::Connected) co_return;
+      if (state_->cancelled) throw boost::system::system_error(boost::asio::error::operation_aborted);
+      boost::system::error_code ec;
+      co_await state_->state_signal.async_wait(boost::asio::redirect_error(boost::asio::use_awaitable, ec));
+    }
+  }
+
+  // Abort all pending and future waits with operation_aborted
+  void cancel() {
+    boost::asio::post(state_->executor, [state = state_] {
+      state->cancelled = true;
+      state->rx_signal.cancel();
+      state->state_signal.cancel();
+    });
+  }
+
+  size_t available() const { return state_->available(); }
+  interface::Channel& channel() { return *channel_; }
+
+ private:
+  // Shared with the channel callbacks so late deliveries after destruction are dropped
+  struct State : std::enable_shared_from_this<State> {
+    explicit State(boost::asio::any_io_executor exec)
+        : executor(std::move(exec)), rx_signal(executor), state_signal(executor) {
+      rx_signal.expires_at(boost::asio::steady_timer::time_point::max());
+      state_signal.expires_at(boost::asio::steady_timer::time_point::max());
+    }
+
+    // Channel thread: buffer bytes and wake the reader once per batch
+    void push(const uint8_t* data, size_t size) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        rx.insert(rx.end(), data, data + size);
+      }
+      if (!rx_wake_pending.exchange(true)) {
+        boost::asio::post(executor, [this, self = weak_from_this()] {
+          if (auto alive = self.lock()) {  // Held until the timer is cancelled
+            rx_wake_pending = false;
+            rx_signal.cancel();
+          }
+        });
+      }
+    }
+
+    size_t pop(std::span<uint8_t> buffer) {
+      std::lock_guard<std::mutex> lock(mutex);
+      size_t copied = std::min(buffer.size(), rx.size() - head);
+      if (copied == 0) return 0;
+      std::memcpy(buffer.data(), rx.data() + head, copied);
+      head += copied;
+      if (head == rx.size()) {
+        rx.clear();  // Keeps capacity
+        head = 0;
+      }
+      return copied;
+    }
+
+    size_t available() const {
+      std::lock_guard<std::mutex> lock(mutex);
+      return rx.size() - head;
+    }
+
+    void set_link_state(common::LinkState value) {
+      link_state = value;
+      boost::asio::post(executor, [this, self = weak_from_this()] {
+        if (auto alive = self.lock()) state_signal.cancel();
+      });
+    }
+
+    boost::asio::any_io_executor executor;
+    boost::asio::steady_timer rx_signal;     // Cancelled when bytes arrive
+    boost::asio::steady_timer state_signal;  // Cancelled on link state changes
+    bool cancelled = false;                  // Executor thread only
+
+    mutable std::mutex mutex;
+    std::vector<uint8_t> rx;
+    size_t head = 0;
+    std::atomic<bool> rx_wake_pending{false};
+    std::atomic<common::LinkState> link_state{common::LinkState::Idle};
+  };
+
+  std::shared_ptr<interface::Channel> channel_;
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace wrapper
+}  // namespace unilink
+
+#endif  // BOOST_ASIO_HAS_CO_AWAIT && C++20
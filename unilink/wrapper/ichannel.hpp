@@ -26,6 +26,9 @@
 #include <memory>
 #include <string>
 
+#include "unilink/common/channel_metrics.hpp"
+#include "unilink/common/loop_monitor.hpp"
+
 namespace unilink {
 namespace wrapper {
 
@@ -46,6 +49,13 @@ class UNILINK_EXPORT ChannelInterface {
   virtual void send_line(const std::string& line) = 0;
   virtual bool is_connected() const = 0;
 
+  // Snapshot of the underlying channel's counters and write latency
+  virtual common::ChannelMetricsSnapshot metrics() const { return {}; }
+  // Opt-in time from send() to write completion, reported as metrics().queue_latency_ns
+  virtual void set_tx_latency_tracking(bool /*enabled*/) {}
+  // Probe the event loop the channel runs on for lag and I/O thread CPU time
+  virtual void set_loop_monitor(std::shared_ptr<common::LoopMonitor> /*monitor*/) {}
+
   // Event handler setup
   virtual ChannelInterface& on_data(DataHandler handler) = 0;
   virtual ChannelInterface& on_connect(ConnectHandler handler) = 0;
@@ -0,0 +1,302 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "unilink/wrapper/request/request_channel.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "unilink/common/logger.hpp"
+
+namespace unilink {
+namespace wrapper {
+
+namespace {
+
+constexpr uint8_t kRequest = 0;
+constexpr uint8_t kResponse = 1;
+constexpr size_t kHeaderSize = 9;  // type + id + length
+constexpr size_t kMaxWindow = 0xFFFF;  // Slot indices stay below the kNone sentinel
+
+void put_u32(uint8_t* out, uint32_t value) {
+  out[0] = static_cast<uint8_t>(value >> 24);
+  out[1] = static_cast<uint8_t>(value >> 16);
+  out[2] = static_cast<uint8_t>(value >> 8);
+  out[3] = static_cast<uint8_t>(value);
+}
+
+uint32_t get_u32(const uint8_t* in) {
+  return (static_cast<uint32_t>(in[0]) << 24) | (static_cast<uint32_t>(in[1]) << 16) |
+         (static_cast<uint32_t>(in[2]) << 8) | static_cast<uint32_t>(in[3]);
+}
+
+}  // namespace
+
+std::shared_ptr<RequestChannel> RequestChannel::create(std::shared_ptr<interface::Channel> channel,
+                                                       boost::asio::any_io_executor timer_executor) {
+  return create(std::move(channel), std::move(timer_executor), Options{});
+}
+
+std::shared_ptr<RequestChannel> RequestChannel::create(std::shared_ptr<interface::Channel> channel,
+                                                       boost::asio::any_io_executor timer_executor,
+                                                       const Options& options) {
+  std::shared_ptr<RequestChannel> rc(new RequestChannel(std::move(channel), std::move(timer_executor), options));
+  rc->attach();
+  return rc;
+}
+
+RequestChannel::RequestChannel(std::shared_ptr<interface::Channel> channel,
+                               boost::asio::any_io_executor timer_executor, const Options& options)
+    : channel_(std::move(channel)), options_(options), timer_(std::move(timer_executor)) {
+  size_t window = std::clamp<size_t>(options_.window, 1, kMaxWindow);
+  slots_.resize(window);
+  free_.reserve(window);
+  for (size_t i = window; i > 0; --i) {
+    free_.push_back(static_cast<uint16_t>(i - 1));
+  }
+}
+
+RequestChannel::~RequestChannel() {
+  channel_->on_bytes(nullptr);
+  channel_->on_state(nullptr);
+  fail_all(Status::Cancelled);
+}
+
+void RequestChannel::attach() {
+  std::weak_ptr<RequestChannel> weak = shared_from_this();
+  channel_->on_bytes([weak](const uint8_t* data, size_t size) {
+    if (auto self = weak.lock()) self->handle_bytes(data, size);
+  });
+  channel_->on_state([weak](common::LinkState state) {
+    if (auto self = weak.lock()) self->handle_state(state);
+  });
+}
+
+bool RequestChannel::request(const uint8_t* data, size_t size, ResponseHandler handler) {
+  return request(data, size, std::move(handler), options_.default_timeout);
+}
+
+bool RequestChannel::request(const uint8_t* data, size_t size, ResponseHandler handler,
+                             std::chrono::milliseconds timeout) {
+  if (!channel_->is_connected()) return false;
+
+  uint32_t id;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_.empty()) return false;
+    uint16_t index = free_.back();
+    free_.pop_back();
+
+    Slot& slot = slots_[index];
+    slot.id = ((slot.id >> 16) + 1) << 16 | index;  // Next generation of this slot
+    slot.busy = true;
+    slot.deadline = Clock::now() + timeout;
+    slot.handler = std::move(handler);
+    link_by_deadline(index);
+    if (slot.deadline < armed_for_) arm_timer();
+    id = slot.id;
+  }
+  send_frame(kRequest, id, data, size);
+  return true;
+}
+
+void RequestChannel::on_request(RequestHandler handler) {
+  std::lock_guard<std::mutex> lock(handler_mutex_);
+  request_handler_ = std::move(handler);
+}
+
+void RequestChannel::respond(uint32_t request_id, const uint8_t* data, size_t size) {
+  send_frame(kResponse, request_id, data, size);
+}
+
+void RequestChannel::cancel_all() { fail_all(Status::Cancelled); }
+
+size_t RequestChannel::in_flight() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return slots_.size() - free_.size();
+}
+
+void RequestChannel::handle_bytes(const uint8_t* data, size_t size) {
+  // Parse straight from the callback buffer when nothing is pending
+  const uint8_t* cursor = data;
+  size_t remaining = size;
+  if (!rx_.empty()) {
+    rx_.insert(rx_.end(), data, data + size);
+    cursor = rx_.data();
+    remaining = rx_.size();
+  }
+
+  while (remaining >= kHeaderSize) {
+    uint32_t length = get_u32(cursor + 5);
+    if (length > options_.max_frame_size) {
+      UNILINK_LOG_ERROR("request_channel", "receive",
+                        "Frame of " + std::to_string(length) + " bytes exceeds limit; dropping buffered data");
+      rx_.clear();
+      return;
+    }
+    if (remaining < kHeaderSize + length) break;
+    handle_frame(cursor[0], get_u32(cursor + 1), cursor + kHeaderSize, length);
+    cursor += kHeaderSize + length;
+    remaining -= kHeaderSize + length;
+  }
+
+  if (rx_.empty()) {
+    rx_.assign(cursor, cursor + remaining);
+  } else {
+    rx_.erase(rx_.begin(), rx_.begin() + static_cast<std::ptrdiff_t>(rx_.size() - remaining));
+  }
+}
+
+void RequestChannel::handle_frame(uint8_t type, uint32_t id, const uint8_t* payload, size_t size) {
+  if (type == kRequest) {
+    RequestHandler handler;
+    {
+      std::lock_guard<std::mutex> lock(handler_mutex_);
+      handler = request_handler_;
+    }
+    if (handler) {
+      handler(id, payload, size);
+    } else {
+      UNILINK_LOG_DEBUG("request_channel", "receive", "No request handler; dropping request " + std::to_string(id));
+    }
+    return;
+  }
+  if (type != kResponse) {
+    UNILINK_LOG_WARNING("request_channel", "receive", "Unknown frame type " + std::to_string(type));
+    return;
+  }
+
+  ResponseHandler handler;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint16_t index = static_cast<uint16_t>(id & 0xFFFF);
+    if (index >= slots_.size() || !slots_[index].busy || slots_[index].id != id) {
+      UNILINK_LOG_DEBUG("request_channel", "receive", "Late or unknown response " + std::to_string(id));
+      return;
+    }
+    handler = release(index);
+  }
+  if (handler) handler(Status::Ok, payload, size);
+}
+
+void RequestChannel::handle_state(common::LinkState state) {
+  if (state == common::LinkState::Closed || state == common::LinkState::Error) {
+    rx_.clear();  // A partial frame cannot continue on a new connection
+    fail_all(Status::ConnectionLost);
+  }
+}
+
+void RequestChannel::send_frame(uint8_t type, uint32_t id, const uint8_t* data, size_t size) {
+  std::lock_guard<std::mutex> lock(tx_mutex_);
+  tx_.resize(kHeaderSize + size);
+  tx_[0] = type;
+  put_u32(tx_.data() + 1, id);
+  put_u32(tx_.data() + 5, static_cast<uint32_t>(size));
+  if (size > 0) std::memcpy(tx_.data() + kHeaderSize, data, size);
+  channel_->async_write_copy(tx_.data(), tx_.size());
+}
+
+void RequestChannel::link_by_deadline(uint16_t index) {
+  Slot& slot = slots_[index];
+  // Deadlines mostly arrive in order, so the walk from the tail is usually zero steps
+  uint16_t after = tail_;
+  while (after != kNone && slots_[after].deadline > slot.deadline) {
+    after = slots_[after].prev;
+  }
+  slot.prev = after;
+  slot.next = after == kNone ? head_ : slots_[after].next;
+  if (slot.prev == kNone) {
+    head_ = index;
+  } else {
+    slots_[slot.prev].next = index;
+  }
+  if (slot.next == kNone) {
+    tail_ = index;
+  } else {
+    slots_[slot.next].prev = index;
+  }
+}
+
+void RequestChannel::unlink(uint16_t index) {
+  Slot& slot = slots_[index];
+  if (slot.prev == kNone) {
+    head_ = slot.next;
+  } else {
+    slots_[slot.prev].next = slot.next;
+  }
+  if (slot.next == kNone) {
+    tail_ = slot.prev;
+  } else {
+    slots_[slot.next].prev = slot.prev;
+  }
+  slot.prev = slot.next = kNone;
+}
+
+RequestChannel::ResponseHandler RequestChannel::release(uint16_t index) {
+  unlink(index);
+  Slot& slot = slots_[index];
+  slot.busy = false;
+  ResponseHandler handler = std::move(slot.handler);
+  slot.handler = nullptr;
+  free_.push_back(index);
+  return handler;
+}
+
+void RequestChannel::arm_timer() {
+  // Armed for the earliest deadline; completing that request early leaves a
+  // harmless wake-up that finds nothing expired and re-arms for the new head
+  armed_for_ = slots_[head_].deadline;
+  timer_.expires_at(armed_for_);
+  timer_.async_wait([weak = weak_from_this()](const boost::system::error_code& ec) {
+    if (ec == boost::asio::error::operation_aborted) return;
+    if (auto self = weak.lock()) self->on_timer();
+  });
+}
+
+void RequestChannel::on_timer() {
+  std::vector<ResponseHandler> expired;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = Clock::now();
+    while (head_ != kNone && slots_[head_].deadline <= now) {
+      expired.push_back(release(head_));
+    }
+    armed_for_ = Clock::time_point::max();
+    if (head_ != kNone) arm_timer();
+  }
+  for (auto& handler : expired) {
+    if (handler) handler(Status::Timeout, nullptr, 0);
+  }
+}
+
+void RequestChannel::fail_all(Status status) {
+  std::vector<ResponseHandler> failed;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (head_ != kNone) {
+      failed.push_back(release(head_));
+    }
+    armed_for_ = Clock::time_point::max();
+    timer_.cancel();
+  }
+  for (auto& handler : failed) {
+    if (handler) handler(status, nullptr, 0);
+  }
+}
+
+}  // namespace wrapper
+}  // namespace unilink
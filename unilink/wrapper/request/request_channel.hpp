@@ -0,0 +1,144 @@
+/*
+ * Copyright 2025 Jinwoo Sung
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "unilink/interface/channel.hpp"
+
+namespace unilink {
+namespace wrapper {
+
+/**
+ * @brief Pipelined request/response correlation over any Channel
+ *
+ * Frames each message as [type:u8][id:u32][length:u32][payload] (big-endian)
+ * and matches responses to requests by id, so many requests can be in flight
+ * on one link instead of waiting a full round trip for each reply.
+ *
+ * - Up to `window` requests are outstanding; request() refuses more.
+ * - Request ids encode a slot index plus a generation, so resolving a response
+ *   is an array access without hashing or allocation, and late replies to a
+ *   reused slot are recognised as stale.
+ * - Timeouts share one timer: in-flight slots form an intrusive list ordered
+ *   by deadline and the timer is armed for the earliest one.
+ * - Outstanding requests fail with ConnectionLost when the link drops.
+ *
+ * Both peers use a RequestChannel; either side can issue requests and answer
+ * the other's through on_request()/respond(). Handlers run on the channel's
+ * callback thread or, for timeouts, on @p timer_executor, never under a lock.
+ */
+class RequestChannel : public std::enable_shared_from_this<RequestChannel> {
+ public:
+  enum class Status { Ok, Timeout, ConnectionLost, Cancelled };
+
+  struct Options {
+    size_t window = 64;  // Maximum outstanding requests (1-65535)
+    std::chrono::milliseconds default_timeout{5000};
+    size_t max_frame_size = 1 << 20;  // Larger frames are treated as corruption
+  };
+
+  using ResponseHandler = std::function<void(Status status, const uint8_t* data, size_t size)>;
+  using RequestHandler = std::function<void(uint32_t request_id, const uint8_t* data, size_t size)>;
+
+  // Create and attach to the channel; takes over its on_bytes and on_state callbacks
+  static std::shared_ptr<RequestChannel> create(std::shared_ptr<interface::Channel> channel,
+                                                boost::asio::any_io_executor timer_executor);
+  static std::shared_ptr<RequestChannel> create(std::shared_ptr<interface::Channel> channel,
+                                                boost::asio::any_io_executor timer_executor, const Options& options);
+  ~RequestChannel();
+
+  RequestChannel(const RequestChannel&) = delete;
+  RequestChannel& operator=(const RequestChannel&) = delete;
+
+  /**
+   * @brief Send a request
+   * @return false, without calling @p handler, if the window is full or the link is down
+   */
+  bool request(const uint8_t* data, size_t size, ResponseHandler handler);
+  bool request(const uint8_t* data, size_t size, ResponseHandler handler, std::chrono::milliseconds timeout);
+
+  // Serve requests from the peer; answer each id once with respond()
+  void on_request(RequestHandler handler);
+  void respond(uint32_t request_id, const uint8_t* data, size_t size);
+
+  // Fail all outstanding requests with Cancelled
+  void cancel_all();
+
+  size_t in_flight() const;
+  size_t window() const { return slots_.size(); }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+  static constexpr uint16_t kNone = 0xFFFF;
+
+  struct Slot {
+    uint32_t id = 0;  // Generation in the high bits, slot index in the low 16
+    bool busy = false;
+    Clock::time_point deadline;
+    ResponseHandler handler;
+    uint16_t prev = kNone;  // Deadline list links
+    uint16_t next = kNone;
+  };
+
+  RequestChannel(std::shared_ptr<interface::Channel> channel, boost::asio::any_io_executor timer_executor,
+                 const Options& options);
+  void attach();
+
+  void handle_bytes(const uint8_t* data, size_t size);
+  void handle_frame(uint8_t type, uint32_t id, const uint8_t* payload, size_t size);
+  void handle_state(common::LinkState state);
+  void send_frame(uint8_t type, uint32_t id, const uint8_t* data, size_t size);
+
+  // Require mutex_
+  void link_by_deadline(uint16_t index);
+  void unlink(uint16_t index);
+  ResponseHandler release(uint16_t index);
+  void arm_timer();
+  void on_timer();
+  void fail_all(Status status);
+
+  std::shared_ptr<interface::Channel> channel_;
+  Options options_;
+
+  mutable std::mutex mutex_;
+  std::vector<Slot> slots_;
+  std::vector<uint16_t> free_;  // Stack of free slot indices
+  uint16_t head_ = kNone;       // Earliest deadline
+  uint16_t tail_ = kNone;
+
+  boost::asio::steady_timer timer_;
+  Clock::time_point armed_for_ = Clock::time_point::max();
+
+  std::vector<uint8_t> rx_;  // Reassembly buffer, keeps its capacity
+  std::vector<uint8_t> tx_;  // Frame scratch buffer
+  std::mutex tx_mutex_;
+
+  std::mutex handler_mutex_;  // Guards request_handler_; it is called outside the lock
+  RequestHandler request_handler_;
+};
+
+}  // namespace wrapper
+}  // namespace unilink
@@ -32,6 +32,9 @@ Serial::Serial(const std::string& device, uint32_t baud_rate)
   // Channel will be created later at start() time
 }
 
+Serial::Serial(const std::string& device, uint32_t baud_rate, boost::asio::io_context& ioc)
+    : device_(device), baud_rate_(baud_rate), ioc_(&ioc), channel_(nullptr) {}
+
 Serial::Serial(std::shared_ptr<interface::Channel> channel) : device_(""), baud_rate_(9600), channel_(channel) {
   setup_internal_handlers();
 }
@@ -60,8 +63,10 @@ void Serial::start() {
     config.retry_interval_ms = static_cast<unsigned int>(retry_interval_.count());
     // parity and flow need to be converted to enum
     config.flow = unilink::config::SerialConfig::Flow::None;
-    channel_ = factory::ChannelFactory::create(config);
+    channel_ = ioc_ ? factory::ChannelFactory::create(config, *ioc_) : factory::ChannelFactory::create(config);
     setup_internal_handlers();
+    if (track_tx_latency_) channel_->set_tx_latency_tracking(true);
+    if (loop_monitor_) channel_->set_loop_monitor(loop_monitor_);
   }
 
   channel_->start();
@@ -89,6 +94,20 @@ void Serial::send_line(const std::string& line) { send(line + "\n"); }
 
 bool Serial::is_connected() const { return channel_ && channel_->is_connected(); }
 
+common::ChannelMetricsSnapshot Serial::metrics() const {
+  return channel_ ? channel_->metrics() : common::ChannelMetricsSnapshot{};
+}
+
+void Serial::set_tx_latency_tracking(bool enabled) {
+  track_tx_latency_ = enabled;
+  if (channel_) channel_->set_tx_latency_tracking(enabled);
+}
+
+void Serial::set_loop_monitor(std::shared_ptr<common::LoopMonitor> monitor) {
+  loop_monitor_ = std::move(monitor);
+  if (channel_) channel_->set_loop_monitor(loop_monitor_);
+}
+
 ChannelInterface& Serial::on_data(DataHandler handler) {
   data_handler_ = std::move(handler);
   if (channel_) {
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <boost/asio/io_context.hpp>
 #include <chrono>
 #include <functional>
 #include <memory>
@@ -30,6 +31,8 @@ namespace wrapper {
 class Serial : public ChannelInterface {
  public:
   Serial(const std::string& device, uint32_t baud_rate);
+  // Run the channel on a caller-owned io_context; it must outlive the serial port
+  Serial(const std::string& device, uint32_t baud_rate, boost::asio::io_context& ioc);
   explicit Serial(std::shared_ptr<interface::Channel> channel);
   ~Serial() override;
 
@@ -39,6 +42,9 @@ class Serial : public ChannelInterface {
   void send(const std::string& data) override;
   void send_line(const std::string& line) override;
   bool is_connected() const override;
+  common::ChannelMetricsSnapshot metrics() const override;
+  void set_tx_latency_tracking(bool enabled) override;
+  void set_loop_monitor(std::shared_ptr<common::LoopMonitor> monitor) override;
 
   ChannelInterface& on_data(DataHandler handler) override;
   ChannelInterface& on_connect(ConnectHandler handler) override;
@@ -62,6 +68,7 @@ class Serial : public ChannelInterface {
  private:
   std::string device_;
   uint32_t baud_rate_;
+  boost::asio::io_context* ioc_ = nullptr;  // Null means the shared IoContextManager context
   std::shared_ptr<interface::Channel> channel_;
 
   // Event handlers
@@ -72,6 +79,8 @@ class Serial : public ChannelInterface {
 
   // Configuration
   bool auto_manage_ = false;
+  bool track_tx_latency_ = false;
+  std::shared_ptr<common::LoopMonitor> loop_monitor_;
   bool started_ = false;
 
   // Serial-specific configuration
@@ -31,6 +31,9 @@ TcpClient::TcpClient(const std::string& host, uint16_t port) : host_(host), port
   // Channel will be created later at start() time
 }
 
+TcpClient::TcpClient(const std::string& host, uint16_t port, boost::asio::io_context& ioc)
+    : host_(host), port_(port), ioc_(&ioc), channel_(nullptr) {}
+
 TcpClient::TcpClient(std::shared_ptr<interface::Channel> channel) : host_(""), port_(0), channel_(channel) {
   setup_internal_handlers();
 }
@@ -55,8 +58,10 @@ void TcpClient::start() {
     config.host = host_;
     config.port = port_;
     config.retry_interval_ms = static_cast<unsigned int>(retry_interval_.count());
-    channel_ = factory::ChannelFactory::create(config);
+    channel_ = ioc_ ? factory::ChannelFactory::create(config, *ioc_) : factory::ChannelFactory::create(config);
     setup_internal_handlers();
+    if (track_tx_latency_) channel_->set_tx_latency_tracking(true);
+    if (loop_monitor_) channel_->set_loop_monitor(loop_monitor_);
   }
 
   channel_->start();
@@ -84,6 +89,20 @@ void TcpClient::send_line(const std::string& line) { send(line + "\n"); }
 
 bool TcpClient::is_connected() const { return channel_ && channel_->is_connected(); }
 
+common::ChannelMetricsSnapshot TcpClient::metrics() const {
+  return channel_ ? channel_->metrics() : common::ChannelMetricsSnapshot{};
+}
+
+void TcpClient::set_tx_latency_tracking(bool enabled) {
+  track_tx_latency_ = enabled;
+  if (channel_) channel_->set_tx_latency_tracking(enabled);
+}
+
+void TcpClient::set_loop_monitor(std::shared_ptr<common::LoopMonitor> monitor) {
+  loop_monitor_ = std::move(monitor);
+  if (channel_) channel_->set_loop_monitor(loop_monitor_);
+}
+
 ChannelInterface& TcpClient::on_data(DataHandler handler) {
   data_handler_ = std::move(handler);
   if (channel_) {
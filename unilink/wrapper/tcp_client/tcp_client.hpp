@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <boost/asio/io_context.hpp>
 #include <chrono>
 #include <functional>
 #include <memory>
@@ -30,6 +31,8 @@ namespace wrapper {
 class TcpClient : public ChannelInterface {
  public:
   TcpClient(const std::string& host, uint16_t port);
+  // Run the channel on a caller-owned io_context; it must outlive the client
+  TcpClient(const std::string& host, uint16_t port, boost::asio::io_context& ioc);
   explicit TcpClient(std::shared_ptr<interface::Channel> channel);
   ~TcpClient() override;
 
@@ -39,6 +42,9 @@ class TcpClient : public ChannelInterface {
   void send(const std::string& data) override;
   void send_line(const std::string& line) override;
   bool is_connected() const override;
+  common::ChannelMetricsSnapshot metrics() const override;
+  void set_tx_latency_tracking(bool enabled) override;
+  void set_loop_monitor(std::shared_ptr<common::LoopMonitor> monitor) override;
 
   ChannelInterface& on_data(DataHandler handler) override;
   ChannelInterface& on_connect(ConnectHandler handler) override;
@@ -59,6 +65,7 @@ class TcpClient : public ChannelInterface {
  private:
   std::string host_;
   uint16_t port_;
+  boost::asio::io_context* ioc_ = nullptr;  // Null means the shared IoContextManager context
   std::shared_ptr<interface::Channel> channel_;
 
   // Event handlers
@@ -69,6 +76,8 @@ class TcpClient : public ChannelInterface {
 
   // Configuration
   bool auto_manage_ = false;
+  bool track_tx_latency_ = false;
+  std::shared_ptr<common::LoopMonitor> loop_monitor_;
   bool started_ = false;
 
   // TCP client specific configuration
@@ -31,6 +31,8 @@ TcpServer::TcpServer(uint16_t port) : port_(port), channel_(nullptr) {
   // Channel will be created later at start() time
 }
 
+TcpServer::TcpServer(uint16_t port, boost::asio::io_context& ioc) : port_(port), ioc_(&ioc), channel_(nullptr) {}
+
 TcpServer::TcpServer(std::shared_ptr<interface::Channel> channel) : port_(0), channel_(channel) {
   setup_internal_handlers();
 }
@@ -46,8 +48,10 @@ void TcpServer::start() {
     config.max_port_retries = max_port_retries_;
     config.port_retry_interval_ms = port_retry_interval_ms_;
 
-    channel_ = factory::ChannelFactory::create(config);
+    channel_ = ioc_ ? factory::ChannelFactory::create(config, *ioc_) : factory::ChannelFactory::create(config);
     setup_internal_handlers();
+    if (track_tx_latency_) channel_->set_tx_latency_tracking(true);
+    if (loop_monitor_) channel_->set_loop_monitor(loop_monitor_);
 
     // Apply stored client limit configuration
     if (client_limit_enabled_) {
@@ -85,6 +89,20 @@ void TcpServer::send(const std::string& data) {
 
 bool TcpServer::is_connected() const { return channel_ && channel_->is_connected(); }
 
+common::ChannelMetricsSnapshot TcpServer::metrics() const {
+  return channel_ ? channel_->metrics() : common::ChannelMetricsSnapshot{};
+}
+
+void TcpServer::set_tx_latency_tracking(bool enabled) {
+  track_tx_latency_ = enabled;
+  if (channel_) channel_->set_tx_latency_tracking(enabled);
+}
+
+void TcpServer::set_loop_monitor(std::shared_ptr<common::LoopMonitor> monitor) {
+  loop_monitor_ = std::move(monitor);
+  if (channel_) channel_->set_loop_monitor(loop_monitor_);
+}
+
 ChannelInterface& TcpServer::on_data(DataHandler handler) {
   on_data_ = std::move(handler);
   return *this;
@@ -235,6 +253,46 @@ std::vector<size_t> TcpServer::get_connected_clients() const {
   return {};
 }
 
+bool TcpServer::subscribe(size_t client_id, const std::string& topic) {
+  if (channel_) {
+    auto transport_server = std::dynamic_pointer_cast<transport::TcpServer>(channel_);
+    if (transport_server) {
+      return transport_server->subscribe(client_id, topic);
+    }
+  }
+  return false;
+}
+
+bool TcpServer::unsubscribe(size_t client_id, const std::string& topic) {
+  if (channel_) {
+    auto transport_server = std::dynamic_pointer_cast<transport::TcpServer>(channel_);
+    if (transport_server) {
+      return transport_server->unsubscribe(client_id, topic);
+    }
+  }
+  return false;
+}
+
+size_t TcpServer::publish(const std::string& topic, const std::string& message) {
+  if (channel_) {
+    auto transport_server = std::dynamic_pointer_cast<transport::TcpServer>(channel_);
+    if (transport_server) {
+      return transport_server->publish(topic, message);
+    }
+  }
+  return 0;
+}
+
+size_t TcpServer::get_subscriber_count(const std::string& topic) const {
+  if (channel_) {
+    auto transport_server = std::dynamic_pointer_cast<transport::TcpServer>(channel_);
+    if (transport_server) {
+      return transport_server->get_subscriber_count(topic);
+    }
+  }
+  return 0;
+}
+
 TcpServer& TcpServer::on_multi_connect(MultiClientConnectHandler handler) {
   on_multi_connect_ = std::move(handler);
   if (channel_) {
@@ -35,6 +35,8 @@ namespace wrapper {
 class TcpServer : public ChannelInterface {
  public:
   explicit TcpServer(uint16_t port);
+  // Run the channel on a caller-owned io_context; it must outlive the server
+  TcpServer(uint16_t port, boost::asio::io_context& ioc);
   explicit TcpServer(std::shared_ptr<interface::Channel> channel);
   ~TcpServer() = default;
 
@@ -43,6 +45,9 @@ class TcpServer : public ChannelInterface {
   void stop() override;
   void send(const std::string& data) override;
   bool is_connected() const override;
+  common::ChannelMetricsSnapshot metrics() const override;
+  void set_tx_latency_tracking(bool enabled) override;
+  void set_loop_monitor(std::shared_ptr<common::LoopMonitor> monitor) override;
 
   ChannelInterface& on_data(DataHandler handler) override;
   ChannelInterface& on_connect(ConnectHandler handler) override;
@@ -60,6 +65,12 @@ class TcpServer : public ChannelInterface {
   size_t get_client_count() const;
   std::vector<size_t> get_connected_clients() const;
 
+  // Topic pub/sub: publish() encodes once and shares the buffer across subscribers
+  bool subscribe(size_t client_id, const std::string& topic);
+  bool unsubscribe(size_t client_id, const std::string& topic);
+  size_t publish(const std::string& topic, const std::string& message);
+  size_t get_subscriber_count(const std::string& topic) const;
+
   // Multi-client callback type definitions
   using MultiClientConnectHandler = std::function<void(size_t client_id, const std::string& client_info)>;
   using MultiClientDataHandler = std::function<void(size_t client_id, const std::string& data)>;
@@ -85,9 +96,12 @@ class TcpServer : public ChannelInterface {
   void handle_state(common::LinkState state);
 
   uint16_t port_;
+  boost::asio::io_context* ioc_ = nullptr;  // Null means the shared IoContextManager context
   std::shared_ptr<interface::Channel> channel_;
   bool started_{false};
   bool auto_manage_{false};
+  bool track_tx_latency_{false};
+  std::shared_ptr<common::LoopMonitor> loop_monitor_;
 
   // Port retry configuration
   bool port_retry_enabled_{false};